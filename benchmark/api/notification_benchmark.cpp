@@ -0,0 +1,295 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <gmock/gmock.h>
+
+#include "api/jrpc/jrpc_processor.hpp"
+#include "api/jrpc/jrpc_server_impl.hpp"
+#include "api/jrpc/value_converter.hpp"
+#include "api/service/impl/api_service_impl.hpp"
+#include "api/service/impl/rpc_thread_pool.hpp"
+#include "api/transport/listener.hpp"
+#include "mock/core/application/app_state_manager_mock.hpp"
+#include "mock/core/blockchain/block_tree_mock.hpp"
+#include "mock/core/runtime/core_mock.hpp"
+#include "mock/core/storage/trie/trie_batches_mock.hpp"
+#include "mock/core/storage/trie/trie_storage_mock.hpp"
+#include "subscription/extrinsic_event_key_repository.hpp"
+#include "testutil/prepare_loggers.hpp"
+#include "utils/watchdog.hpp"
+
+namespace api = kagome::api;
+namespace events = kagome::primitives::events;
+using kagome::common::Buffer;
+using kagome::primitives::BlockHeader;
+using testing::_;
+using testing::NiceMock;
+using testing::Return;
+
+namespace {
+  // keys of a storage subscription, like balances of a few accounts
+  const std::vector<Buffer> kKeys{
+      Buffer(32, 1), Buffer(32, 2), Buffer(32, 3), Buffer(32, 4)};
+
+  constexpr std::string_view kSubscribeNewHeads =
+      R"({"jsonrpc":"2.0","id":1,"method":"chain_subscribeNewHeads",)"
+      R"("params":[]})";
+  constexpr std::string_view kSubscribeStorage =
+      R"({"jsonrpc":"2.0","id":2,"method":"state_subscribeStorage",)"
+      R"("params":[]})";
+
+  /**
+   * WebSocket session of a client, which counts sent messages instead of
+   * writing them
+   */
+  class CountingSession : public api::Session {
+   public:
+    explicit CountingSession(SessionId id) : id_{id} {}
+
+    void respond(std::string_view message) override {
+      ++messages;
+      bytes += message.size();
+    }
+
+    SessionId id() const override {
+      return id_;
+    }
+
+    api::SessionType type() const override {
+      return api::SessionType::kWs;
+    }
+
+    void post(std::function<void()> cb) override {
+      cb();
+    }
+
+    bool isUnsafeAllowed() const override {
+      return true;
+    }
+
+    size_t messages = 0;
+    size_t bytes = 0;
+
+   private:
+    SessionId id_;
+  };
+
+  class SessionsListener : public api::Listener {
+   public:
+    bool prepare() override {
+      return true;
+    }
+
+    bool start() override {
+      return true;
+    }
+
+    void stop() override {}
+
+    void setHandlerForNewSession(NewSessionHandler &&on_new_session) override {
+      on_new_session_ = std::move(on_new_session);
+    }
+
+    NewSessionHandler on_new_session_;
+
+   protected:
+    void acceptOnce() override {}
+  };
+
+  /// Subscription methods, as registered by chain and state processors
+  class SubscriptionsProcessor : public api::JRpcProcessor {
+   public:
+    explicit SubscriptionsProcessor(std::shared_ptr<api::JRpcServer> server)
+        : server_{std::move(server)} {}
+
+    void registerHandlers() override {
+      server_->registerHandler(
+          "chain_subscribeNewHeads", [this](const auto &) {
+            return api::makeValue(service->subscribeNewHeads().value());
+          });
+      server_->registerHandler(
+          "state_subscribeStorage", [this](const auto &) {
+            auto id = service->subscribeSessionToKeys(kKeys).value();
+            return api::makeValue(id);
+          });
+    }
+
+    std::shared_ptr<api::ApiService> service;
+
+   private:
+    std::shared_ptr<api::JRpcServer> server_;
+  };
+
+  /**
+   * RPC service with sessions, which are subscribed to new heads and the same
+   * storage keys
+   */
+  struct Subscribers {
+    explicit Subscribers(size_t sessions_count) {
+      testutil::prepareLoggers(soralog::Level::ERROR);
+      ON_CALL(*block_tree, bestBlock())
+          .WillByDefault(Return(kagome::primitives::BlockInfo{}));
+      ON_CALL(*block_tree, getBlockHeader(_)).WillByDefault(Return(header));
+      ON_CALL(*trie_storage, getEphemeralBatchAt(_))
+          .WillByDefault(testing::Invoke([](const auto &) {
+            auto batch = std::make_unique<
+                NiceMock<kagome::storage::trie::TrieBatchMock>>();
+            ON_CALL(*batch, tryGetMock(_))
+                .WillByDefault(Return(std::optional<Buffer>{}));
+            return std::unique_ptr<kagome::storage::trie::TrieBatch>{
+                std::move(batch)};
+          }));
+
+      auto processor = std::make_shared<SubscriptionsProcessor>(server);
+      auto service = std::make_shared<api::ApiServiceImpl>(
+          app_state_manager,
+          std::vector<std::shared_ptr<api::Listener>>{listener},
+          server,
+          std::vector<std::shared_ptr<api::JRpcProcessor>>{processor},
+          storage_engine,
+          chain_engine,
+          std::make_shared<events::ExtrinsicSubscriptionEngine>(),
+          std::make_shared<kagome::subscription::ExtrinsicEventKeyRepository>(),
+          block_tree,
+          trie_storage,
+          std::make_shared<kagome::runtime::CoreMock>(),
+          std::make_shared<api::RpcThreadPool>(
+              std::make_shared<kagome::Watchdog>(std::chrono::seconds(1)),
+              std::make_shared<api::RpcContext>()));
+      service->prepare();
+      processor->service = service;
+      this->service = service;
+
+      for (size_t id = 0; id < sessions_count; ++id) {
+        auto session = std::make_shared<CountingSession>(id);
+        listener->on_new_session_(session);
+        session->processRequest(kSubscribeNewHeads, session);
+        session->processRequest(kSubscribeStorage, session);
+        sessions.emplace_back(std::move(session));
+      }
+    }
+
+    size_t bytes() const {
+      size_t bytes = 0;
+      for (auto &session : sessions) {
+        bytes += session->bytes;
+      }
+      return bytes;
+    }
+
+    NiceMock<kagome::application::AppStateManagerMock> app_state_manager;
+    std::shared_ptr<SessionsListener> listener =
+        std::make_shared<SessionsListener>();
+    std::shared_ptr<api::JRpcServer> server =
+        std::make_shared<api::JRpcServerImpl>();
+    events::StorageSubscriptionEnginePtr storage_engine =
+        std::make_shared<events::StorageSubscriptionEngine>();
+    events::ChainSubscriptionEnginePtr chain_engine =
+        std::make_shared<events::ChainSubscriptionEngine>();
+    std::shared_ptr<NiceMock<kagome::blockchain::BlockTreeMock>> block_tree =
+        std::make_shared<NiceMock<kagome::blockchain::BlockTreeMock>>();
+    std::shared_ptr<NiceMock<kagome::storage::trie::TrieStorageMock>>
+        trie_storage = std::make_shared<
+            NiceMock<kagome::storage::trie::TrieStorageMock>>();
+    BlockHeader header{.number = 1};
+    std::shared_ptr<api::ApiService> service;
+    std::vector<std::shared_ptr<CountingSession>> sessions;
+  };
+}  // namespace
+
+/**
+ * New head sent to every subscribed session, serialized once.
+ * The argument is the number of sessions.
+ */
+static void newHeadBenchmark(benchmark::State &state) {
+  Subscribers subscribers(state.range(0));
+  auto bytes = subscribers.bytes();
+  BlockHeader header = subscribers.header;
+  for (const auto &_ : state) {
+    ++header.number;
+    subscribers.chain_engine->notify(events::ChainEventType::kNewHeads,
+                                     header);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+  state.SetBytesProcessed(subscribers.bytes() - bytes);
+}
+
+BENCHMARK(newHeadBenchmark)
+    ->Unit(benchmark::TimeUnit::kMicrosecond)
+    ->ArgName("sessions")
+    ->Arg(100)
+    ->Arg(1'000)
+    ->Arg(10'000);
+
+/**
+ * New head serialized for every session, as done before notifications were
+ * shared
+ */
+static void perSessionNewHeadBenchmark(benchmark::State &state) {
+  Subscribers subscribers(state.range(0));
+  BlockHeader header = subscribers.header;
+  for (const auto &_ : state) {
+    ++header.number;
+    for (auto &session : subscribers.sessions) {
+      jsonrpc::Value::Struct response;
+      response["result"] = api::makeValue(header);
+      response["subscription"] = api::makeValue(uint32_t{1});
+      jsonrpc::Request::Parameters params;
+      params.emplace_back(std::move(response));
+      subscribers.server->processJsonData(
+          "chain_newHead", params, [&](const auto &json) {
+            session->respond(std::string{json.value()});
+          });
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(perSessionNewHeadBenchmark)
+    ->Unit(benchmark::TimeUnit::kMicrosecond)
+    ->ArgName("sessions")
+    ->Arg(100)
+    ->Arg(1'000)
+    ->Arg(10'000);
+
+/**
+ * Changes of subscribed keys in a block, sent to every session in one
+ * `state_storage` message
+ */
+static void storageChangesBenchmark(benchmark::State &state) {
+  Subscribers subscribers(state.range(0));
+  kagome::primitives::BlockHash block;
+  size_t messages = 0;
+  for (auto &session : subscribers.sessions) {
+    messages -= session->messages;
+  }
+  for (const auto &_ : state) {
+    ++block[0];
+    for (auto &key : kKeys) {
+      subscribers.storage_engine->notify(key, Buffer(8, block[0]), block);
+    }
+    subscribers.chain_engine->notify(
+        events::ChainEventType::kStorageChangesNotified, block);
+  }
+  for (auto &session : subscribers.sessions) {
+    messages += session->messages;
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+  // one message for all changed keys
+  state.counters["messages_per_session"] = static_cast<double>(messages)
+                                         / state.iterations() / state.range(0);
+}
+
+BENCHMARK(storageChangesBenchmark)
+    ->Unit(benchmark::TimeUnit::kMicrosecond)
+    ->ArgName("sessions")
+    ->Arg(100)
+    ->Arg(1'000)
+    ->Arg(10'000);
+
+BENCHMARK_MAIN();
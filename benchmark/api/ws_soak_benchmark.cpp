@@ -0,0 +1,252 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <fstream>
+#include <thread>
+
+#include <unistd.h>
+
+#include <gmock/gmock.h>
+#include <boost/asio/executor_work_guard.hpp>
+#include <boost/beast/websocket.hpp>
+
+#include "api/jrpc/jrpc_processor.hpp"
+#include "api/jrpc/jrpc_server_impl.hpp"
+#include "api/jrpc/value_converter.hpp"
+#include "api/service/impl/api_service_impl.hpp"
+#include "api/service/impl/rpc_thread_pool.hpp"
+#include "api/transport/impl/ws/ws_listener_impl.hpp"
+#include "mock/core/application/app_configuration_mock.hpp"
+#include "mock/core/application/app_state_manager_mock.hpp"
+#include "mock/core/blockchain/block_tree_mock.hpp"
+#include "mock/core/runtime/core_mock.hpp"
+#include "mock/core/storage/trie/trie_storage_mock.hpp"
+#include "subscription/extrinsic_event_key_repository.hpp"
+#include "testutil/prepare_loggers.hpp"
+#include "utils/watchdog.hpp"
+
+namespace api = kagome::api;
+namespace events = kagome::primitives::events;
+namespace websocket = boost::beast::websocket;
+using kagome::common::Buffer;
+using kagome::primitives::BlockHeader;
+using Policy = api::WsSession::Configuration::SlowConsumerPolicy;
+using testing::_;
+using testing::NiceMock;
+using testing::Return;
+using testing::ReturnRef;
+
+namespace {
+  constexpr std::string_view kSubscribeNewHeads =
+      R"({"jsonrpc":"2.0","id":1,"method":"chain_subscribeNewHeads",)"
+      R"("params":[]})";
+
+  // small queue limit, so that policy is applied soon
+  constexpr size_t kMaxQueueSize = 1 << 20;
+
+  /// Resident memory of the process
+  double rssMiB() {
+    std::ifstream statm{"/proc/self/statm"};
+    size_t size = 0;
+    size_t resident = 0;
+    statm >> size >> resident;
+    return static_cast<double>(resident * sysconf(_SC_PAGESIZE)) / (1 << 20);
+  }
+
+  class NewHeadsProcessor : public api::JRpcProcessor {
+   public:
+    explicit NewHeadsProcessor(std::shared_ptr<api::JRpcServer> server)
+        : server_{std::move(server)} {}
+
+    void registerHandlers() override {
+      server_->registerHandler(
+          "chain_subscribeNewHeads", [this](const auto &) {
+            return api::makeValue(service->subscribeNewHeads().value());
+          });
+    }
+
+    std::shared_ptr<api::ApiService> service;
+
+   private:
+    std::shared_ptr<api::JRpcServer> server_;
+  };
+
+  /**
+   * Client, which subscribes to new heads and never reads them.
+   * Its receive window is small, so that messages are queued by node.
+   */
+  struct LaggingClient {
+    LaggingClient(boost::asio::io_context &context,
+                  const boost::asio::ip::tcp::endpoint &endpoint)
+        : stream{context} {
+      auto &socket = stream.next_layer();
+      socket.open(endpoint.protocol());
+      socket.set_option(boost::asio::socket_base::receive_buffer_size(4096));
+      socket.connect(endpoint);
+      stream.handshake(endpoint.address().to_string(), "/");
+      stream.write(boost::asio::buffer(kSubscribeNewHeads));
+      // subscription id
+      boost::beast::flat_buffer buffer;
+      stream.read(buffer);
+    }
+
+    websocket::stream<boost::asio::ip::tcp::socket> stream;
+  };
+
+  /**
+   * RPC service listening on localhost, with lagging clients subscribed to
+   * new heads
+   */
+  struct LocalNode {
+    LocalNode(size_t clients_count, api::WsSession::Configuration config) {
+      testutil::prepareLoggers(soralog::Level::ERROR);
+      endpoint.address(boost::asio::ip::make_address("127.0.0.1"));
+      {
+        // free port, to know where listener is
+        boost::asio::ip::tcp::acceptor acceptor{client_context, endpoint};
+        endpoint = acceptor.local_endpoint();
+      }
+      ON_CALL(app_config, rpcEndpoint()).WillByDefault(ReturnRef(endpoint));
+      ON_CALL(app_config, maxWsConnections())
+          .WillByDefault(Return(clients_count));
+      ON_CALL(*block_tree, bestBlock())
+          .WillByDefault(Return(kagome::primitives::BlockInfo{}));
+      ON_CALL(*block_tree, getBlockHeader(_)).WillByDefault(Return(header));
+
+      listener = std::make_shared<api::WsListenerImpl>(
+          app_state_manager, context, app_config, config);
+      auto processor = std::make_shared<NewHeadsProcessor>(server);
+      auto service = std::make_shared<api::ApiServiceImpl>(
+          app_state_manager,
+          std::vector<std::shared_ptr<api::Listener>>{listener},
+          server,
+          std::vector<std::shared_ptr<api::JRpcProcessor>>{processor},
+          std::make_shared<events::StorageSubscriptionEngine>(),
+          chain_engine,
+          std::make_shared<events::ExtrinsicSubscriptionEngine>(),
+          std::make_shared<kagome::subscription::ExtrinsicEventKeyRepository>(),
+          block_tree,
+          std::make_shared<NiceMock<kagome::storage::trie::TrieStorageMock>>(),
+          std::make_shared<kagome::runtime::CoreMock>(),
+          std::make_shared<api::RpcThreadPool>(
+              std::make_shared<kagome::Watchdog>(std::chrono::seconds(1)),
+              std::make_shared<api::RpcContext>()));
+      service->prepare();
+      processor->service = service;
+      this->service = service;
+      listener->prepare();
+      listener->start();
+      thread = std::thread{[this] { context->run(); }};
+
+      for (size_t i = 0; i < clients_count; ++i) {
+        clients.emplace_back(
+            std::make_unique<LaggingClient>(client_context, endpoint));
+      }
+    }
+
+    ~LocalNode() {
+      clients.clear();
+      listener->stop();
+      work.reset();
+      context->stop();
+      thread.join();
+    }
+
+    NiceMock<kagome::application::AppStateManagerMock> app_state_manager;
+    NiceMock<kagome::application::AppConfigurationMock> app_config;
+    boost::asio::ip::tcp::endpoint endpoint;
+    std::shared_ptr<api::RpcContext> context =
+        std::make_shared<api::RpcContext>();
+    boost::asio::executor_work_guard<api::RpcContext::executor_type> work =
+        boost::asio::make_work_guard(*context);
+    std::thread thread;
+    std::shared_ptr<api::JRpcServer> server =
+        std::make_shared<api::JRpcServerImpl>();
+    events::ChainSubscriptionEnginePtr chain_engine =
+        std::make_shared<events::ChainSubscriptionEngine>();
+    std::shared_ptr<NiceMock<kagome::blockchain::BlockTreeMock>> block_tree =
+        std::make_shared<NiceMock<kagome::blockchain::BlockTreeMock>>();
+    BlockHeader header{.number = 1};
+    std::shared_ptr<api::WsListenerImpl> listener;
+    std::shared_ptr<api::ApiService> service;
+    boost::asio::io_context client_context;
+    std::vector<std::unique_ptr<LaggingClient>> clients;
+  };
+
+  /**
+   * Notifies lagging clients of new heads, reports growth of resident memory
+   * after the first tenth of heads, when queues are expected to fill up
+   */
+  void notifyNewHeads(benchmark::State &state,
+                      api::WsSession::Configuration config) {
+    LocalNode node(state.range(0), config);
+    BlockHeader header = node.header;
+    // make notification big enough to fill queues in reasonable time
+    header.digest.emplace_back(
+        kagome::primitives::PreRuntime{{{}, Buffer(4096, 1)}});
+    const auto warmup = state.max_iterations / 10;
+    benchmark::IterationCount heads = 0;
+    double rss = 0;
+    for (const auto &_ : state) {
+      ++header.number;
+      node.chain_engine->notify(events::ChainEventType::kNewHeads, header);
+      if (++heads == warmup) {
+        state.PauseTiming();
+        // let node write what it can
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        rss = rssMiB();
+        state.ResumeTiming();
+      }
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    state.counters["rss_mib"] = rssMiB();
+    state.counters["rss_growth_mib"] = rssMiB() - rss;
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+  }
+}  // namespace
+
+/**
+ * Lagging clients with bounded queues.
+ * Arguments are number of clients and slow consumer policy.
+ * Memory is expected to stay flat after warmup.
+ */
+static void boundedQueueBenchmark(benchmark::State &state) {
+  notifyNewHeads(state,
+                 {
+                     .max_queue_size = kMaxQueueSize,
+                     .slow_consumer_policy =
+                         static_cast<Policy>(state.range(1)),
+                 });
+}
+
+BENCHMARK(boundedQueueBenchmark)
+    ->Unit(benchmark::TimeUnit::kMillisecond)
+    ->Iterations(10'000)
+    ->ArgNames({"clients", "policy"})
+    ->ArgsProduct({
+        {100, 500},
+        {static_cast<int64_t>(Policy::kDropOldest),
+         static_cast<int64_t>(Policy::kCoalesce),
+         static_cast<int64_t>(Policy::kDisconnect)},
+    });
+
+/**
+ * Same clients with unbounded queues, as before the limit was introduced.
+ * Memory grows with every head.
+ */
+static void unboundedQueueBenchmark(benchmark::State &state) {
+  notifyNewHeads(state, {.max_queue_size = SIZE_MAX});
+}
+
+BENCHMARK(unboundedQueueBenchmark)
+    ->Unit(benchmark::TimeUnit::kMillisecond)
+    ->Iterations(10'000)
+    ->ArgName("clients")
+    ->Arg(100);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,124 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <benchmark/benchmark.h>
+
+#include "common/worker_thread_pool.hpp"
+#include "consensus/grandpa/impl/vote_crypto_provider_impl.hpp"
+#include "consensus/grandpa/voter_set.hpp"
+#include "crypto/ed25519/ed25519_provider_impl.hpp"
+#include "crypto/hasher/hasher_impl.hpp"
+#include "utils/watchdog.hpp"
+
+using namespace kagome;  // NOLINT(google-build-using-namespace)
+using consensus::grandpa::Precommit;
+using consensus::grandpa::SignedMessage;
+using consensus::grandpa::VoteCryptoProviderImpl;
+using consensus::grandpa::VoterSet;
+
+namespace {
+  constexpr size_t kAuthorities = 300;
+  constexpr consensus::grandpa::RoundNumber kRound = 42;
+
+  /// Precommits of all authorities, as in justification of a block
+  struct Justification {
+    Justification() {
+      for (size_t i = 0; i < kAuthorities; ++i) {
+        common::Hash256 seed_bytes;
+        seed_bytes.fill(0);
+        std::copy_n(reinterpret_cast<const uint8_t *>(&i),  // NOLINT
+                    sizeof(i),
+                    seed_bytes.begin());
+        auto seed =
+            crypto::Ed25519Seed::from(crypto::SecureCleanGuard{seed_bytes})
+                .value();
+        auto keypair = std::make_shared<crypto::Ed25519Keypair>(
+            ed25519->generateKeypair(seed, {}).value());
+        std::ignore = voters->insert(keypair->public_key, 1);
+        keypairs.emplace_back(std::move(keypair));
+      }
+      Precommit precommit{1000, common::Hash256{}};
+      for (auto &keypair : keypairs) {
+        VoteCryptoProviderImpl signer{
+            keypair, ed25519, kRound, voters, nullptr};
+        precommits.emplace_back(signer.signPrecommit(precommit).value());
+      }
+      for (auto &precommit : precommits) {
+        votes.emplace_back(&precommit);
+      }
+    }
+
+    std::shared_ptr<crypto::Ed25519Provider> ed25519 =
+        std::make_shared<crypto::Ed25519ProviderImpl>(
+            std::make_shared<crypto::HasherImpl>());
+    std::shared_ptr<VoterSet> voters = std::make_shared<VoterSet>(7);
+    std::vector<std::shared_ptr<crypto::Ed25519Keypair>> keypairs;
+    std::vector<SignedMessage> precommits;
+    std::vector<const SignedMessage *> votes;
+  };
+
+  Justification &justification() {
+    static Justification justification;
+    return justification;
+  }
+}  // namespace
+
+/**
+ * Verification of a justification with precommits of 300 authorities, one
+ * by one, as done before batches.
+ */
+static void serialJustificationBenchmark(benchmark::State &state) {
+  auto &j = justification();
+  for (const auto &_ : state) {
+    VoteCryptoProviderImpl verifier{nullptr, j.ed25519, kRound, j.voters, {}};
+    for (auto &precommit : j.precommits) {
+      if (not verifier.verifyPrecommit(precommit)) {
+        state.SkipWithError("invalid signature");
+      }
+    }
+  }
+  state.counters["signatures"] = static_cast<double>(kAuthorities);
+}
+
+BENCHMARK(serialJustificationBenchmark)->Unit(benchmark::kMillisecond);
+
+/**
+ * Verification of a justification with precommits of 300 authorities as a
+ * batch, followed by the import of every precommit, which finds it verified.
+ * The argument is the number of worker threads, the calling thread verifies
+ * chunks of the batch too.
+ */
+static void batchJustificationBenchmark(benchmark::State &state) {
+  auto &j = justification();
+  auto threads = static_cast<size_t>(state.range(0));
+  auto watchdog = std::make_shared<Watchdog>(std::chrono::milliseconds(1));
+  common::WorkerThreadPool pool{watchdog, threads};
+  auto handler = pool.handlerStarted();
+  for (const auto &_ : state) {
+    VoteCryptoProviderImpl verifier{
+        nullptr, j.ed25519, kRound, j.voters, handler};
+    if (not verifier.verifyBatch(j.votes)) {
+      state.SkipWithError("invalid signature");
+    }
+    for (auto &precommit : j.precommits) {
+      if (not verifier.verifyPrecommit(precommit)) {
+        state.SkipWithError("invalid signature");
+      }
+    }
+  }
+  watchdog->stop();
+  state.counters["signatures"] = static_cast<double>(kAuthorities);
+}
+
+BENCHMARK(batchJustificationBenchmark)
+    ->Arg(1)
+    ->Arg(2)
+    ->Arg(4)
+    ->Arg(8)
+    ->ArgName("threads")
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
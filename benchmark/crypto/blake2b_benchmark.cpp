@@ -0,0 +1,63 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <benchmark/benchmark.h>
+
+#include "crypto/blake2/blake2b.h"
+
+namespace {
+  // as many values as children of a trie branch or extrinsics of a block
+  constexpr size_t kInputs = 64;
+
+  std::vector<kagome::common::Buffer> makeInputs(size_t size) {
+    std::vector<kagome::common::Buffer> inputs;
+    for (size_t i = 0; i < kInputs; ++i) {
+      inputs.emplace_back(size, static_cast<uint8_t>(i));
+    }
+    return inputs;
+  }
+}  // namespace
+
+/**
+ * Blake2b-256 of independent inputs one by one.
+ * The argument is the size of every input.
+ */
+static void singleBlake2bBenchmark(benchmark::State &state) {
+  auto inputs = makeInputs(state.range(0));
+  for (const auto &_ : state) {
+    for (auto &input : inputs) {
+      benchmark::DoNotOptimize(kagome::crypto::blake2b<32>(input));
+    }
+  }
+  state.SetBytesProcessed(state.iterations() * kInputs * state.range(0));
+}
+
+BENCHMARK(singleBlake2bBenchmark)
+    ->ArgName("size")
+    ->RangeMultiplier(2)
+    ->Range(32, 4 << 10);
+
+/**
+ * Blake2b-256 of the same inputs as a batch, hashed in SIMD lanes
+ */
+static void batchBlake2bBenchmark(benchmark::State &state) {
+  auto inputs = makeInputs(state.range(0));
+  std::vector<kagome::common::BufferView> views(inputs.begin(), inputs.end());
+  std::vector<uint8_t> hashes(32 * kInputs);
+  for (const auto &_ : state) {
+    kagome::crypto::blake2b_batch(
+        hashes.data(), 32, views.data(), views.size());
+    benchmark::DoNotOptimize(hashes.data());
+  }
+  state.SetBytesProcessed(state.iterations() * kInputs * state.range(0));
+}
+
+BENCHMARK(batchBlake2bBenchmark)
+    ->ArgName("size")
+    ->RangeMultiplier(2)
+    ->Range(32, 4 << 10);
+
+BENCHMARK_MAIN();
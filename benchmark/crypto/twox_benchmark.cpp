@@ -0,0 +1,106 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <cstring>
+
+#include <xxhash.h>
+
+#include "common/buffer.hpp"
+#include "crypto/twox/twox.hpp"
+
+using kagome::common::Buffer;
+
+namespace {
+  /**
+   * Twox-128 as computed before, by a separate xxhash64 pass for every seed
+   */
+  kagome::common::Hash128 referenceTwox128(const Buffer &input) {
+    kagome::common::Hash128 hash;
+    for (uint64_t seed = 0; seed < 2; ++seed) {
+      auto part = XXH64(input.data(), input.size(), seed);
+      memcpy(hash.data() + seed * sizeof(part), &part, sizeof(part));
+    }
+    return hash;
+  }
+}  // namespace
+
+/**
+ * Twox-128 by separate xxhash64 passes.
+ * The argument is the size of input.
+ */
+static void referenceTwox128Benchmark(benchmark::State &state) {
+  Buffer input(state.range(0), 0x42);
+  for (const auto &_ : state) {
+    benchmark::DoNotOptimize(referenceTwox128(input));
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(referenceTwox128Benchmark)
+    ->ArgName("size")
+    ->Arg(6)
+    ->Arg(32)
+    ->Arg(128)
+    ->Arg(1 << 10);
+
+/**
+ * Twox-128 of the same input with both seeds in one pass
+ */
+static void twox128Benchmark(benchmark::State &state) {
+  Buffer input(state.range(0), 0x42);
+  for (const auto &_ : state) {
+    benchmark::DoNotOptimize(kagome::crypto::make_twox128(input));
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(twox128Benchmark)
+    ->ArgName("size")
+    ->Arg(6)
+    ->Arg(32)
+    ->Arg(128)
+    ->Arg(1 << 10);
+
+/**
+ * Twox-256 with all four seeds in one pass
+ */
+static void twox256Benchmark(benchmark::State &state) {
+  Buffer input(state.range(0), 0x42);
+  for (const auto &_ : state) {
+    benchmark::DoNotOptimize(kagome::crypto::make_twox256(input));
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(twox256Benchmark)
+    ->ArgName("size")
+    ->Arg(6)
+    ->Arg(32)
+    ->Arg(128)
+    ->Arg(1 << 10);
+
+/**
+ * Twox-128 of storage prefix names, which runtime hashes over and over
+ */
+static void cachedTwox128Benchmark(benchmark::State &state) {
+  std::vector<Buffer> names;
+  for (auto name : {"System", "Account", "Balances", "TotalIssuance"}) {
+    names.emplace_back(Buffer::fromString(name));
+  }
+  kagome::crypto::Twox128Cache cache;
+  for (const auto &_ : state) {
+    for (auto &name : names) {
+      benchmark::DoNotOptimize(cache.get(name));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * names.size());
+}
+
+BENCHMARK(cachedTwox128Benchmark);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,172 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <algorithm>
+#include <random>
+
+#include <benchmark/benchmark.h>
+
+#include "parachain/approval/knowledge.hpp"
+
+namespace approval = kagome::parachain::approval;
+
+namespace {
+  constexpr size_t kValidators = 1000;
+  // assignments per candidate, as needed to approve it in the first tranche
+  constexpr size_t kAssignmentsPerCandidate = 30;
+
+  struct Message {
+    approval::MessageSubject subject;
+    approval::MessageKind kind;
+    size_t source;
+  };
+
+  /**
+   * Assignments and approvals of one relay block in the order of arrival.
+   * Every message arrives from a random peer.
+   */
+  std::vector<Message> makeMessages(size_t candidates, size_t peers) {
+    std::mt19937 random{0};
+    kagome::parachain::Hash block_hash;
+    block_hash.fill(1);
+    std::vector<Message> assignments;
+    for (size_t candidate = 0; candidate < candidates; ++candidate) {
+      for (size_t i = 0; i < kAssignmentsPerCandidate; ++i) {
+        scale::BitVector bits;
+        bits.resize(candidates);
+        bits[candidate] = true;
+        assignments.emplace_back(Message{
+            .subject = {block_hash,
+                        bits,
+                        static_cast<kagome::parachain::ValidatorIndex>(
+                            random() % kValidators)},
+            .kind = approval::MessageKind::Assignment,
+            .source = random() % peers,
+        });
+      }
+    }
+    std::ranges::shuffle(assignments, random);
+    std::vector<Message> messages = assignments;
+    for (auto &assignment : assignments) {
+      messages.emplace_back(Message{
+          .subject = assignment.subject,
+          .kind = approval::MessageKind::Approval,
+          .source = random() % peers,
+      });
+    }
+    return messages;
+  }
+
+  /// Knowledge keyed by subjects, as kept before subjects were interned
+  struct SubjectKnowledge {
+    std::unordered_map<approval::MessageSubject,
+                       approval::MessageKind,
+                       approval::MessageSubjectHash>
+        known_messages;
+
+    bool contains(const approval::MessageSubject &subject,
+                  approval::MessageKind kind) const {
+      auto it = known_messages.find(subject);
+      return it != known_messages.end()
+         and (kind == approval::MessageKind::Assignment
+              or it->second == approval::MessageKind::Approval);
+    }
+
+    void insert(const approval::MessageSubject &subject,
+                approval::MessageKind kind) {
+      auto [it, inserted] = known_messages.emplace(subject, kind);
+      if (not inserted and kind == approval::MessageKind::Approval) {
+        it->second = kind;
+      }
+    }
+  };
+}  // namespace
+
+/**
+ * Import and circulation of all assignments and approvals of a relay block
+ * with 1000 validators, as done by approval distribution.
+ * For every message the knowledge of its source peer and of the node is
+ * updated, and the message is sent to every peer which doesn't know it yet.
+ * Arguments are the number of candidates in the block and the number of
+ * peers.
+ */
+static void internedKnowledgeBenchmark(benchmark::State &state) {
+  auto candidates = static_cast<size_t>(state.range(0));
+  auto peers = static_cast<size_t>(state.range(1));
+  auto messages = makeMessages(candidates, peers);
+
+  size_t bytes = 0;
+  for (const auto &_ : state) {
+    approval::MessageSubjects subjects;
+    approval::Knowledge knowledge;
+    std::vector<approval::PeerKnowledge> known_by(peers);
+    for (auto &message : messages) {
+      auto subject = subjects.intern(message.subject);
+      auto &source = known_by[message.source];
+      if (source.contains(subject, message.kind)) {
+        continue;
+      }
+      source.received.insert(subject, message.kind);
+      knowledge.insert(subject, message.kind);
+      for (auto &peer : known_by) {
+        if (not peer.contains(subject, message.kind)) {
+          peer.sent.insert(subject, message.kind);
+        }
+      }
+    }
+    bytes = 0;
+    for (auto &peer : known_by) {
+      bytes += (peer.sent.bits.size() + peer.received.bits.size())
+             * sizeof(uint64_t);
+    }
+    benchmark::DoNotOptimize(knowledge);
+  }
+  state.counters["peer_knowledge_bytes"] = static_cast<double>(bytes);
+  state.counters["messages"] = static_cast<double>(messages.size());
+}
+
+BENCHMARK(internedKnowledgeBenchmark)
+    ->ArgsProduct({{100, 300}, {25, 100}})
+    ->ArgNames({"candidates", "peers"})
+    ->Unit(benchmark::kMillisecond);
+
+/**
+ * Same message flow with knowledge keyed by subjects, for comparison
+ */
+static void subjectKnowledgeBenchmark(benchmark::State &state) {
+  auto candidates = static_cast<size_t>(state.range(0));
+  auto peers = static_cast<size_t>(state.range(1));
+  auto messages = makeMessages(candidates, peers);
+
+  for (const auto &_ : state) {
+    SubjectKnowledge knowledge;
+    std::vector<std::pair<SubjectKnowledge, SubjectKnowledge>> known_by(peers);
+    for (auto &message : messages) {
+      auto &[source_sent, source_received] = known_by[message.source];
+      if (source_sent.contains(message.subject, message.kind)
+          or source_received.contains(message.subject, message.kind)) {
+        continue;
+      }
+      source_received.insert(message.subject, message.kind);
+      knowledge.insert(message.subject, message.kind);
+      for (auto &[sent, received] : known_by) {
+        if (not sent.contains(message.subject, message.kind)
+            and not received.contains(message.subject, message.kind)) {
+          sent.insert(message.subject, message.kind);
+        }
+      }
+    }
+    benchmark::DoNotOptimize(knowledge);
+  }
+  state.counters["messages"] = static_cast<double>(messages.size());
+}
+
+BENCHMARK(subjectKnowledgeBenchmark)
+    ->ArgsProduct({{100, 300}, {25, 100}})
+    ->ArgNames({"candidates", "peers"})
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,72 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <benchmark/benchmark.h>
+
+#include "common/worker_thread_pool.hpp"
+#include "parachain/availability/chunks.hpp"
+#include "parachain/availability/erasure_coder.hpp"
+#include "testutil/prepare_loggers.hpp"
+
+namespace parachain = kagome::parachain;
+
+namespace {
+  kagome::runtime::AvailableData makeData(size_t pov_size) {
+    kagome::runtime::AvailableData data;
+    data.pov.payload.resize(pov_size);
+    for (size_t i = 0; i < pov_size; ++i) {
+      data.pov.payload[i] = i * 7 + i / 251;
+    }
+    return data;
+  }
+}  // namespace
+
+/**
+ * Erasure coding of available data with chunk proofs, as done on the backing
+ * path.
+ * Arguments are the PoV size in KiB, the number of validators and the number
+ * of coding threads.
+ */
+static void encodeBenchmark(benchmark::State &state) {
+  auto data = makeData(state.range(0) * 1024);
+  auto validators = static_cast<size_t>(state.range(1));
+  testutil::prepareLoggers(soralog::Level::ERROR);
+  auto threads = static_cast<size_t>(state.range(2));
+  auto watchdog = std::make_shared<kagome::Watchdog>(std::chrono::seconds(1));
+  auto coder = std::make_shared<parachain::ErasureCoder>(
+      std::make_shared<kagome::common::WorkerThreadPool>(watchdog, threads),
+      threads);
+
+  for (const auto &_ : state) {
+    benchmark::DoNotOptimize(coder->encode(validators, data).value());
+  }
+  watchdog->stop();
+}
+
+BENCHMARK(encodeBenchmark)
+    ->ArgsProduct({{256, 1024, 5120}, {300, 1000}, {1, 8}})
+    ->ArgNames({"pov_kib", "validators", "threads"})
+    ->Unit(benchmark::kMillisecond);
+
+/**
+ * Creation of an encoder for a validator count, which is saved on every call
+ * by reusing encoders
+ */
+static void createEncoderBenchmark(benchmark::State &state) {
+  auto validators = static_cast<size_t>(state.range(0));
+  for (const auto &_ : state) {
+    auto encoder = ec_cpp::create(validators);
+    benchmark::DoNotOptimize(encoder);
+  }
+}
+
+BENCHMARK(createEncoderBenchmark)
+    ->Arg(300)
+    ->Arg(1000)
+    ->ArgName("validators")
+    ->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,109 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <fmt/format.h>
+
+#include "common/bytestr.hpp"
+#include "crypto/hasher/hasher_impl.hpp"
+#include "host_api/host_api_factory.hpp"
+#include "mock/core/host_api/host_api_mock.hpp"
+#include "mock/core/storage/trie/trie_storage_mock.hpp"
+#include "runtime/module.hpp"
+#include "runtime/module_instance.hpp"
+#include "runtime/runtime_context.hpp"
+#include "runtime/wabt/util.hpp"
+#include "runtime/wasm_edge/module_factory_impl.hpp"
+#include "testutil/prepare_loggers.hpp"
+
+namespace runtime = kagome::runtime;
+using runtime::kMemoryPageSize;
+using runtime::wasm_edge::ModuleFactoryImpl;
+
+namespace {
+  struct StubHostApiFactory : kagome::host_api::HostApiFactory {
+    std::unique_ptr<kagome::host_api::HostApi> make(
+        std::shared_ptr<const runtime::CoreApiFactory>,
+        std::shared_ptr<const runtime::MemoryProvider>,
+        std::shared_ptr<runtime::TrieStorageProvider>) const override {
+      return std::make_unique<kagome::host_api::HostApiMock>();
+    }
+  };
+
+  /**
+   * Module with data segments of \arg data_pages wasm pages, which is about
+   * the size of static data of a relay chain runtime, and a call that
+   * touches a few pages of it
+   */
+  std::string makeWat(size_t data_pages) {
+    std::string wat = fmt::format(
+        "(module\n"
+        "  (memory (export \"memory\") {})\n"
+        "  (global (export \"__heap_base\") i32 (i32.const {}))\n",
+        data_pages + 32,
+        (data_pages + 1) * kMemoryPageSize);
+    for (size_t page = 0; page < data_pages; ++page) {
+      wat += fmt::format("  (data (i32.const {}) \"", page * kMemoryPageSize);
+      for (size_t i = 0; i < kMemoryPageSize; ++i) {
+        wat += "\\01";
+      }
+      wat += "\")\n";
+    }
+    wat +=
+        "  (func (export \"test\") (param i32 i32) (result i64)\n"
+        "    (i32.store (i32.const 0) (i32.const 1))\n"
+        "    (i32.store (i32.const 65536) (i32.const 1))\n"
+        "    (i64.const 0)))\n";
+    return wat;
+  }
+}  // namespace
+
+/**
+ * Latency of a small runtime call on a reused instance, including the reset of
+ * its memory, as done for every call by RuntimeContextFactory.
+ * Arguments are the number of wasm pages of data segments and whether the
+ * memory is restored from a snapshot.
+ */
+static void smallCallBenchmark(benchmark::State &state) {
+  testutil::prepareLoggers();
+  auto trie_storage =
+      std::make_shared<kagome::storage::trie::TrieStorageMock>();
+  EXPECT_CALL(*trie_storage, getEphemeralBatchAt(testing::_))
+      .WillRepeatedly([] { return nullptr; });
+  auto data_pages = static_cast<size_t>(state.range(0));
+  auto snapshot = state.range(1) != 0;
+  ModuleFactoryImpl factory{
+      std::make_shared<kagome::crypto::HasherImpl>(),
+      std::make_shared<StubHostApiFactory>(),
+      trie_storage,
+      nullptr,
+      nullptr,
+      ModuleFactoryImpl::Config{ModuleFactoryImpl::ExecType::Compiled,
+                                snapshot},
+  };
+
+  auto wat = makeWat(data_pages);
+  auto code = runtime::watToWasm(kagome::str2byte(std::string_view{wat}));
+  runtime::RuntimeContext::ContextParams params{{}, {}, {}};
+  auto path = fmt::format("memory-snapshot-benchmark-{}", data_pages);
+  factory.compile(path, code, params).value();
+  auto module = factory.loadCompiled(path, params).value();
+  auto instance = module->instantiate().value();
+
+  for (const auto &_ : state) {
+    auto ctx = runtime::RuntimeContextFactory::stateless(instance).value();
+    benchmark::DoNotOptimize(
+        instance->callExportFunction(ctx, "test", {}).value());
+  }
+}
+
+BENCHMARK(smallCallBenchmark)
+    ->ArgsProduct({{1, 16, 64}, {0, 1}})
+    ->ArgNames({"data_pages", "snapshot"})
+    ->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_MAIN();
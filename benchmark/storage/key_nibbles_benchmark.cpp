@@ -0,0 +1,132 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <random>
+
+#include "storage/trie/polkadot_trie/polkadot_trie_factory_impl.hpp"
+#include "testutil/prepare_loggers.hpp"
+
+namespace storage = kagome::storage;
+namespace trie = storage::trie;
+using kagome::common::Buffer;
+
+namespace {
+  std::vector<Buffer> randomKeys(size_t num) {
+    std::mt19937_64 random;
+    std::vector<Buffer> keys(num);
+    for (auto &key : keys) {
+      // typical storage key: 32 bytes of prefix and a hashed map key
+      key.resize(32 + random() % 48);
+      for (auto &byte : key) {
+        byte = random() % 256;
+      }
+    }
+    return keys;
+  }
+
+  std::shared_ptr<trie::PolkadotTrie> createTrie(
+      const std::vector<Buffer> &keys) {
+    auto trie = trie::PolkadotTrieFactoryImpl{}.createEmpty(
+        trie::PolkadotTrie::RetrieveFunctions{});
+    for (auto &key : keys) {
+      trie->put(key, Buffer{key}).value();
+    }
+    return trie;
+  }
+
+  // nibble bytes of all node keys, packed and one nibble per byte
+  void countNodeNibbles(const trie::TrieNode &node,
+                        size_t &packed,
+                        size_t &unpacked) {
+    packed += node.getKeyNibbles().packedSize();
+    unpacked += node.getKeyNibbles().size();
+    if (node.isBranch()) {
+      for (auto &child : node.asBranch().getChildren()) {
+        // the trie is not stored, so there are no dummy nodes
+        if (auto child_node =
+                dynamic_cast<const trie::TrieNode *>(child.get())) {
+          countNodeNibbles(*child_node, packed, unpacked);
+        }
+      }
+    }
+  }
+
+  // one nibble per byte, as KeyNibbles used to be stored
+  Buffer unpackedNibbles(const Buffer &key) {
+    Buffer res(key.size() * 2, 0);
+    for (size_t i = 0; i < key.size(); ++i) {
+      res[2 * i] = key[i] >> 4u;
+      res[2 * i + 1] = key[i] & 0xfu;
+    }
+    return res;
+  }
+}  // namespace
+
+static void trieGetBenchmark(benchmark::State &state) {
+  testutil::prepareLoggers();
+  auto keys = randomKeys(state.range(0));
+  auto trie = createTrie(keys);
+
+  size_t packed = 0;
+  size_t unpacked = 0;
+  countNodeNibbles(*trie->getRoot(), packed, unpacked);
+  state.counters["nibbles_bytes_packed"] = packed;
+  state.counters["nibbles_bytes_unpacked"] = unpacked;
+
+  for (const auto &_ : state) {
+    for (auto &key : keys) {
+      benchmark::DoNotOptimize(trie->get(key).value());
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * keys.size());
+}
+
+static void packedPrefixBenchmark(benchmark::State &state) {
+  auto keys = randomKeys(1000);
+  std::vector<trie::KeyNibbles> nibbles;
+  for (auto &key : keys) {
+    // share the prefix, like keys of a storage map do
+    std::copy_n(keys.front().begin(), 32, key.begin());
+    nibbles.emplace_back(trie::KeyNibbles::fromByteBuffer(key));
+  }
+  for (const auto &_ : state) {
+    for (size_t i = 1; i < nibbles.size(); ++i) {
+      benchmark::DoNotOptimize(
+          nibbles[i].view().commonPrefixLength(nibbles[i - 1]));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * (nibbles.size() - 1));
+}
+
+static void unpackedPrefixBenchmark(benchmark::State &state) {
+  auto keys = randomKeys(1000);
+  std::vector<Buffer> nibbles;
+  for (auto &key : keys) {
+    std::copy_n(keys.front().begin(), 32, key.begin());
+    nibbles.emplace_back(unpackedNibbles(key));
+  }
+  for (const auto &_ : state) {
+    for (size_t i = 1; i < nibbles.size(); ++i) {
+      auto [it, _] = std::ranges::mismatch(nibbles[i], nibbles[i - 1]);
+      benchmark::DoNotOptimize(it);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * (nibbles.size() - 1));
+}
+
+BENCHMARK(trieGetBenchmark)
+    ->Unit(benchmark::TimeUnit::kMillisecond)
+    ->Arg(10000)
+    ->Arg(100000);
+
+BENCHMARK(packedPrefixBenchmark);
+
+BENCHMARK(unpackedPrefixBenchmark);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,104 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <benchmark/benchmark.h>
+
+#include "runtime/common/trie_storage_provider_impl.hpp"
+#include "storage/in_memory/in_memory_spaced_storage.hpp"
+#include "storage/trie/impl/ephemeral_trie_batch_impl.hpp"
+#include "storage/trie/impl/trie_storage_backend_impl.hpp"
+#include "storage/trie/polkadot_trie/polkadot_trie_factory_impl.hpp"
+#include "storage/trie/serialization/polkadot_codec.hpp"
+#include "storage/trie/serialization/trie_serializer_impl.hpp"
+#include "testutil/prepare_loggers.hpp"
+
+namespace storage = kagome::storage;
+namespace trie = storage::trie;
+using kagome::common::Buffer;
+using kagome::runtime::TrieStorageProviderImpl;
+
+namespace {
+  // `System::Events` key
+  const Buffer kEventsKey(32, 0xee);
+  // encoded `EventRecord` of a balance transfer
+  const Buffer kEvent(100, 0x42);
+
+  /**
+   * Executes a block, where every extrinsic deposits an event in its own
+   * storage transaction and one more event after it, as `frame_executive`
+   * does
+   */
+  void executeBlock(benchmark::State &state, bool overlay) {
+    testutil::prepareLoggers();
+    auto factory = std::make_shared<trie::PolkadotTrieFactoryImpl>();
+    auto codec = std::make_shared<trie::PolkadotCodec>();
+    auto serializer = std::make_shared<trie::TrieSerializerImpl>(
+        factory,
+        codec,
+        std::make_shared<trie::TrieStorageBackendImpl>(
+            std::make_shared<storage::InMemorySpacedStorage>()));
+    TrieStorageProviderImpl provider{nullptr, serializer};
+    auto extrinsics = static_cast<size_t>(state.range(0));
+
+    auto append = [&] {
+      auto batch = provider.getCurrentBatch();
+      if (overlay) {
+        batch->append(kEventsKey, kEvent).value();
+      } else {
+        // copies the whole vector, as done before overlay appends
+        batch->TrieBatch::append(kEventsKey, kEvent).value();
+      }
+    };
+
+    for (const auto &_ : state) {
+      provider.setTo(std::make_shared<trie::EphemeralTrieBatchImpl>(
+          codec,
+          factory->createEmpty(trie::PolkadotTrie::RetrieveFunctions{}),
+          serializer,
+          nullptr));
+      for (size_t i = 0; i < extrinsics; ++i) {
+        provider.startTransaction().value();
+        append();
+        provider.commitTransaction().value();
+        append();
+      }
+      auto root = provider.commit(std::nullopt, trie::StateVersion::V1);
+      benchmark::DoNotOptimize(root.value());
+    }
+    state.SetItemsProcessed(state.iterations() * extrinsics * 2);
+  }
+}  // namespace
+
+/**
+ * Block execution with events appended by overlay.
+ * The argument is the number of extrinsics in the block.
+ */
+static void overlayAppendBenchmark(benchmark::State &state) {
+  executeBlock(state, true);
+}
+
+BENCHMARK(overlayAppendBenchmark)
+    ->Unit(benchmark::TimeUnit::kMillisecond)
+    ->ArgName("extrinsics")
+    ->Arg(1'000)
+    ->Arg(5'000)
+    ->Arg(10'000);
+
+/**
+ * Same block with events vector copied on every append, for comparison
+ */
+static void copyAppendBenchmark(benchmark::State &state) {
+  executeBlock(state, false);
+}
+
+BENCHMARK(copyAppendBenchmark)
+    ->Unit(benchmark::TimeUnit::kMillisecond)
+    ->ArgName("extrinsics")
+    ->Arg(1'000)
+    ->Arg(5'000)
+    ->Arg(10'000);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,84 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <random>
+
+#include "common/worker_thread_pool.hpp"
+#include "storage/in_memory/in_memory_spaced_storage.hpp"
+#include "storage/trie/impl/trie_storage_backend_impl.hpp"
+#include "storage/trie/polkadot_trie/polkadot_trie_factory_impl.hpp"
+#include "storage/trie/serialization/polkadot_codec.hpp"
+#include "storage/trie/serialization/trie_serializer_impl.hpp"
+#include "testutil/prepare_loggers.hpp"
+
+namespace storage = kagome::storage;
+namespace trie = storage::trie;
+using kagome::common::Buffer;
+
+namespace {
+  std::shared_ptr<trie::PolkadotTrie> createRandomTrie(
+      trie::PolkadotTrieFactory &factory, size_t values_num) {
+    std::mt19937_64 random;
+    auto trie = factory.createEmpty(trie::PolkadotTrie::RetrieveFunctions{});
+    for (size_t i = 0; i < values_num; ++i) {
+      // a storage map entry: 32 bytes of prefix and a hashed map key
+      Buffer key(64, 0);
+      for (auto &byte : key) {
+        byte = random() % 256;
+      }
+      Buffer value(random() % 80, 0);
+      for (auto &byte : value) {
+        byte = random() % 256;
+      }
+      trie->put(key, std::move(value)).value();
+    }
+    return trie;
+  }
+}  // namespace
+
+/**
+ * Stores a trie where every node is dirty, as after a large migration.
+ * Arguments are the number of keys and the number of encoding threads.
+ */
+static void storeTrieBenchmark(benchmark::State &state) {
+  testutil::prepareLoggers();
+  auto factory = std::make_shared<trie::PolkadotTrieFactoryImpl>();
+  auto trie = createRandomTrie(*factory, state.range(0));
+  auto db = std::make_shared<storage::InMemorySpacedStorage>();
+  auto threads = static_cast<size_t>(state.range(1));
+  auto watchdog =
+      std::make_shared<kagome::Watchdog>(std::chrono::milliseconds(1));
+  auto pool = threads > 1 ? std::make_shared<kagome::common::WorkerThreadPool>(
+                                watchdog, threads)
+                          : nullptr;
+  trie::TrieSerializerImpl serializer{
+      factory,
+      std::make_shared<trie::PolkadotCodec>(),
+      std::make_shared<trie::TrieStorageBackendImpl>(db),
+      nullptr,
+      pool,
+      threads};
+
+  for (const auto &_ : state) {
+    // every node which is not a dummy is encoded and stored again
+    auto [root, batch] =
+        serializer.storeTrie(*trie, trie::StateVersion::V1).value();
+    batch->commit().value();
+    benchmark::DoNotOptimize(root);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+  watchdog->stop();
+}
+
+BENCHMARK(storeTrieBenchmark)
+    ->Unit(benchmark::TimeUnit::kMillisecond)
+    ->ArgNames({"keys", "threads"})
+    ->ArgsProduct({{100'000, 1'000'000}, {1, 2, 4, 8, 16}})
+    ->UseRealTime();
+
+BENCHMARK_MAIN();
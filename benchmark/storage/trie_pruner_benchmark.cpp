@@ -152,6 +152,47 @@ static void pruneStateBenchmark(benchmark::State &state) {
   }
 }
 
+static void pruneChainBenchmark(benchmark::State &state) {
+  TriePrunerBenchmark benchmark;
+  std::mt19937_64 random;
+  size_t pruned = 0;
+
+  for (const auto &_ : state) {
+    state.PauseTiming();
+    auto pruner = benchmark.createPruner();
+    auto trie = createRandomTrie(*benchmark.trie_factory, 10000, 70);
+    std::vector<trie::RootHash> roots;
+    for (size_t i = 0; i < 16; i++) {
+      for (size_t j = 0; j < 100; j++) {
+        storage::Buffer key;
+        key.resize(32);
+        for (auto &byte : key) {
+          byte = random() % 256;
+        }
+        trie->put(key, storage::Buffer(key)).value();
+      }
+      pruner->addNewState(*trie, trie::StateVersion::V1).value();
+      auto [root, batch] =
+          benchmark.serializer->storeTrie(*trie, trie::StateVersion::V1)
+              .value();
+      batch->commit().value();
+      roots.push_back(root);
+    }
+    state.ResumeTiming();
+
+    for (size_t i = 0; i < roots.size(); i++) {
+      pruner
+          ->pruneFinalized(roots[i],
+                           kagome::primitives::BlockInfo{
+                               static_cast<kagome::primitives::BlockNumber>(i),
+                               kagome::primitives::BlockHash{}})
+          .value();
+      pruned++;
+    }
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(pruned));
+}
+
 BENCHMARK(registerStateBenchmark)
     ->Unit(benchmark::TimeUnit::kMillisecond)
     ->Iterations(10);
@@ -160,4 +201,8 @@ BENCHMARK(pruneStateBenchmark)
     ->Unit(benchmark::TimeUnit::kMillisecond)
     ->Iterations(10);
 
+BENCHMARK(pruneChainBenchmark)
+    ->Unit(benchmark::TimeUnit::kMillisecond)
+    ->Iterations(10);
+
 BENCHMARK_MAIN();
@@ -8,6 +8,8 @@
 
 #include <jsonrpc-lean/server.h>
 
+#include "api/jrpc/raw_json.hpp"
+
 namespace kagome::api {
   /**
    * Parses jsonrpc batch request.
@@ -100,7 +102,13 @@ namespace kagome::api {
       auto cb = [&](std::string_view request) {
         request_string = request;
         auto formatted = handler.HandleRequest(request_string);
-        if (formatted->GetSize() == 0) {
+        std::string_view response{formatted->GetData(),
+                                  formatted->GetSize()};
+        auto spliced = RawJson::splice(response);
+        if (spliced) {
+          response = *spliced;
+        }
+        if (response.empty()) {
           return;
         }
         if (batch_.empty()) {
@@ -108,7 +116,7 @@ namespace kagome::api {
         } else {
           batch_.push_back(',');
         }
-        batch_.append(formatted->GetData(), formatted->GetSize());
+        batch_.append(response);
       };
       Parser<decltype(cb) &> parser{.cb = std::move(cb)};
       if (parser.parse(request)) {
@@ -120,6 +128,11 @@ namespace kagome::api {
     }
     request_string = request;
     formatted_ = handler.HandleRequest(request_string);
+    if (auto spliced = RawJson::splice(
+            {formatted_->GetData(), formatted_->GetSize()})) {
+      batch_ = std::move(*spliced);
+      formatted_.reset();
+    }
   }
 
   std::string_view JrpcHandleBatch::response() const {
@@ -36,7 +36,8 @@ namespace kagome::api {
      */
     std::shared_ptr<jsonrpc::FormattedData> formatted_;
     /**
-     * Combined batch responses buffer.
+     * Combined batch responses buffer, or single response with raw json
+     * inserted.
      */
     std::string batch_;
   };
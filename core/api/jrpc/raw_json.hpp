@@ -0,0 +1,112 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <charconv>
+#include <optional>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <fmt/format.h>
+#include <jsonrpc-lean/value.h>
+
+namespace kagome::api {
+
+  /**
+   * Method result, which is already formatted as json.
+   * Big results are written to text as they are produced, without building
+   * `jsonrpc::Value` tree, and are inserted into response when it is
+   * formatted.
+   *
+   * jsonrpc-lean has no value type for preformatted json, so method returns
+   * a string placeholder, and json is kept aside on the calling thread.
+   * That relies on `jsonrpc::Server::HandleRequest` calling the method
+   * synchronously, and on `splice` being called for its response on the same
+   * thread before the next request is handled, as `JrpcHandleBatch` does.
+   * Placeholder contains a random nonce, which changes with every response,
+   * so strings from client input can't be mistaken for it.
+   */
+  class RawJson {
+   public:
+    /**
+     * Keeps json until response of current request is formatted on this
+     * thread.
+     * @return placeholder to return from method
+     */
+    static jsonrpc::Value make(std::string json) {
+      auto &pending = Pending::get();
+      pending.jsons.emplace_back(std::move(json));
+      return jsonrpc::Value{std::string{kMarker} + pending.nonce + ":"
+                            + std::to_string(pending.jsons.size() - 1)};
+    }
+
+    /**
+     * Replaces placeholders in formatted response with kept json, forgets
+     * kept json.
+     * @return response with json inserted, none if there was nothing kept
+     */
+    static std::optional<std::string> splice(std::string_view response) {
+      auto &pending = Pending::get();
+      if (pending.jsons.empty()) {
+        return std::nullopt;
+      }
+      auto jsons = std::move(pending.jsons);
+      pending.jsons.clear();
+      const auto marker =
+          std::string{kEscapedMarker} + pending.nonce + ":";
+      pending.nonce = Pending::makeNonce();
+      std::string result;
+      size_t size = response.size();
+      for (auto &json : jsons) {
+        size += json.size();
+      }
+      result.reserve(size);
+      while (not response.empty()) {
+        auto pos = response.find(marker);
+        result.append(response.substr(0, pos));
+        if (pos == std::string_view::npos) {
+          break;
+        }
+        response.remove_prefix(pos);
+        auto digits = response.substr(marker.size());
+        size_t index = 0;
+        auto [end, ec] = std::from_chars(
+            digits.data(), digits.data() + digits.size(), index);
+        if (ec == std::errc{} and index < jsons.size() and end != digits.end()
+            and *end == '"') {
+          result.append(jsons[index]);
+          response.remove_prefix(end + 1 - response.data());
+        } else {
+          result.append(response.substr(0, marker.size()));
+          response.remove_prefix(marker.size());
+        }
+      }
+      return result;
+    }
+
+   private:
+    static constexpr std::string_view kMarker = "\x01raw_json:";
+    static constexpr std::string_view kEscapedMarker = R"("\u0001raw_json:)";
+
+    struct Pending {
+      static Pending &get() {
+        thread_local Pending pending{.nonce = makeNonce(), .jsons = {}};
+        return pending;
+      }
+
+      static std::string makeNonce() {
+        thread_local std::mt19937_64 random{std::random_device{}()};
+        return fmt::format("{:016x}", random());
+      }
+
+      std::string nonce;
+      std::vector<std::string> jsons;
+    };
+  };
+
+}  // namespace kagome::api
@@ -6,6 +6,8 @@
 
 #include "api/service/impl/api_service_impl.hpp"
 
+#include <limits>
+
 #include <boost/algorithm/string/replace.hpp>
 
 #include "api/jrpc/jrpc_processor.hpp"
@@ -95,25 +97,22 @@ namespace {
       }
     });
   }
-  inline void sendEvent(std::shared_ptr<JRpcServer> server,
-                        std::shared_ptr<Session> session,
-                        const kagome::log::Logger &logger,
-                        uint32_t set_id,
-                        std::string_view name,
-                        jsonrpc::Value &&value) {
+  /// Serialized in place of subscription id, which differs for every session
+  constexpr uint32_t kSubscriptionIdPlaceholder =
+      std::numeric_limits<uint32_t>::max();
+
+  inline void sendNotification(std::shared_ptr<Session> session,
+                               uint32_t set_id,
+                               kagome::api::NotificationPtr notification) {
     BOOST_ASSERT(session);
-    forJsonData(server,
-                logger,
-                set_id,
-                name,
-                std::move(value),
-                [session{std::move(session)}](const auto &response) {
-                  // Defer sending JSON-RPC event until subscription id is sent.
-                  // TODO(turuslan): #1474, refactor jrpc notifications
-                  session->post([session, response{std::string{response}}] {
-                    session->respond(response);
-                  });
-                });
+    if (not notification) {
+      return;
+    }
+    // Defer sending JSON-RPC event until subscription id is sent.
+    // TODO(turuslan): #1474, refactor jrpc notifications
+    session->post([session, set_id, notification{std::move(notification)}] {
+      session->notify(notification, set_id);
+    });
   }
 }  // namespace
 
@@ -179,11 +178,6 @@ namespace kagome::api {
           std::pair<common::Buffer, std::optional<common::Buffer>>>
           &key_value_pairs,
       const primitives::BlockHash &block) {
-    /// TODO(iceseer): PRE-475 make event notification depending in packs
-    /// blocks, to batch them in a single message Because of a spec, we can send
-    /// an array of changes in a single message. We can receive here a pack of
-    /// events and format them in a single json message.
-
     jsonrpc::Value::Array changes;
     changes.reserve(key_value_pairs.size());
     for (auto &[key, value] : key_value_pairs) {
@@ -200,7 +194,67 @@ namespace kagome::api {
     return result;
   }
 
+  NotificationPtr ApiServiceImpl::makeNotification(std::string_view name,
+                                                   jsonrpc::Value &&value) {
+    static const auto placeholder = std::to_string(kSubscriptionIdPlaceholder);
+    NotificationPtr notification;
+    forJsonData(server_,
+                logger_,
+                kSubscriptionIdPlaceholder,
+                name,
+                std::move(value),
+                [&](std::string_view json) {
+                  // subscription id is written after result, so the last
+                  // occurrence is the placeholder
+                  auto offset = json.rfind(placeholder);
+                  if (offset == std::string_view::npos) {
+                    SL_ERROR(logger_, "No subscription id in {} event", name);
+                    return;
+                  }
+                  std::string text{json.substr(0, offset)};
+                  text.append(json.substr(offset + placeholder.size()));
+                  notification =
+                      std::make_shared<const Notification>(Notification{
+                          .json = std::move(text),
+                          .id_offset = offset,
+                      });
+                });
+    return notification;
+  }
+
+  template <typename Event>
+  NotificationPtr ApiServiceImpl::makeNotification(
+      LastNotification<Event> &last,
+      std::string_view name,
+      const Event &event) {
+    std::lock_guard lock(last_notifications_cs_);
+    if (last.event != event) {
+      last.event = event;
+      last.notification = makeNotification(name, api::makeValue(event));
+    }
+    return last.notification;
+  }
+
   bool ApiServiceImpl::prepare() {
+    storage_changes_sub_ = std::make_shared<ChainEventSubscriber>(
+        subscription_engines_.chain, nullptr);
+    storage_changes_sub_->setCallback(
+        [wp{weak_from_this()}](SubscriptionSetId,
+                               SessionPtr &,
+                               primitives::events::ChainEventType,
+                               const primitives::events::ChainEventParams
+                                   &params) {
+          auto self = wp.lock();
+          auto block =
+              boost::get<primitives::events::NewRuntimeEventParams>(&params);
+          if (self and block) {
+            self->onStorageChangesNotified(block->get());
+          }
+        });
+    storage_changes_sub_->subscribe(
+        storage_changes_sub_->generateSubscriptionSetId(),
+        primitives::events::ChainEventType::kStorageChangesNotified);
+
     for (const auto &listener : listeners_) {
       auto on_new_session =
           [wp{weak_from_this()}](const sptr<Session> &session) mutable {
@@ -555,6 +609,15 @@ namespace kagome::api {
       }
     }
 
+    {
+      std::lock_guard lock(pending_storage_changes_cs_);
+      for (auto &[block, subscriptions] : pending_storage_changes_) {
+        std::erase_if(subscriptions, [&](const auto &subscription) {
+          return subscription.first.first == id;
+        });
+      }
+    }
+
     removeSessionById(id);
   }
 
@@ -563,12 +626,44 @@ namespace kagome::api {
                                       const Buffer &key,
                                       const std::optional<Buffer> &data,
                                       const common::Hash256 &block) {
-    sendEvent(server_,
-              session,
-              logger_,
-              set_id,
-              kRpcEventSubscribeStorage,
-              createStateStorageEvent({{key, data}}, block));
+    // sent in one message with other changes of block, see
+    // `onStorageChangesNotified`
+    std::lock_guard lock(pending_storage_changes_cs_);
+    auto &pending = pending_storage_changes_[block][{session->id(), set_id}];
+    pending.session = session;
+    pending.changes.emplace_back(key, data);
+  }
+
+  void ApiServiceImpl::onStorageChangesNotified(
+      const primitives::BlockHash &block) {
+    std::map<std::pair<Session::SessionId, SubscriptionSetId>,
+             PendingStorageChanges>
+        pending;
+    {
+      std::lock_guard lock(pending_storage_changes_cs_);
+      auto it = pending_storage_changes_.find(block);
+      if (it == pending_storage_changes_.end()) {
+        return;
+      }
+      pending = std::move(it->second);
+      pending_storage_changes_.erase(it);
+    }
+
+    // subscriptions to the same keys get the same changes
+    std::unordered_map<Buffer, NotificationPtr> notifications;
+    for (auto &[id, subscription] : pending) {
+      Buffer keys;
+      for (auto &[key, value] : subscription.changes) {
+        keys.putUint32(key.size()).put(key);
+      }
+      auto &notification = notifications[keys];
+      if (not notification) {
+        notification = makeNotification(
+            kRpcEventSubscribeStorage,
+            createStateStorageEvent(subscription.changes, block));
+      }
+      sendNotification(subscription.session, id.second, notification);
+    }
   }
 
   void ApiServiceImpl::onChainEvent(
@@ -576,16 +671,33 @@ namespace kagome::api {
       SessionPtr &session,
       primitives::events::ChainEventType event_type,
       const primitives::events::ChainEventParams &event_params) {
+    auto header =
+        boost::get<primitives::events::HeadsEventParams>(&event_params);
+    auto version =
+        boost::get<primitives::events::RuntimeVersionEventParams>(
+            &event_params);
     std::string_view name;
+    NotificationPtr notification;
     switch (event_type) {
       case primitives::events::ChainEventType::kNewHeads: {
         name = kRpcEventNewHeads;
+        if (header) {
+          notification = makeNotification(last_new_head_, name, header->get());
+        }
       } break;
       case primitives::events::ChainEventType::kFinalizedHeads: {
         name = kRpcEventFinalizedHeads;
+        if (header) {
+          notification =
+              makeNotification(last_finalized_head_, name, header->get());
+        }
       } break;
       case primitives::events::ChainEventType::kFinalizedRuntimeVersion: {
         name = kRpcEventRuntimeVersion;
+        if (version) {
+          notification =
+              makeNotification(last_runtime_version_, name, version->get());
+        }
       } break;
       case primitives::events::ChainEventType::kNewRuntime:
         return;
@@ -595,8 +707,10 @@ namespace kagome::api {
     }
 
     BOOST_ASSERT(!name.empty());
-    sendEvent(
-        server_, session, logger_, set_id, name, api::makeValue(event_params));
+    if (not notification) {
+      notification = makeNotification(name, api::makeValue(event_params));
+    }
+    sendNotification(session, set_id, std::move(notification));
   }
 
   void ApiServiceImpl::onExtrinsicEvent(
@@ -604,12 +718,10 @@ namespace kagome::api {
       SessionPtr &session,
       primitives::events::SubscribedExtrinsicId ext_id,
       const primitives::events::ExtrinsicLifecycleEvent &params) {
-    sendEvent(server_,
-              session,
-              logger_,
-              set_id,
-              kRpcEventUpdateExtrinsic,
-              api::makeValue(params));
+    sendNotification(
+        session,
+        set_id,
+        makeNotification(kRpcEventUpdateExtrinsic, api::makeValue(params)));
   }
 
 }  // namespace kagome::api
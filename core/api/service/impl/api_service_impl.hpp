@@ -9,6 +9,7 @@
 #include "api/service/api_service.hpp"
 
 #include <functional>
+#include <map>
 #include <mutex>
 #include <type_traits>
 #include <unordered_map>
@@ -19,6 +20,7 @@
 #include "common/buffer.hpp"
 #include "containers/objects_cache.hpp"
 #include "log/logger.hpp"
+#include "primitives/block_header.hpp"
 #include "primitives/block_id.hpp"
 #include "primitives/event_types.hpp"
 #include "subscription/subscription_engine.hpp"
@@ -160,6 +162,20 @@ namespace kagome::api {
         PubsubSubscriptionId subscription_id) override;
 
    private:
+    /// Last notification of chain event, shared by subscribed sessions
+    template <typename Event>
+    struct LastNotification {
+      std::optional<Event> event;
+      NotificationPtr notification;
+    };
+
+    /// Storage changes of block for one subscription, sent all at once
+    struct PendingStorageChanges {
+      SessionPtr session;
+      std::vector<std::pair<common::Buffer, std::optional<common::Buffer>>>
+          changes;
+    };
+
     jsonrpc::Value createStateStorageEvent(
         const std::vector<
             std::pair<common::Buffer, std::optional<common::Buffer>>>
@@ -197,6 +213,21 @@ namespace kagome::api {
         SessionPtr &session,
         primitives::events::SubscribedExtrinsicId id,
         const primitives::events::ExtrinsicLifecycleEvent &params);
+    void onStorageChangesNotified(const primitives::BlockHash &block);
+
+    /**
+     * Serializes notification once for all sessions, leaving a place for
+     * subscription id.
+     * @return nullptr if serialization failed
+     */
+    NotificationPtr makeNotification(std::string_view name,
+                                     jsonrpc::Value &&value);
+
+    /// Returns notification of the last event, if it is the same
+    template <typename Event>
+    NotificationPtr makeNotification(LastNotification<Event> &last,
+                                     std::string_view name,
+                                     const Event &event);
 
     template <typename Func>
     auto withSession(kagome::api::Session::SessionId id, Func &&f) {
@@ -245,5 +276,18 @@ namespace kagome::api {
         extrinsic_event_key_repo_;
 
     std::shared_ptr<RpcThreadPool> rpc_thread_pool_;
+
+    ChainEventSubscriberPtr storage_changes_sub_;
+    std::mutex pending_storage_changes_cs_;
+    std::unordered_map<
+        primitives::BlockHash,
+        std::map<std::pair<Session::SessionId, SubscriptionSetId>,
+                 PendingStorageChanges>>
+        pending_storage_changes_;
+
+    std::mutex last_notifications_cs_;
+    LastNotification<primitives::BlockHeader> last_new_head_;
+    LastNotification<primitives::BlockHeader> last_finalized_head_;
+    LastNotification<primitives::Version> last_runtime_version_;
   };
 }  // namespace kagome::api
@@ -17,6 +17,8 @@
 #include "common/monadic_utils.hpp"
 #include "runtime/executor.hpp"
 #include "storage/trie/on_read.hpp"
+#include "storage/trie/serialization/trie_serializer.hpp"
+#include "storage/trie/trie_keys_tracker.hpp"
 
 OUTCOME_CPP_DEFINE_CATEGORY(kagome::api, StateApiImpl::Error, e) {
   using E = kagome::api::StateApiImpl::Error;
@@ -40,18 +42,21 @@ namespace kagome::api {
 
   StateApiImpl::StateApiImpl(
       std::shared_ptr<const storage::trie::TrieStorage> trie_storage,
+      std::shared_ptr<const storage::trie::TrieSerializer> trie_serializer,
       std::shared_ptr<blockchain::BlockTree> block_tree,
       std::shared_ptr<runtime::Core> runtime_core,
       std::shared_ptr<runtime::Metadata> metadata,
       std::shared_ptr<runtime::Executor> executor,
       LazySPtr<api::ApiService> api_service)
       : storage_{std::move(trie_storage)},
+        trie_serializer_{std::move(trie_serializer)},
         block_tree_{std::move(block_tree)},
         runtime_core_{std::move(runtime_core)},
         api_service_{api_service},
         metadata_{std::move(metadata)},
         executor_{std::move(executor)} {
     BOOST_ASSERT(nullptr != storage_);
+    BOOST_ASSERT(nullptr != trie_serializer_);
     BOOST_ASSERT(nullptr != block_tree_);
     BOOST_ASSERT(nullptr != runtime_core_);
     BOOST_ASSERT(nullptr != metadata_);
@@ -142,6 +147,23 @@ namespace kagome::api {
       std::span<const common::Buffer> keys,
       const primitives::BlockHash &from,
       std::optional<primitives::BlockHash> opt_to) const {
+    std::vector<StorageChangeSet> changes;
+    OUTCOME_TRY(queryStorageLazy(
+        keys,
+        from,
+        opt_to,
+        [&](StorageChangeSet &&change) -> outcome::result<void> {
+          changes.emplace_back(std::move(change));
+          return outcome::success();
+        }));
+    return changes;
+  }
+
+  outcome::result<void> StateApiImpl::queryStorageLazy(
+      std::span<const common::Buffer> keys,
+      const primitives::BlockHash &from,
+      std::optional<primitives::BlockHash> opt_to,
+      const OnStorageChangeSet &on_change_set) const {
     auto to =
         opt_to.has_value() ? opt_to.value() : block_tree_->bestBlock().hash;
     if (keys.size() > static_cast<ssize_t>(kMaxKeySetSize)) {
@@ -159,33 +181,24 @@ namespace kagome::api {
       }
     }
 
-    std::vector<StorageChangeSet> changes;
-    std::map<common::BufferView, std::optional<common::Buffer>> last_values;
-
-    // TODO(Harrm): #2105 optimize it to use a lazy generator instead of
-    // returning the whole vector with block ids
+    // only block hashes are collected (at most kMaxBlockRange of them),
+    // headers and states are visited one block at a time
     OUTCOME_TRY(range, block_tree_->getChainByBlocks(from, to));
+    storage::trie::TrieKeysTracker tracker{trie_serializer_, keys};
     for (auto &block : range) {
       OUTCOME_TRY(header, block_tree_->getBlockHeader(block));
-      OUTCOME_TRY(batch, storage_->getEphemeralBatchAt(header.state_root));
       StorageChangeSet change{.block = block};
-      for (auto &key : keys) {
-        OUTCOME_TRY(opt_get, batch->tryGet(key));
-        auto opt_value = common::map_optional(
-            std::move(opt_get),
-            [](common::BufferOrView &&r) { return std::move(r).intoBuffer(); });
-        auto it = last_values.find(key);
-        if (it == last_values.end() || it->second != opt_value) {
-          change.changes.push_back(
-              StorageChangeSet::Change{.key = key, .data = opt_value});
-        }
-        last_values[key] = std::move(opt_value);
-      }
+      OUTCOME_TRY(tracker.update(
+          header.state_root,
+          [&](size_t i, const std::optional<common::Buffer> &value) {
+            change.changes.push_back(
+                StorageChangeSet::Change{.key = keys[i], .data = value});
+          }));
       if (!change.changes.empty()) {
-        changes.emplace_back(std::move(change));
+        OUTCOME_TRY(on_change_set(std::move(change)));
       }
     }
-    return changes;
+    return outcome::success();
   }
 
   outcome::result<std::vector<StateApiImpl::StorageChangeSet>>
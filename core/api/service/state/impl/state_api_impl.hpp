@@ -18,6 +18,10 @@ namespace kagome::runtime {
   class Executor;
 }
 
+namespace kagome::storage::trie {
+  class TrieSerializer;
+}
+
 namespace kagome::api {
 
   class StateApiImpl final : public StateApi {
@@ -32,6 +36,8 @@ namespace kagome::api {
     static constexpr size_t kMaxKeySetSize = 64;
 
     StateApiImpl(std::shared_ptr<const storage::trie::TrieStorage> trie_storage,
+                 std::shared_ptr<const storage::trie::TrieSerializer>
+                     trie_serializer,
                  std::shared_ptr<blockchain::BlockTree> block_tree,
                  std::shared_ptr<runtime::Core> runtime_core,
                  std::shared_ptr<runtime::Metadata> metadata,
@@ -66,6 +72,12 @@ namespace kagome::api {
         const primitives::BlockHash &from,
         std::optional<primitives::BlockHash> to) const override;
 
+    outcome::result<void> queryStorageLazy(
+        std::span<const common::Buffer> keys,
+        const primitives::BlockHash &from,
+        std::optional<primitives::BlockHash> to,
+        const OnStorageChangeSet &on_change_set) const override;
+
     outcome::result<std::vector<StorageChangeSet>> queryStorageAt(
         std::span<const common::Buffer> keys,
         std::optional<primitives::BlockHash> at) const override;
@@ -93,6 +105,7 @@ namespace kagome::api {
 
    private:
     std::shared_ptr<const storage::trie::TrieStorage> storage_;
+    std::shared_ptr<const storage::trie::TrieSerializer> trie_serializer_;
     std::shared_ptr<blockchain::BlockTree> block_tree_;
     std::shared_ptr<runtime::Core> runtime_core_;
 
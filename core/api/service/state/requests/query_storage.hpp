@@ -11,6 +11,7 @@
 #include <boost/range/adaptor/transformed.hpp>
 #include <boost/range/algorithm_ext/push_back.hpp>
 
+#include "api/jrpc/raw_json.hpp"
 #include "api/jrpc/value_converter.hpp"
 #include "api/service/state/state_api.hpp"
 
@@ -31,12 +32,37 @@ namespace kagome::api {
         std::pair{"changes", makeValue(j_changes)}};
   }
 
+  /**
+   * Appends json of change set to `out`, same as formatted `makeValue`.
+   * Keys and values are hex strings, so they need no escaping.
+   */
+  inline void appendJson(std::string &out,
+                         const StateApi::StorageChangeSet &changes) {
+    out.append(R"({"block":")");
+    out.append(common::hex_lower_0x(changes.block));
+    out.append(R"(","changes":[)");
+    auto first = true;
+    for (auto &change : changes.changes) {
+      out.append(first ? R"([")" : R"(,[")");
+      first = false;
+      out.append(common::hex_lower_0x(change.key));
+      if (change.data) {
+        out.append(R"(",")");
+        out.append(common::hex_lower_0x(*change.data));
+        out.append(R"("])");
+      } else {
+        out.append(R"(",null])");
+      }
+    }
+    out.append("]}");
+  }
+
 }  // namespace kagome::api
 
 namespace kagome::api::state::request {
 
   class QueryStorage final
-      : public details::RequestType<std::vector<StateApi::StorageChangeSet>,
+      : public details::RequestType<jsonrpc::Value,
                                     std::vector<std::string>,
                                     std::string,
                                     std::optional<std::string>> {
@@ -46,8 +72,7 @@ namespace kagome::api::state::request {
       BOOST_ASSERT(api_);
     }
 
-    outcome::result<std::vector<StateApi::StorageChangeSet>> execute()
-        override {
+    outcome::result<jsonrpc::Value> execute() override {
       std::vector<common::Buffer> keys;
       keys.reserve(getParam<0>().size());
       for (auto &str_key : getParam<0>()) {
@@ -62,7 +87,22 @@ namespace kagome::api::state::request {
                     primitives::BlockHash::fromHexWithPrefix(opt_to.value()));
         to = std::move(to_);
       }
-      return api_->queryStorage(keys, from, std::move(to));
+      // change sets are written to json text as they come, so neither change
+      // sets nor `jsonrpc::Value` tree of the whole range are ever held
+      std::string result{"["};
+      OUTCOME_TRY(api_->queryStorageLazy(
+          keys,
+          from,
+          std::move(to),
+          [&](StateApi::StorageChangeSet &&change) -> outcome::result<void> {
+            if (result.size() != 1) {
+              result.push_back(',');
+            }
+            appendJson(result, change);
+            return outcome::success();
+          }));
+      result.push_back(']');
+      return RawJson::make(std::move(result));
     }
 
    private:
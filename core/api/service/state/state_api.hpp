@@ -6,7 +6,9 @@
 
 #pragma once
 
+#include <functional>
 #include <optional>
+#include <span>
 #include <vector>
 
 #include "api/service/api_service.hpp"
@@ -46,6 +48,7 @@ namespace kagome::api {
       struct Change {
         common::Buffer key;
         std::optional<common::Buffer> data;
+        bool operator==(const Change &) const = default;
       };
       std::vector<Change> changes;
     };
@@ -60,6 +63,19 @@ namespace kagome::api {
         const primitives::BlockHash &from,
         std::optional<primitives::BlockHash> to) const = 0;
 
+    using OnStorageChangeSet =
+        std::function<outcome::result<void>(StorageChangeSet &&)>;
+
+    /**
+     * Same as queryStorage, but passes each change set to \arg on_change_set
+     * as soon as its block is processed instead of collecting them
+     */
+    virtual outcome::result<void> queryStorageLazy(
+        std::span<const common::Buffer> keys,
+        const primitives::BlockHash &from,
+        std::optional<primitives::BlockHash> to,
+        const OnStorageChangeSet &on_change_set) const = 0;
+
     virtual outcome::result<std::vector<StorageChangeSet>> queryStorageAt(
         std::span<const common::Buffer> keys,
         std::optional<primitives::BlockHash> at) const = 0;
@@ -12,6 +12,8 @@
 #include <boost/beast/core/bind_handler.hpp>
 #include <boost/config.hpp>
 
+#include "metrics/histogram_timer.hpp"
+
 namespace boost::beast {
   template <class NextLayer, class DynamicBuffer>
   void teardown(role_type role,
@@ -34,6 +36,28 @@ namespace boost::beast {
 namespace kagome::api {
   static constexpr boost::string_view kServerName = "Kagome";
 
+  static const metrics::GaugeHelper metric_queued_bytes{
+      "kagome_rpc_ws_queued_bytes",
+      "Size of messages queued for writing to all WS RPC sessions.",
+  };
+  // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+  static metrics::HistogramHelper metric_session_queue_size{
+      "kagome_rpc_ws_session_queue_bytes",
+      "Size of messages queued for writing to WS RPC session, observed when "
+      "message is queued",
+      metrics::exponentialBuckets(1 << 10, 4, 10),
+  };
+  static const metrics::CounterHelper metric_dropped_notifications{
+      "kagome_rpc_ws_dropped_notifications",
+      "Number of notifications dropped, because WS RPC session didn't read "
+      "them in time.",
+  };
+  static const metrics::CounterHelper metric_evicted_sessions{
+      "kagome_rpc_ws_evicted_sessions",
+      "Number of WS RPC sessions closed, because they didn't read messages in "
+      "time.",
+  };
+
   WsSessionImpl::WsSessionImpl(std::shared_ptr<WsSession> impl,
                                SessionId id,
                                SessionType type,
@@ -51,6 +75,15 @@ namespace kagome::api {
     }
   }
 
+  void WsSessionImpl::notify(NotificationPtr notification,
+                             uint32_t subscription_id) {
+    std::unique_lock lock{mutex_};
+    if (auto impl = impl_) {
+      lock.unlock();
+      impl->notify(std::move(notification), subscription_id);
+    }
+  }
+
   void WsSessionImpl::post(std::function<void()> cb) {
     std::unique_lock lock{mutex_};
     if (auto impl = impl_) {
@@ -75,7 +108,12 @@ namespace kagome::api {
         on_session_{std::move(on_session)},
         allow_unsafe_{allow_unsafe},
         config_{config},
-        stream_{boost::asio::make_strand(context)} {}
+        stream_{boost::asio::make_strand(context)},
+        queue_{config_.max_queue_size, config_.slow_consumer_policy} {}
+
+  WsSession::~WsSession() {
+    metric_queued_bytes->dec(queue_.size());
+  }
 
   void WsSession::start() {
     boost::asio::dispatch(stream_.get_executor(),
@@ -138,7 +176,7 @@ namespace kagome::api {
 
   void WsSession::respond(std::string_view response) {
     SL_DEBUG(logger_, "Responding: {}", response);
-    post([self{shared_from_this()}, response{std::string{response}}] {
+    post([self{shared_from_this()}, response{std::string{response}}]() mutable {
       if (not self->is_ws_) {
         self->sessionClose();
         if (self->http_response_) {
@@ -155,21 +193,69 @@ namespace kagome::api {
         self->httpWrite();
         return;
       }
-      self->pending_responses_.emplace(response);
-      self->asyncWrite();
+      self->enqueue(WsWriteQueue::Message{
+          .text = std::move(response),
+          .notification = nullptr,
+      });
     });
   }
 
-  void WsSession::asyncWrite() {
-    if (writing_in_progress_) {
+  void WsSession::notify(NotificationPtr notification,
+                         uint32_t subscription_id) {
+    post([self{shared_from_this()},
+          notification{std::move(notification)},
+          subscription_id]() mutable {
+      auto id = std::to_string(subscription_id);
+      if (not self->is_ws_) {
+        self->respond(notification->text(id));
+        return;
+      }
+      self->enqueue(WsWriteQueue::Message{
+          .text = std::move(id),
+          .notification = std::move(notification),
+          .subscription_id = subscription_id,
+      });
+    });
+  }
+
+  void WsSession::enqueue(WsWriteQueue::Message message) {
+    if (stopped_) {
       return;
     }
-    if (pending_responses_.empty()) {
+    const auto message_size = message.size();
+    const auto size = queue_.size() + message_size;
+    const auto dropped = queue_.dropped();
+    const auto fits = queue_.push(std::move(message));
+    metric_queued_bytes->inc(message_size);
+    metric_queued_bytes->dec(size - queue_.size());
+    metric_dropped_notifications->inc(queue_.dropped() - dropped);
+    if (not fits) {
+      evict();
+      return;
+    }
+    metric_session_queue_size.observe(queue_.size());
+    asyncWrite();
+  }
+
+  void WsSession::evict() {
+    SL_WARN(logger_,
+            "Closing session of slow client, {} bytes of messages queued",
+            queue_.size());
+    metric_evicted_sessions->inc();
+    // close frame would wait behind queued messages, so connection is
+    // dropped, and pending write completes with error
+    boost::system::error_code ec;
+    socket().close(ec);
+    stop(boost::beast::websocket::close_code::policy_error);
+  }
+
+  void WsSession::asyncWrite() {
+    auto message = queue_.startWrite();
+    if (not message) {
       return;
     }
-    writing_in_progress_ = true;
     stream_.text(true);
-    stream_.async_write(boost::asio::buffer(pending_responses_.front()),
+    stream_.async_write(message->buffers(),
                         boost::beast::bind_front_handler(&WsSession::onWrite,
                                                          shared_from_this()));
   }
@@ -226,13 +312,17 @@ namespace kagome::api {
 
   void WsSession::onWrite(boost::system::error_code ec,
                           std::size_t bytes_transferred) {
+    auto size = queue_.size();
+    queue_.finishWrite();
+    size -= queue_.size();
+    metric_queued_bytes->dec(size);
     if (ec) {
-      reportError(ec, "failed to write message");
+      if (not stopped_) {
+        reportError(ec, "failed to write message");
+      }
       return stop();
     }
-    writing_in_progress_ = false;
-    assert(bytes_transferred == pending_responses_.front().size());
-    pending_responses_.pop();
+    assert(bytes_transferred == size);
     asyncWrite();
   }
 
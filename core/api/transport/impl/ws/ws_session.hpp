@@ -10,7 +10,6 @@
 #include <cstdlib>
 #include <memory>
 #include <mutex>
-#include <queue>
 
 #include <boost/asio/strand.hpp>
 #include <boost/beast/core/buffered_read_stream.hpp>
@@ -19,6 +18,7 @@
 #include <boost/beast/websocket.hpp>
 
 #include "api/allow_unsafe.hpp"
+#include "api/transport/impl/ws/ws_write_queue.hpp"
 #include "api/transport/listener.hpp"
 #include "api/transport/session.hpp"
 #include "log/logger.hpp"
@@ -37,6 +37,9 @@ namespace kagome::api {
 
     void respond(std::string_view response) override;
 
+    void notify(NotificationPtr notification,
+                uint32_t subscription_id) override;
+
     SessionId id() const override {
       return id_;
     }
@@ -69,12 +72,19 @@ namespace kagome::api {
 
    public:
     struct Configuration {
+      using SlowConsumerPolicy = WsWriteQueue::Policy;
+
       static constexpr size_t kDefaultRequestSize = 10000u;
       static constexpr Session::Duration kDefaultTimeout =
           std::chrono::seconds(30);
+      static constexpr size_t kDefaultMaxQueueSize = 16u << 20;
 
       size_t max_request_size{kDefaultRequestSize};
       Session::Duration operation_timeout{kDefaultTimeout};
+      /// bytes of notifications queued behind the message being written,
+      /// before policy is applied
+      size_t max_queue_size{kDefaultMaxQueueSize};
+      SlowConsumerPolicy slow_consumer_policy{SlowConsumerPolicy::kDisconnect};
     };
 
     WsSession(Session::Context &context,
@@ -83,6 +93,8 @@ namespace kagome::api {
               AllowUnsafe allow_unsafe,
               Configuration config);
 
+    ~WsSession();
+
     Session::Socket &socket() {
       return stream_.next_layer().next_layer().socket();
     }
@@ -91,6 +103,8 @@ namespace kagome::api {
 
     void respond(std::string_view response);
 
+    void notify(NotificationPtr notification, uint32_t subscription_id);
+
     void post(std::function<void()> cb);
 
     bool isUnsafeAllowed() const;
@@ -131,6 +145,17 @@ namespace kagome::api {
      */
     void asyncRead();
 
+    /**
+     * @brief queues message for writing, applies slow consumer policy when
+     * queue exceeds limit
+     */
+    void enqueue(WsWriteQueue::Message message);
+
+    /**
+     * @brief drops connection of client, which doesn't read messages
+     */
+    void evict();
+
     /**
      * @brief asynchronously write
      */
@@ -186,9 +211,7 @@ namespace kagome::api {
         http_response_;
     bool is_ws_ = false;
 
-    std::queue<std::string> pending_responses_;
-
-    bool writing_in_progress_ = false;
+    WsWriteQueue queue_;
     std::atomic_bool stopped_ = false;
 
     OnWsSessionCloseHandler on_ws_close_;
@@ -0,0 +1,109 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "api/transport/impl/ws/ws_write_queue.hpp"
+
+#include <unordered_map>
+
+#include <boost/assert.hpp>
+
+namespace kagome::api {
+
+  std::array<boost::asio::const_buffer, 3> WsWriteQueue::Message::buffers()
+      const {
+    if (not notification) {
+      return {boost::asio::buffer(text)};
+    }
+    return {boost::asio::buffer(notification->prefix()),
+            boost::asio::buffer(text),
+            boost::asio::buffer(notification->suffix())};
+  }
+
+  size_t WsWriteQueue::Message::size() const {
+    return notification ? notification->json.size() + text.size()
+                        : text.size();
+  }
+
+  WsWriteQueue::WsWriteQueue(size_t max_size, Policy policy)
+      : max_size_{max_size}, policy_{policy} {}
+
+  bool WsWriteQueue::push(Message message) {
+    size_ += message.size();
+    if (message.notification) {
+      ++notifications_;
+      notifications_size_ += message.size();
+    }
+    messages_.emplace_back(std::move(message));
+    if (overflow()) {
+      shrink();
+    }
+    return not overflow();
+  }
+
+  const WsWriteQueue::Message *WsWriteQueue::startWrite() {
+    if (writing_ or messages_.empty()) {
+      return nullptr;
+    }
+    writing_ = true;
+    auto &message = messages_.front();
+    if (message.notification) {
+      --notifications_;
+      notifications_size_ -= message.size();
+    }
+    return &message;
+  }
+
+  void WsWriteQueue::finishWrite() {
+    BOOST_ASSERT(writing_);
+    writing_ = false;
+    size_ -= messages_.front().size();
+    messages_.pop_front();
+  }
+
+  bool WsWriteQueue::overflow() const {
+    return notifications_ > 1 and notifications_size_ > max_size_;
+  }
+
+  void WsWriteQueue::shrink() {
+    // message being written must stay alive until write completes
+    auto begin = messages_.begin() + (writing_ ? 1 : 0);
+    std::unordered_map<uint32_t, size_t> latest;
+    if (policy_ == Policy::kCoalesce) {
+      for (auto it = begin; it != messages_.end(); ++it) {
+        if (it->notification) {
+          latest[it->subscription_id] = static_cast<size_t>(it - begin);
+        }
+      }
+    }
+    auto stale = [&](const Message &message, size_t index) {
+      switch (policy_) {
+        case Policy::kDropOldest:
+          return overflow();
+        case Policy::kCoalesce:
+          return latest.at(message.subscription_id) != index;
+        case Policy::kDisconnect:
+          return false;
+      }
+      return false;
+    };
+    auto kept = begin;
+    for (auto it = begin; it != messages_.end(); ++it) {
+      if (it->notification and stale(*it, static_cast<size_t>(it - begin))) {
+        size_ -= it->size();
+        --notifications_;
+        notifications_size_ -= it->size();
+        ++dropped_;
+        continue;
+      }
+      if (kept != it) {
+        *kept = std::move(*it);
+      }
+      ++kept;
+    }
+    messages_.erase(kept, messages_.end());
+  }
+
+}  // namespace kagome::api
@@ -0,0 +1,92 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <deque>
+
+#include <boost/asio/buffer.hpp>
+
+#include "api/transport/notification.hpp"
+#include "application/app_configuration.hpp"
+
+namespace kagome::api {
+
+  /**
+   * Messages of WS session waiting to be written.
+   * Only notifications queued behind the message being written count toward
+   * the limit, and only they are dropped by slow consumer policy. Responses
+   * to requests are never dropped, client waits for them.
+   */
+  class WsWriteQueue {
+   public:
+    using Policy = application::AppConfiguration::WsSlowConsumerPolicy;
+
+    /**
+     * Notification is shared with other sessions and is written around
+     * subscription id, which is kept in `text`.
+     */
+    struct Message {
+      std::string text;
+      NotificationPtr notification;
+      uint32_t subscription_id = 0;
+
+      std::array<boost::asio::const_buffer, 3> buffers() const;
+      size_t size() const;
+    };
+
+    WsWriteQueue(size_t max_size, Policy policy);
+
+    /**
+     * Queues \arg message, applies policy when queued notifications exceed
+     * the limit. A single queued notification is admitted regardless of its
+     * size.
+     * @return false if notifications still exceed the limit, so session
+     * should be evicted
+     */
+    bool push(Message message);
+
+    /**
+     * Starts writing the first message.
+     * @return nullptr if queue is empty or the message is being written
+     */
+    const Message *startWrite();
+
+    /// Removes the written message
+    void finishWrite();
+
+    bool empty() const {
+      return messages_.empty();
+    }
+
+    /// Size of all queued messages
+    size_t size() const {
+      return size_;
+    }
+
+    /// Number of notifications dropped since queue was created
+    size_t dropped() const {
+      return dropped_;
+    }
+
+   private:
+    bool overflow() const;
+    void shrink();
+
+    size_t max_size_;
+    Policy policy_;
+    std::deque<Message> messages_;
+    bool writing_ = false;
+    size_t size_ = 0;
+    /// Notifications behind the message being written
+    size_t notifications_ = 0;
+    size_t notifications_size_ = 0;
+    size_t dropped_ = 0;
+  };
+
+}  // namespace kagome::api
@@ -0,0 +1,43 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <string_view>
+
+namespace kagome::api {
+
+  /**
+   * Subscription notification, serialized once and shared by all sessions
+   * subscribed to the same event.
+   * Sessions differ only by subscription id, which is inserted into `json` at
+   * `id_offset`.
+   */
+  struct Notification {
+    std::string json;
+    size_t id_offset = 0;
+
+    std::string_view prefix() const {
+      return std::string_view{json}.substr(0, id_offset);
+    }
+
+    std::string_view suffix() const {
+      return std::string_view{json}.substr(id_offset);
+    }
+
+    std::string text(std::string_view subscription_id) const {
+      std::string text;
+      text.reserve(json.size() + subscription_id.size());
+      text.append(prefix()).append(subscription_id).append(suffix());
+      return text;
+    }
+  };
+
+  using NotificationPtr = std::shared_ptr<const Notification>;
+
+}  // namespace kagome::api
@@ -175,6 +175,26 @@ namespace kagome::application {
      */
     virtual uint32_t maxWsConnections() const = 0;
 
+    /**
+     * @return maximum size in bytes of messages queued for a WS RPC session
+     */
+    virtual uint32_t wsMaxQueueSize() const = 0;
+
+    /**
+     * What to do when messages queued for a WS RPC session exceed limit,
+     * because client doesn't read them fast enough
+     */
+    enum class WsSlowConsumerPolicy : uint8_t {
+      /// drop oldest notifications
+      kDropOldest,
+      /// keep only latest notification of each subscription
+      kCoalesce,
+      /// close the session
+      kDisconnect,
+    };
+
+    virtual WsSlowConsumerPolicy wsSlowConsumerPolicy() const = 0;
+
     /**
      * @return Kademlia random walk interval
      */
@@ -251,6 +271,12 @@ namespace kagome::application {
      */
     virtual bool purgeWavmCache() const = 0;
 
+    /**
+     * Whether runtime instances copy an image of the initial memory on reset
+     * instead of applying the data segments
+     */
+    virtual bool wasmMemorySnapshot() const = 0;
+
     virtual uint32_t parachainRuntimeInstanceCacheSize() const = 0;
 
     virtual uint32_t parachainPrecompilationThreadNum() const = 0;
@@ -320,6 +346,28 @@ namespace kagome::application {
      */
     virtual uint32_t dbCacheSize() const = 0;
 
+    /**
+     * @return decoded trie node cache size in MiB, 0 disables the cache
+     */
+    virtual uint32_t trieNodeCacheSize() const = 0;
+
+    /**
+     * @return number of recent states which nodes are kept in memory, 0
+     * disables the overlay
+     */
+    virtual uint32_t trieStateOverlaySize() const = 0;
+
+    /**
+     * @return limit of the memory the overlay of recent states can use in MiB
+     */
+    virtual uint32_t trieStateOverlayCapacity() const = 0;
+
+    /**
+     * @return number of worker threads to prefetch state of a block on,
+     * while it executes, 0 disables prefetching
+     */
+    virtual uint32_t statePrefetchThreads() const = 0;
+
     /**
      * Optional phrase to use dev account (e.g. Alice and Bob)
      */
@@ -340,6 +388,12 @@ namespace kagome::application {
 
     virtual uint32_t maxParallelDownloads() const = 0;
 
+    /**
+     * @return max number of peers to fetch partitions of state from in
+     * parallel during fast sync, 1 fetches state sequentially from one peer
+     */
+    virtual uint32_t maxStateSyncPeers() const = 0;
+
     virtual std::optional<BlockNumber> unsafeSyncTo() const = 0;
   };
 
@@ -113,8 +113,13 @@ namespace kagome::application {
     const auto def_wasm_interpreter = "Binaryen";
 #endif
     const uint32_t def_db_cache_size = 1024;
+    const uint32_t def_trie_node_cache_size = 256;
+    const uint32_t def_trie_state_overlay_size = 0;
+    const uint32_t def_trie_state_overlay_capacity = 64;
+    const uint32_t def_state_prefetch_threads = 0;
     const uint32_t def_parachain_runtime_instance_cache_size = 100;
     const uint32_t def_max_parallel_downloads = 5;
+    const uint32_t def_max_state_sync_peers = 4;
 
     /**
      * Generate once at run random node name if form of UUID
@@ -171,6 +176,20 @@ namespace kagome::application {
       return std::nullopt;
     }
 
+    std::optional<AppConfiguration::WsSlowConsumerPolicy>
+    parseWsSlowConsumerPolicy(std::string_view str) {
+      if (str == "drop-oldest") {
+        return AppConfiguration::WsSlowConsumerPolicy::kDropOldest;
+      }
+      if (str == "coalesce") {
+        return AppConfiguration::WsSlowConsumerPolicy::kCoalesce;
+      }
+      if (str == "disconnect") {
+        return AppConfiguration::WsSlowConsumerPolicy::kDisconnect;
+      }
+      return std::nullopt;
+    }
+
     static constexpr std::array<std::string_view, 2> execution_methods{
         "Interpreted", "Compiled"};
 
@@ -313,7 +332,11 @@ namespace kagome::application {
         offchain_worker_mode_{def_offchain_worker_mode},
         enable_offchain_indexing_{def_enable_offchain_indexing},
         recovery_state_{def_block_to_recover},
-        db_cache_size_{def_db_cache_size} {}
+        db_cache_size_{def_db_cache_size},
+        trie_node_cache_size_{def_trie_node_cache_size},
+        trie_state_overlay_size_{def_trie_state_overlay_size},
+        trie_state_overlay_capacity_{def_trie_state_overlay_capacity},
+        state_prefetch_threads_{def_state_prefetch_threads} {}
 
   fs::path AppConfigurationImpl::chainSpecPath() const {
     return chain_spec_path_.native();
@@ -491,6 +514,11 @@ namespace kagome::application {
       }
     }
     load_u32(val, "db-cache", db_cache_size_);
+    load_u32(val, "trie-node-cache", trie_node_cache_size_);
+    load_u32(val, "trie-state-overlay", trie_state_overlay_size_);
+    load_u32(
+        val, "trie-state-overlay-capacity", trie_state_overlay_capacity_);
+    load_u32(val, "state-prefetch-threads", state_prefetch_threads_);
   }
 
   void AppConfigurationImpl::parse_network_segment(
@@ -502,6 +530,19 @@ namespace kagome::application {
     load_str(val, "rpc-host", rpc_host_);
     load_u16(val, "rpc-port", rpc_port_);
     load_u32(val, "ws-max-connections", max_ws_connections_);
+    load_u32(val, "ws-max-queue-size", ws_max_queue_size_);
+    std::string ws_slow_consumer_str;
+    if (load_str(val, "ws-slow-consumer", ws_slow_consumer_str)) {
+      if (auto value = parseWsSlowConsumerPolicy(ws_slow_consumer_str)) {
+        ws_slow_consumer_policy_ = *value;
+      } else {
+        SL_ERROR(logger_,
+                 "Invalid ws-slow-consumer was specified {}, "
+                 "available options are [drop-oldest, coalesce, disconnect]",
+                 ws_slow_consumer_str);
+        exit(EXIT_FAILURE);
+      }
+    }
     load_str(val, "prometheus-host", openmetrics_http_host_);
     load_u16(val, "prometheus-port", openmetrics_http_port_);
     load_str(val, "name", node_name_);
@@ -818,6 +859,10 @@ namespace kagome::application {
         ("tmp", "Use temporary storage path")
         ("database", po::value<std::string>()->default_value("rocksdb"), "Database backend to use [rocksdb]")
         ("db-cache", po::value<uint32_t>()->default_value(def_db_cache_size), "Limit the memory the database cache can use <MiB>")
+        ("trie-node-cache", po::value<uint32_t>()->default_value(def_trie_node_cache_size), "Limit the memory the decoded trie node cache can use, 0 to disable <MiB>")
+        ("trie-state-overlay", po::value<uint32_t>()->default_value(def_trie_state_overlay_size), "Number of recent unfinalized states to keep trie changes of in memory, 0 to disable <blocks>")
+        ("trie-state-overlay-capacity", po::value<uint32_t>()->default_value(def_trie_state_overlay_capacity), "Limit the memory the overlay of recent states can use, the oldest states are dropped above it <MiB>")
+        ("state-prefetch-threads", po::value<uint32_t>()->default_value(def_state_prefetch_threads), "Number of worker threads to load trie nodes, which a block is expected to read, on while it executes, 0 to disable")
         ("enable-offchain-indexing", po::value<bool>(), "enable Offchain Indexing API, which allow block import to write to offchain DB)")
         ("recovery", po::value<std::string>(), "recovers block storage to state after provided block presented by number or hash, and stop after that")
         ("state-pruning", po::value<std::string>()->default_value("archive"), "state pruning policy. 'archive', 'prune-discarded', or the number of finalized blocks to keep.")
@@ -838,6 +883,8 @@ namespace kagome::application {
         ("rpc-host", po::value<std::string>(), "address for RPC over HTTP and Websocket")
         ("rpc-port", po::value<uint16_t>(), "port for RPC over HTTP and Websocket")
         ("ws-max-connections", po::value<uint32_t>(), "maximum number of WS RPC server connections")
+        ("ws-max-queue-size", po::value<uint32_t>(), "maximum size in bytes of notifications queued for WS RPC connection (default 16 MiB)")
+        ("ws-slow-consumer", po::value<std::string>(), R"(action when WS RPC connection queue is full: "disconnect" (default), "drop-oldest" notifications, "coalesce" notifications of subscription)")
         ("prometheus-host", po::value<std::string>(), "address for OpenMetrics over HTTP")
         ("prometheus-port", po::value<uint16_t>(), "port for OpenMetrics over HTTP")
         ("out-peers", po::value<uint32_t>()->default_value(def_out_peers), "number of outgoing connections we're trying to maintain")
@@ -861,6 +908,8 @@ namespace kagome::application {
         ("max-parallel-downloads", po::value<uint32_t>()->default_value(def_max_parallel_downloads),
           "Maximum number of peers from which to ask for the same blocks in parallel."
           "This allows downloading announced blocks from multiple peers. Decrease to save traffic and risk increased latency.")
+        ("state-sync-peers", po::value<uint32_t>()->default_value(def_max_state_sync_peers),
+          "Maximum number of peers from which to fetch parts of state in parallel during fast sync, 1 to fetch state from single peer.")
         ;
 
     po::options_description development_desc("Additional options");
@@ -874,6 +923,7 @@ namespace kagome::application {
         ("wasm-interpreter", po::value<std::string>()->default_value(def_wasm_interpreter),
           fmt::format("choose the desired wasm interpreter ({})", interpreters_str).c_str())
         ("purge-wavm-cache", "purge WAVM runtime cache")
+        ("wasm-memory-snapshot", po::bool_switch(), "Reset runtime instance memory by copying data segments collected once per module (WAVM and WasmEdge)")
         ("parachain-runtime-instance-cache-size",
           po::value<uint32_t>()->default_value(def_parachain_runtime_instance_cache_size),
           "Number of parachain runtime instances to keep cached")
@@ -1102,6 +1152,19 @@ namespace kagome::application {
     }
     find_argument<uint32_t>(
         vm, "db-cache", [&](uint32_t val) { db_cache_size_ = val; });
+    find_argument<uint32_t>(vm, "trie-node-cache", [&](uint32_t val) {
+      trie_node_cache_size_ = val;
+    });
+    find_argument<uint32_t>(vm, "trie-state-overlay", [&](uint32_t val) {
+      trie_state_overlay_size_ = val;
+    });
+    find_argument<uint32_t>(
+        vm, "trie-state-overlay-capacity", [&](uint32_t val) {
+          trie_state_overlay_capacity_ = val;
+        });
+    find_argument<uint32_t>(vm, "state-prefetch-threads", [&](uint32_t val) {
+      state_prefetch_threads_ = val;
+    });
 
     std::vector<std::string> boot_nodes;
     find_argument<std::vector<std::string>>(
@@ -1348,6 +1411,19 @@ namespace kagome::application {
       max_ws_connections_ = val;
     });
 
+    find_argument<uint32_t>(vm, "ws-max-queue-size", [&](uint32_t val) {
+      ws_max_queue_size_ = val;
+    });
+
+    if (auto str = find_argument<std::string>(vm, "ws-slow-consumer")) {
+      if (auto value = parseWsSlowConsumerPolicy(*str)) {
+        ws_slow_consumer_policy_ = *value;
+      } else {
+        SL_ERROR(logger_, "Invalid --ws-slow-consumer: \"{}\"", str);
+        return false;
+      }
+    }
+
     find_argument<uint32_t>(vm, "random-walk-interval", [&](uint32_t val) {
       random_walk_interval_ = val;
     });
@@ -1465,6 +1541,10 @@ namespace kagome::application {
         }
       }
     }
+
+    if (find_argument(vm, "wasm-memory-snapshot")) {
+      wasm_memory_snapshot_ = true;
+    }
     {
       auto r = mkdirs(runtimeCacheDirPath());
       if (not r) {
@@ -1636,6 +1716,11 @@ namespace kagome::application {
         find_argument<uint32_t>(vm, "max-parallel-downloads")
             .value_or(def_max_parallel_downloads);
 
+    max_state_sync_peers_ = std::max<uint32_t>(
+        find_argument<uint32_t>(vm, "state-sync-peers")
+            .value_or(def_max_state_sync_peers),
+        1);
+
     unsafe_sync_to_ = find_argument<BlockNumber>(vm, "unsafe-sync-to");
     if (unsafe_sync_to_) {
       sync_method_ = SyncMethod::Unsafe;
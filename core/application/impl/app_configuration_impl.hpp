@@ -130,6 +130,12 @@ namespace kagome::application {
     uint32_t maxWsConnections() const override {
       return max_ws_connections_;
     }
+    uint32_t wsMaxQueueSize() const override {
+      return ws_max_queue_size_;
+    }
+    WsSlowConsumerPolicy wsSlowConsumerPolicy() const override {
+      return ws_slow_consumer_policy_;
+    }
     std::chrono::seconds getRandomWalkInterval() const override {
       return std::chrono::seconds(random_walk_interval_);
     }
@@ -170,6 +176,9 @@ namespace kagome::application {
     bool purgeWavmCache() const override {
       return purge_wavm_cache_;
     }
+    bool wasmMemorySnapshot() const override {
+      return wasm_memory_snapshot_;
+    }
     uint32_t parachainRuntimeInstanceCacheSize() const override {
       return parachain_runtime_instance_cache_size_;
     }
@@ -199,6 +208,18 @@ namespace kagome::application {
     uint32_t dbCacheSize() const override {
       return db_cache_size_;
     }
+    uint32_t trieNodeCacheSize() const override {
+      return trie_node_cache_size_;
+    }
+    uint32_t trieStateOverlaySize() const override {
+      return trie_state_overlay_size_;
+    }
+    uint32_t trieStateOverlayCapacity() const override {
+      return trie_state_overlay_capacity_;
+    }
+    uint32_t statePrefetchThreads() const override {
+      return state_prefetch_threads_;
+    }
     std::optional<size_t> statePruningDepth() const override {
       return state_pruning_depth_;
     }
@@ -253,6 +274,10 @@ namespace kagome::application {
       return max_parallel_downloads_;
     }
 
+    uint32_t maxStateSyncPeers() const override {
+      return max_state_sync_peers_;
+    }
+
     runtime::OptimizationLevel pvfOptimizationLevel() const override {
       return pvf_optimization_level_;
     }
@@ -372,17 +397,25 @@ namespace kagome::application {
     std::string node_name_;
     std::string node_version_;
     uint32_t max_ws_connections_;
+    uint32_t ws_max_queue_size_ = 16 << 20;
+    WsSlowConsumerPolicy ws_slow_consumer_policy_ =
+        WsSlowConsumerPolicy::kDisconnect;
     uint32_t random_walk_interval_;
     SyncMethod sync_method_;
     RuntimeExecutionMethod runtime_exec_method_;
     RuntimeInterpreter runtime_interpreter_;
     bool purge_wavm_cache_;
+    bool wasm_memory_snapshot_ = false;
     OffchainWorkerMode offchain_worker_mode_;
     bool enable_offchain_indexing_;
     std::optional<Subcommand> subcommand_;
     std::optional<primitives::BlockId> recovery_state_;
     StorageBackend storage_backend_ = StorageBackend::RocksDB;
     uint32_t db_cache_size_;
+    uint32_t trie_node_cache_size_;
+    uint32_t trie_state_overlay_size_;
+    uint32_t trie_state_overlay_capacity_;
+    uint32_t state_prefetch_threads_;
     std::optional<size_t> state_pruning_depth_;
     bool prune_discarded_states_ = false;
     bool enable_thorough_pruning_ = false;
@@ -404,6 +437,7 @@ namespace kagome::application {
     std::optional<PrecompileWasmConfig> precompile_wasm_;
     std::optional<std::string> validator_address_ss58_;
     uint32_t max_parallel_downloads_{};
+    uint32_t max_state_sync_peers_{};
     std::optional<BlockNumber> unsafe_sync_to_;
   };
 
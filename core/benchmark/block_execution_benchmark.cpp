@@ -253,6 +253,7 @@ namespace kagome::benchmark {
           primitives::BlockInfo{block_hashes[i], blocks[i].header.number});
     }
     auto duration_stat_it = duration_stats.begin();
+    std::chrono::nanoseconds total_duration{};
     for (size_t block_i = 0; block_i < blocks.size(); block_i++) {
       OUTCOME_TRY(module_repo_->getInstanceAt(
           primitives::BlockInfo{block_hashes[block_i],
@@ -268,6 +269,7 @@ namespace kagome::benchmark {
         auto duration_ns =
             std::chrono::duration_cast<std::chrono::nanoseconds>(end - start);
         duration_stat_it->add(duration_ns);
+        total_duration += duration_ns;
         SL_VERBOSE(logger_,
                    "Block #{}, {} ns",
                    blocks[block_i].header.number,
@@ -298,6 +300,13 @@ namespace kagome::benchmark {
               * 100.0);
     }
 
+    auto executed = blocks.size() * config.times;
+    fmt::print("Executed {} blocks in {}, {:.2f} blocks per second\n",
+               executed,
+               pretty_duration{total_duration},
+               static_cast<double>(executed)
+                   / std::chrono::duration<double>(total_duration).count());
+
     return outcome::success();
   }
 
@@ -9,9 +9,33 @@
 #include "blockchain/block_storage_error.hpp"
 #include "blockchain/impl/storage_util.hpp"
 #include "common/visitor.hpp"
+#include "metrics/histogram_timer.hpp"
 #include "scale/kagome_scale.hpp"
 
 namespace kagome::blockchain {
+  namespace {
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+    metrics::CounterHelper metric_block_header_cache_hits{
+        "kagome_block_header_cache_hits",
+        "Number of block headers read from the cache of decoded headers",
+    };
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+    metrics::CounterHelper metric_block_header_cache_misses{
+        "kagome_block_header_cache_misses",
+        "Number of block headers read and decoded from the storage",
+    };
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+    metrics::CounterHelper metric_block_hash_cache_hits{
+        "kagome_block_hash_cache_hits",
+        "Number of block hashes by number read from the cache",
+    };
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+    metrics::CounterHelper metric_block_hash_cache_misses{
+        "kagome_block_hash_cache_misses",
+        "Number of block hashes by number read from the storage",
+    };
+  }  // namespace
+
   using primitives::Block;
   using primitives::BlockId;
   using storage::Space;
@@ -143,7 +167,12 @@ namespace kagome::blockchain {
     SL_DEBUG(logger_, "Save num-to-idx for {}", block_info);
     auto num_to_hash_key = blockNumberToKey(block_info.number);
     auto key_space = storage_->getSpace(Space::kLookupKey);
-    return key_space->put(num_to_hash_key, block_info.hash);
+    OUTCOME_TRY(key_space->put(num_to_hash_key, block_info.hash));
+    hashes_.exclusiveAccess([&](auto &hashes) {
+      hashes.lru.put(block_info.number, block_info.hash);
+      ++hashes.version;
+    });
+    return outcome::success();
   }
 
   outcome::result<void> BlockStorageImpl::deassignNumberToHash(
@@ -151,15 +180,40 @@ namespace kagome::blockchain {
     SL_DEBUG(logger_, "Remove num-to-idx for #{}", block_number);
     auto num_to_hash_key = blockNumberToKey(block_number);
     auto key_space = storage_->getSpace(Space::kLookupKey);
-    return key_space->remove(num_to_hash_key);
+    auto res = key_space->remove(num_to_hash_key);
+    hashes_.exclusiveAccess([&](auto &hashes) {
+      hashes.lru.erase(block_number);
+      ++hashes.version;
+    });
+    return res;
   }
 
   outcome::result<std::optional<primitives::BlockHash>>
   BlockStorageImpl::getBlockHash(primitives::BlockNumber block_number) const {
+    size_t version = 0;
+    auto cached = hashes_.sharedAccess(
+        [&](const auto &hashes) -> std::optional<primitives::BlockHash> {
+          if (auto hash = hashes.lru.peek(block_number)) {
+            return hash->get();
+          }
+          version = hashes.version;
+          return std::nullopt;
+        });
+    if (cached) {
+      metric_block_hash_cache_hits->inc();
+      return cached;
+    }
+    metric_block_hash_cache_misses->inc();
     auto key_space = storage_->getSpace(storage::Space::kLookupKey);
     OUTCOME_TRY(data_opt, key_space->tryGet(blockNumberToKey(block_number)));
     if (data_opt.has_value()) {
       OUTCOME_TRY(hash, primitives::BlockHash::fromSpan(data_opt.value()));
+      hashes_.exclusiveAccess([&](auto &hashes) {
+        // record may have changed while it was read
+        if (hashes.version == version) {
+          hashes.lru.put(block_number, hash);
+        }
+      });
       return hash;
     }
     return std::nullopt;
@@ -171,21 +225,19 @@ namespace kagome::blockchain {
         block_id,
         [&](const primitives::BlockNumber &block_number)
             -> outcome::result<std::optional<primitives::BlockHash>> {
-          auto key_space = storage_->getSpace(storage::Space::kLookupKey);
-          OUTCOME_TRY(data_opt,
-                      key_space->tryGet(blockNumberToKey(block_number)));
-          if (data_opt.has_value()) {
-            OUTCOME_TRY(block_hash,
-                        primitives::BlockHash::fromSpan(data_opt.value()));
-            return block_hash;
-          }
-          return std::nullopt;
+          return getBlockHash(block_number);
         },
         [](const common::Hash256 &block_hash) { return block_hash; });
   }
 
   outcome::result<bool> BlockStorageImpl::hasBlockHeader(
       const primitives::BlockHash &block_hash) const {
+    auto cached = headers_.sharedAccess([&](const auto &headers) {
+      return headers.lru.peek(block_hash).has_value();
+    });
+    if (cached) {
+      return true;
+    }
     return hasInSpace(*storage_, Space::kHeader, block_hash);
   }
 
@@ -196,6 +248,10 @@ namespace kagome::blockchain {
     const auto &block_hash = header.hash();
     OUTCOME_TRY(putToSpace(
         *storage_, Space::kHeader, block_hash, std::move(encoded_header)));
+    headers_.exclusiveAccess([&](auto &headers) {
+      headers.lru.put(block_hash, header);
+      ++headers.version;
+    });
     return block_hash;
   }
 
@@ -321,7 +377,7 @@ namespace kagome::blockchain {
   outcome::result<void> BlockStorageImpl::removeBlock(
       const primitives::BlockHash &block_hash) {
     // Check if block still in storage
-    OUTCOME_TRY(header_opt, fetchBlockHeader(block_hash));
+    OUTCOME_TRY(header_opt, loadBlockHeader(block_hash));
     if (not header_opt) {
       return outcome::success();
     }
@@ -346,6 +402,13 @@ namespace kagome::blockchain {
         }
         SL_DEBUG(logger_, "Removed num-to-idx of {}", block_info);
       }
+      hashes_.exclusiveAccess([&](auto &hashes) {
+        if (auto hash = hashes.lru.peek(block_info.number);
+            hash and hash->get() == block_hash) {
+          hashes.lru.erase(block_info.number);
+        }
+        ++hashes.version;
+      });
     }
 
     // TODO(xDimon): needed to clean up trie storage if block deleted
@@ -372,7 +435,12 @@ namespace kagome::blockchain {
 
     {  // Remove block header
       auto header_space = storage_->getSpace(Space::kHeader);
-      if (auto res = header_space->remove(block_info.hash); res.has_error()) {
+      auto res = header_space->remove(block_info.hash);
+      headers_.exclusiveAccess([&](auto &headers) {
+        headers.lru.erase(block_info.hash);
+        ++headers.version;
+      });
+      if (res.has_error()) {
         SL_ERROR(logger_,
                  "could not remove header of block {} from the storage: {}",
                  block_info,
@@ -389,6 +457,35 @@ namespace kagome::blockchain {
   outcome::result<std::optional<primitives::BlockHeader>>
   BlockStorageImpl::fetchBlockHeader(
       const primitives::BlockHash &block_hash) const {
+    size_t version = 0;
+    auto cached = headers_.sharedAccess(
+        [&](const auto &headers) -> std::optional<primitives::BlockHeader> {
+          if (auto header = headers.lru.peek(block_hash)) {
+            return header->get();
+          }
+          version = headers.version;
+          return std::nullopt;
+        });
+    if (cached) {
+      metric_block_header_cache_hits->inc();
+      return cached;
+    }
+    metric_block_header_cache_misses->inc();
+    OUTCOME_TRY(header_opt, loadBlockHeader(block_hash));
+    if (header_opt) {
+      headers_.exclusiveAccess([&](auto &headers) {
+        // header may have been removed while it was read
+        if (headers.version == version) {
+          headers.lru.put(block_hash, *header_opt);
+        }
+      });
+    }
+    return header_opt;
+  }
+
+  outcome::result<std::optional<primitives::BlockHeader>>
+  BlockStorageImpl::loadBlockHeader(
+      const primitives::BlockHash &block_hash) const {
     OUTCOME_TRY(encoded_header_opt,
                 getFromSpace(*storage_, Space::kHeader, block_hash));
     if (encoded_header_opt.has_value()) {
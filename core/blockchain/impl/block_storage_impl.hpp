@@ -12,11 +12,17 @@
 #include "log/logger.hpp"
 #include "storage/predefined_keys.hpp"
 #include "storage/spaced_storage.hpp"
+#include "utils/lru.hpp"
+#include "utils/safe_object.hpp"
 
 namespace kagome::blockchain {
 
   class BlockStorageImpl : public BlockStorage {
    public:
+    /// Number of recent decoded headers and number-to-hash records kept in
+    /// memory
+    static constexpr size_t kCacheSize = 2048;
+
     ~BlockStorageImpl() override = default;
 
     /**
@@ -105,15 +111,40 @@ namespace kagome::blockchain {
     BlockStorageImpl(std::shared_ptr<storage::SpacedStorage> storage,
                      std::shared_ptr<crypto::Hasher> hasher);
 
+    /// Reads header from cache, or from storage caching it
     outcome::result<std::optional<primitives::BlockHeader>> fetchBlockHeader(
         const primitives::BlockHash &block_hash) const;
 
+    outcome::result<std::optional<primitives::BlockHeader>> loadBlockHeader(
+        const primitives::BlockHash &block_hash) const;
+
     std::shared_ptr<storage::SpacedStorage> storage_;
     std::shared_ptr<crypto::Hasher> hasher_;
 
     mutable std::optional<std::vector<primitives::BlockHash>>
         block_tree_leaves_;
 
+    /**
+     * Hits only peek under shared lock, so that concurrent readers don't
+     * serialize on it, and don't promote entries. Eviction is thus in order
+     * of insertion, which suits headers and hashes of recent blocks, read
+     * mostly while they are recent.
+     */
+    template <typename K, typename V>
+    struct Cache {
+      explicit Cache(size_t capacity) : lru{capacity} {}
+
+      Lru<K, V> lru;
+      /// Incremented on each write, so that value read from storage before
+      /// the write is not cached after it
+      size_t version = 0;
+    };
+
+    mutable SafeObject<Cache<primitives::BlockHash, primitives::BlockHeader>>
+        headers_{kCacheSize};
+    mutable SafeObject<Cache<primitives::BlockNumber, primitives::BlockHash>>
+        hashes_{kCacheSize};
+
     log::Logger logger_;
   };
 }  // namespace kagome::blockchain
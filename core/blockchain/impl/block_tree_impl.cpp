@@ -524,8 +524,13 @@ namespace kagome::blockchain {
           notifyChainEventsEngine(primitives::events::ChainEventType::kNewHeads,
                                   block.header);
           SL_DEBUG(log_, "Adding block {}", block_hash);
+          std::vector<common::BufferView> extrinsics;
+          extrinsics.reserve(block.body.size());
           for (const auto &ext : block.body) {
-            auto extrinsic_hash = p.hasher_->blake2b_256(ext.data);
+            extrinsics.emplace_back(ext.data);
+          }
+          for (const auto &extrinsic_hash :
+               p.hasher_->blake2b_256_batch(extrinsics)) {
             SL_DEBUG(log_, "Adding extrinsic with hash {}", extrinsic_hash);
             if (auto key = p.extrinsic_event_key_repo_->get(extrinsic_hash)) {
               main_pool_handler_->execute(
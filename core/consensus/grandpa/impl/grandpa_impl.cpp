@@ -6,6 +6,8 @@
 
 #include "consensus/grandpa/impl/grandpa_impl.hpp"
 
+#include <algorithm>
+#include <thread>
 #include <utility>
 
 #include <libp2p/basic/scheduler/asio_scheduler_backend.hpp>
@@ -16,6 +18,7 @@
 #include "blockchain/block_tree.hpp"
 #include "common/main_thread_pool.hpp"
 #include "common/tagged.hpp"
+#include "common/worker_thread_pool.hpp"
 #include "consensus/grandpa/authority_manager.hpp"
 #include "consensus/grandpa/environment.hpp"
 #include "consensus/grandpa/grandpa_config.hpp"
@@ -34,6 +37,7 @@
 #include "network/reputation_repository.hpp"
 #include "network/synchronizer.hpp"
 #include "storage/predefined_keys.hpp"
+#include "utils/parallel_for.hpp"
 #include "utils/pool_handler.hpp"
 #include "utils/pool_handler_ready_make.hpp"
 #include "utils/retain_if.hpp"
@@ -67,6 +71,15 @@ namespace kagome::consensus::grandpa {
   // https://github.com/paritytech/polkadot/pull/6217
   constexpr std::chrono::milliseconds kGossipDuration{1000};
 
+  /// Smaller batches of votes are verified by one task on the worker pool
+  constexpr size_t kMinVotesPerTask = 16;
+
+  /// Limits the number of gossip votes verified together
+  constexpr size_t kMaxVotesBatch = 1024;
+
+  /// Gossip votes beyond it are dropped
+  constexpr size_t kMaxPendingVotes = 16 * kMaxVotesBatch;
+
   inline auto historicalVotesKey(AuthoritySetId set, RoundNumber round) {
     auto key = storage::kGrandpaHistoricalVotesPrefix;
     key.putUint64(set);
@@ -89,6 +102,7 @@ namespace kagome::consensus::grandpa {
       primitives::events::ChainSubscriptionEnginePtr chain_sub_engine,
       storage::SpacedStorage &db,
       common::MainThreadPool &main_thread_pool,
+      common::WorkerThreadPool &worker_thread_pool,
       GrandpaThreadPool &grandpa_thread_pool)
       : round_time_factor_{kGossipDuration},
         hasher_{std::move(hasher)},
@@ -106,6 +120,7 @@ namespace kagome::consensus::grandpa {
         main_pool_handler_{main_thread_pool.handler(*app_state_manager)},
         grandpa_pool_handler_{poolHandlerReadyMake(
             this, app_state_manager, grandpa_thread_pool, logger_)},
+        worker_pool_handler_{worker_thread_pool.handler(*app_state_manager)},
         scheduler_{std::make_shared<libp2p::basic::SchedulerImpl>(
             std::make_shared<libp2p::basic::AsioSchedulerBackend>(
                 grandpa_thread_pool.io_context()),
@@ -119,6 +134,7 @@ namespace kagome::consensus::grandpa {
     BOOST_ASSERT(reputation_repository_ != nullptr);
     BOOST_ASSERT(main_pool_handler_ != nullptr);
     BOOST_ASSERT(grandpa_pool_handler_ != nullptr);
+    BOOST_ASSERT(worker_pool_handler_ != nullptr);
 
     // Register metrics
     metrics_registry_->registerGaugeFamily(highestGrandpaRoundMetricName,
@@ -175,8 +191,12 @@ namespace kagome::consensus::grandpa {
         .id = keypair ? std::make_optional(keypair->public_key) : std::nullopt,
     };
 
-    auto vote_crypto_provider = std::make_shared<VoteCryptoProviderImpl>(
-        keypair, crypto_provider_, round_state.round_number, config.voters);
+    auto vote_crypto_provider =
+        std::make_shared<VoteCryptoProviderImpl>(keypair,
+                                                 crypto_provider_,
+                                                 round_state.round_number,
+                                                 config.voters,
+                                                 worker_pool_handler_);
 
     auto new_round = std::make_shared<VotingRoundImpl>(
         shared_from_this(),
@@ -232,8 +252,12 @@ namespace kagome::consensus::grandpa {
         .id = keypair ? std::make_optional(keypair->public_key) : std::nullopt,
     };
 
-    auto vote_crypto_provider = std::make_shared<VoteCryptoProviderImpl>(
-        keypair, crypto_provider_, new_round_number, config.voters);
+    auto vote_crypto_provider =
+        std::make_shared<VoteCryptoProviderImpl>(keypair,
+                                                 crypto_provider_,
+                                                 new_round_number,
+                                                 config.voters,
+                                                 worker_pool_handler_);
 
     auto new_round = std::make_shared<VotingRoundImpl>(
         shared_from_this(),
@@ -746,6 +770,50 @@ namespace kagome::consensus::grandpa {
       round->end();
     }
 
+    RoundVotes votes;
+    votes.reserve(msg.prevote_justification.size()
+                  + msg.precommit_justification.size());
+    for (auto &vote : msg.prevote_justification) {
+      votes.emplace_back(round, vote);
+    }
+    for (auto &vote : msg.precommit_justification) {
+      votes.emplace_back(round, vote);
+    }
+    verifyVotes(std::move(votes),
+                [weak{weak_from_this()},
+                 peer_id,
+                 msg{std::move(msg)},
+                 allow_missing_blocks,
+                 round,
+                 new_round]() mutable {
+                  if (auto self = weak.lock()) {
+                    self->applyCatchUpResponse(peer_id,
+                                               std::move(msg),
+                                               allow_missing_blocks,
+                                               std::move(round),
+                                               new_round);
+                  }
+                });
+  }
+
+  void GrandpaImpl::applyCatchUpResponse(const libp2p::peer::PeerId &peer_id,
+                                         network::CatchUpResponse &&msg,
+                                         bool allow_missing_blocks,
+                                         std::shared_ptr<VotingRound> round,
+                                         bool new_round) {
+    BOOST_ASSERT(grandpa_pool_handler_->isInCurrentThread());
+    // Current round might be changed while votes were verified
+    if (msg.voter_set_id != current_round_->voterSetId()
+        or (new_round ? msg.round_number <= current_round_->roundNumber()
+                      : round != current_round_)) {
+      SL_DEBUG(logger_,
+               "Catch-up response (till round #{}) received from {} is "
+               "outdated after verification",
+               msg.round_number,
+               peer_id);
+      return;
+    }
+
     GrandpaContext grandpa_context;
     VotingRoundUpdate update{.round = *round, .ctx = grandpa_context};
     for (auto &vote : msg.prevote_justification) {
@@ -819,14 +887,79 @@ namespace kagome::consensus::grandpa {
              msg,
              allow_missing_blocks);
 
-    if (allow_missing_blocks) {
-      // Skip message processing if same vote was already observed
-      if (votes_cache_.contains(msg)) {
-        return;
+    if (not allow_missing_blocks) {
+      applyVoteMessage(peer_id,
+                       std::move(info),
+                       std::move(msg),
+                       allow_missing_blocks);
+      return;
+    }
+
+    // Skip message processing if same vote was already observed
+    if (votes_cache_.contains(msg)) {
+      return;
+    }
+    if (pending_votes_.size() >= kMaxPendingVotes) {
+      SL_DEBUG(logger_,
+               "Vote signed by {} in round={} received from {} is dropped: "
+               "too many votes are waiting for verification",
+               msg.id(),
+               msg.round_number,
+               peer_id);
+      return;
+    }
+    votes_cache_.put(msg);
+    pending_votes_.emplace_back(PendingVote{
+        .peer_id = peer_id,
+        .info = std::move(info),
+        .msg = std::move(msg),
+    });
+    verifyPendingVotes();
+  }
+
+  void GrandpaImpl::verifyPendingVotes() {
+    if (verifying_votes_ or pending_votes_.empty()) {
+      return;
+    }
+    verifying_votes_ = true;
+    const auto size = std::min(pending_votes_.size(), kMaxVotesBatch);
+    std::vector<PendingVote> batch(
+        std::make_move_iterator(pending_votes_.begin()),
+        std::make_move_iterator(pending_votes_.begin() + ptrdiff_t(size)));
+    pending_votes_.erase(pending_votes_.begin(),
+                         pending_votes_.begin() + ptrdiff_t(size));
+
+    // votes of unknown rounds are rejected when applied
+    RoundVotes votes;
+    votes.reserve(batch.size());
+    for (auto &pending : batch) {
+      if (auto round = selectRound(pending.msg.round_number,
+                                   pending.msg.counter)) {
+        votes.emplace_back(std::move(*round), pending.msg.vote);
       }
-      votes_cache_.put(msg);
     }
+    verifyVotes(std::move(votes),
+                [weak{weak_from_this()}, batch{std::move(batch)}]() mutable {
+                  auto self = weak.lock();
+                  if (not self) {
+                    return;
+                  }
+                  self->verifying_votes_ = false;
+                  for (auto &pending : batch) {
+                    self->applyVoteMessage(pending.peer_id,
+                                           std::move(pending.info),
+                                           std::move(pending.msg),
+                                           true);
+                  }
+                  self->verifyPendingVotes();
+                });
+  }
 
+  void GrandpaImpl::applyVoteMessage(
+      const libp2p::peer::PeerId &peer_id,
+      std::optional<network::PeerStateCompact> &&info,
+      VoteMessage &&msg,
+      bool allow_missing_blocks) {
     if (not info.has_value() or not info->set_id.has_value()
         or not info->round_number.has_value()) {
       SL_DEBUG(
@@ -1160,8 +1293,11 @@ namespace kagome::consensus::grandpa {
                       .round_number = justification.round_number},
         hasher_,
         environment_,
-        std::make_shared<VoteCryptoProviderImpl>(
-            nullptr, crypto_provider_, justification.round_number, voters),
+        std::make_shared<VoteCryptoProviderImpl>(nullptr,
+                                                 crypto_provider_,
+                                                 justification.round_number,
+                                                 voters,
+                                                 worker_pool_handler_),
         std::make_shared<VoteTrackerImpl>(),
         std::make_shared<VoteTrackerImpl>(),
         std::make_shared<VoteGraphImpl>(
@@ -1191,18 +1327,32 @@ namespace kagome::consensus::grandpa {
         and std::pair{authority_set->id, justification.round_number}
                 < std::pair{current_round_->voterSetId(),
                             current_round_->roundNumber()}) {
-      auto res = verifyJustification(justification, *authority_set);
-      if (res.has_error()) {
-        SL_WARN(logger_,
-                "verify justification block {} set {} round {}: {}",
-                justification.block_info.number,
-                authority_set->id,
-                justification.round_number,
-                res.error());
-      } else {
-        res = environment_->finalize(authority_set->id, justification);
-      }
-      callbackCall(std::move(callback), res);
+      // Justifications of past rounds don't touch grandpa state, so they are
+      // verified in parallel on the worker pool, and verified justification
+      // queue puts them in order
+      worker_pool_handler_->execute(
+          [weak{weak_from_this()},
+           justification,
+           authority_set{std::move(authority_set)},
+           callback{std::move(callback)}]() mutable {
+            auto self = weak.lock();
+            if (not self) {
+              return;
+            }
+            auto res = self->verifyJustification(justification, *authority_set);
+            if (res.has_error()) {
+              SL_WARN(self->logger_,
+                      "verify justification block {} set {} round {}: {}",
+                      justification.block_info.number,
+                      authority_set->id,
+                      justification.round_number,
+                      res.error());
+            } else {
+              res = self->environment_->finalize(authority_set->id,
+                                                 justification);
+            }
+            self->callbackCall(std::move(callback), res);
+          });
       return;
     }
     std::shared_ptr<VotingRound> round;
@@ -1464,9 +1614,49 @@ namespace kagome::consensus::grandpa {
     return cache->get();
   }
 
+  void GrandpaImpl::verifyVotes(RoundVotes votes, std::function<void()> cb) {
+    if (votes.empty()) {
+      cb();
+      return;
+    }
+    const auto chunks =
+        std::clamp<size_t>(votes.size() / kMinVotesPerTask,
+                           1,
+                           std::max(1u, std::thread::hardware_concurrency()));
+    auto shared_votes = std::make_shared<RoundVotes>(std::move(votes));
+    // votes are applied even if verification throws, invalid ones are
+    // identified then
+    parallelForAsync(
+        *worker_pool_handler_,
+        chunks,
+        [shared_votes, chunks](size_t chunk) {
+          auto &votes = *shared_votes;
+          auto begin = votes.size() * chunk / chunks;
+          auto end = votes.size() * (chunk + 1) / chunks;
+          // votes of the same round are verified together
+          std::vector<const SignedMessage *> round_votes;
+          for (auto i = begin; i < end; ++i) {
+            round_votes.emplace_back(&votes[i].second);
+            if (i + 1 == end or votes[i + 1].first != votes[i].first) {
+              votes[i].first->verifyVotes(round_votes);
+              round_votes.clear();
+            }
+          }
+        },
+        [grandpa_pool_handler{grandpa_pool_handler_}, cb{std::move(cb)}] {
+          post(*grandpa_pool_handler, cb);
+        });
+  }
+
   void GrandpaImpl::applyHistoricalVotes(VotingRound &round) {
     auto &votes =
         historicalVotes(round.voterSetId(), round.roundNumber()).first;
+    std::vector<const SignedMessage *> seen;
+    for (auto &vote : votes.seen) {
+      seen.emplace_back(&vote);
+    }
+    round.verifyVotes(seen);
+
     VotingRoundUpdate update{.round = round};
     for (auto &vote : votes.seen) {
       update.vote(vote);
@@ -9,6 +9,8 @@
 #include "consensus/grandpa/grandpa.hpp"
 #include "consensus/grandpa/grandpa_observer.hpp"
 
+#include <deque>
+
 #include <libp2p/basic/scheduler.hpp>
 
 #include "consensus/grandpa/historical_votes.hpp"
@@ -36,6 +38,7 @@ namespace kagome::blockchain {
 
 namespace kagome::common {
   class MainThreadPool;
+  class WorkerThreadPool;
 }
 
 namespace kagome::consensus {
@@ -119,6 +122,7 @@ namespace kagome::consensus::grandpa {
         primitives::events::ChainSubscriptionEnginePtr chain_sub_engine,
         storage::SpacedStorage &db,
         common::MainThreadPool &main_thread_pool,
+        common::WorkerThreadPool &worker_thread_pool,
         GrandpaThreadPool &grandpa_thread_pool);
 
     /**
@@ -184,6 +188,16 @@ namespace kagome::consensus::grandpa {
       MissingBlocks blocks;
     };
 
+    /// Vote from gossip, waiting for verification of its signature
+    struct PendingVote {
+      libp2p::peer::PeerId peer_id;
+      std::optional<network::PeerStateCompact> info;
+      network::VoteMessage msg;
+    };
+
+    using RoundVotes =
+        std::vector<std::pair<std::shared_ptr<VotingRound>, SignedMessage>>;
+
     void startCurrentRound();
 
     void callbackCall(ApplyJustificationCb &&callback,
@@ -227,10 +241,28 @@ namespace kagome::consensus::grandpa {
     void onCatchUpResponse(const libp2p::peer::PeerId &peer_id,
                            network::CatchUpResponse &&msg,
                            bool allow_missing_blocks);
+    void applyCatchUpResponse(const libp2p::peer::PeerId &peer_id,
+                              network::CatchUpResponse &&msg,
+                              bool allow_missing_blocks,
+                              std::shared_ptr<VotingRound> round,
+                              bool new_round);
     void onVoteMessage(const libp2p::peer::PeerId &peer_id,
                        std::optional<network::PeerStateCompact> &&info_opt,
                        network::VoteMessage &&msg,
                        bool allow_missing_blocks);
+    void applyVoteMessage(const libp2p::peer::PeerId &peer_id,
+                          std::optional<network::PeerStateCompact> &&info,
+                          network::VoteMessage &&msg,
+                          bool allow_missing_blocks);
+    /**
+     * Verifies signatures of \arg votes on the worker pool, then calls \arg
+     * cb on the grandpa thread. Valid votes are remembered by their rounds,
+     * invalid ones are identified when imported.
+     */
+    void verifyVotes(RoundVotes votes, std::function<void()> cb);
+    /// Verifies the next batch of votes from gossip, unless one is being
+    /// verified already
+    void verifyPendingVotes();
     void onCommitMessage(const libp2p::peer::PeerId &peer_id,
                          network::FullCommitMessage &&msg,
                          bool allow_missing_blocks);
@@ -272,6 +304,7 @@ namespace kagome::consensus::grandpa {
 
     std::shared_ptr<PoolHandler> main_pool_handler_;
     std::shared_ptr<PoolHandlerReady> grandpa_pool_handler_;
+    std::shared_ptr<PoolHandler> worker_pool_handler_;
     std::shared_ptr<libp2p::basic::Scheduler> scheduler_;
 
     std::shared_ptr<VotingRound> current_round_;
@@ -284,6 +317,9 @@ namespace kagome::consensus::grandpa {
 
     std::vector<WaitingBlock> waiting_blocks_;
 
+    std::deque<PendingVote> pending_votes_;
+    bool verifying_votes_ = false;
+
     using HistoricalVotesKey = std::pair<AuthoritySetId, RoundNumber>;
     Lru<HistoricalVotesKey,
         HistoricalVotesDirty,
@@ -6,21 +6,38 @@
 
 #include "consensus/grandpa/impl/vote_crypto_provider_impl.hpp"
 
+#include <algorithm>
+
 #include "consensus/grandpa/voter_set.hpp"
 #include "crypto/ed25519_provider.hpp"
 #include "log/logger.hpp"
+#include "utils/parallel_for.hpp"
+#include "utils/pool_handler.hpp"
 
 namespace kagome::consensus::grandpa {
+  namespace {
+    // smaller batches are verified on the calling thread, as posting them
+    // costs more than their verification
+    constexpr size_t kMinVotesPerChunk = 16;
+  }  // namespace
 
   VoteCryptoProviderImpl::VoteCryptoProviderImpl(
       std::shared_ptr<crypto::Ed25519Keypair> keypair,
       std::shared_ptr<kagome::crypto::Ed25519Provider> ed_provider,
       RoundNumber round_number,
-      std::shared_ptr<VoterSet> voter_set)
+      std::shared_ptr<VoterSet> voter_set,
+      std::shared_ptr<PoolHandler> worker_pool_handler)
       : keypair_{std::move(keypair)},
         ed_provider_{std::move(ed_provider)},
         round_number_{round_number},
-        voter_set_{std::move(voter_set)} {}
+        voter_set_{std::move(voter_set)},
+        worker_pool_handler_{std::move(worker_pool_handler)} {}
+
+  common::Buffer VoteCryptoProviderImpl::payload(const Vote &vote,
+                                                 RoundNumber number) const {
+    return common::Buffer{
+        scale::encode(std::tie(vote, number, voter_set_->id())).value()};
+  }
 
   std::optional<SignedMessage> VoteCryptoProviderImpl::sign(Vote vote) const {
     if (not keypair_) {
@@ -36,10 +53,17 @@ namespace kagome::consensus::grandpa {
 
   bool VoteCryptoProviderImpl::verify(const SignedMessage &vote,
                                       RoundNumber number) const {
-    auto payload =
-        scale::encode(std::tie(vote.message, number, voter_set_->id())).value();
-    auto verifying_result =
-        ed_provider_->verify(vote.signature, payload, vote.id);
+    if (number == round_number_) {
+      auto encoded = common::Buffer{scale::encode(vote).value()};
+      if (verified_.sharedAccess(
+              [&](const std::unordered_set<common::Buffer> &verified) {
+                return verified.contains(encoded);
+              })) {
+        return true;
+      }
+    }
+    auto verifying_result = ed_provider_->verify(
+        vote.signature, payload(vote.message, number), vote.id);
     bool result = verifying_result.has_value() and verifying_result.value();
 #ifndef NDEBUG  // proves really useful for debugging voter set and round number
                 // calculation errors
@@ -69,6 +93,44 @@ namespace kagome::consensus::grandpa {
     return result;
   }
 
+  bool VoteCryptoProviderImpl::verifyBatch(
+      const std::vector<const SignedMessage *> &votes) const {
+    // votes are independent, so instead of a batch equation, which only says
+    // whether all of them are valid, every signature is checked on its own,
+    // and chunks of votes are checked in parallel
+    auto verify_chunk = [&](size_t begin, size_t end) {
+      std::vector<common::Buffer> valid;
+      for (auto i = begin; i < end; ++i) {
+        auto &vote = *votes[i];
+        auto res = ed_provider_->verify(
+            vote.signature, payload(vote.message, round_number_), vote.id);
+        if (res.has_value() and res.value()) {
+          valid.emplace_back(scale::encode(vote).value());
+        }
+      }
+      auto all_valid = valid.size() == end - begin;
+      verified_.exclusiveAccess(
+          [&](std::unordered_set<common::Buffer> &verified) {
+            for (auto &vote : valid) {
+              verified.emplace(std::move(vote));
+            }
+          });
+      return all_valid;
+    };
+
+    size_t chunks = votes.size() / kMinVotesPerChunk;
+    if (not worker_pool_handler_ or chunks < 2) {
+      return verify_chunk(0, votes.size());
+    }
+    std::vector<char> valid(chunks);
+    parallelFor(*worker_pool_handler_, chunks, [&](size_t chunk) {
+      auto begin = votes.size() * chunk / chunks;
+      auto end = votes.size() * (chunk + 1) / chunks;
+      valid[chunk] = verify_chunk(begin, end);
+    });
+    return std::ranges::all_of(valid, [](char ok) { return ok; });
+  }
+
   bool VoteCryptoProviderImpl::verifyPrimaryPropose(
       const SignedMessage &vote) const {
     return vote.is<PrimaryPropose>() and verify(vote, round_number_);
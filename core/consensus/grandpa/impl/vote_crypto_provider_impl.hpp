@@ -8,6 +8,14 @@
 
 #include "consensus/grandpa/vote_crypto_provider.hpp"
 
+#include <unordered_set>
+
+#include "utils/safe_object.hpp"
+
+namespace kagome {
+  class PoolHandler;
+}  // namespace kagome
+
 namespace kagome::consensus::grandpa {
   class VoterSet;
 }
@@ -22,16 +30,25 @@ namespace kagome::consensus::grandpa {
    public:
     ~VoteCryptoProviderImpl() override = default;
 
-    VoteCryptoProviderImpl(std::shared_ptr<crypto::Ed25519Keypair> keypair,
-                           std::shared_ptr<crypto::Ed25519Provider> ed_provider,
-                           RoundNumber round_number,
-                           std::shared_ptr<VoterSet> voter_set);
+    /**
+     * @param worker_pool_handler pool to verify batches of signatures on,
+     * batches are verified on the calling thread if it is null
+     */
+    VoteCryptoProviderImpl(
+        std::shared_ptr<crypto::Ed25519Keypair> keypair,
+        std::shared_ptr<crypto::Ed25519Provider> ed_provider,
+        RoundNumber round_number,
+        std::shared_ptr<VoterSet> voter_set,
+        std::shared_ptr<PoolHandler> worker_pool_handler);
 
     bool verifyPrimaryPropose(
         const SignedMessage &primary_propose) const override;
     bool verifyPrevote(const SignedMessage &prevote) const override;
     bool verifyPrecommit(const SignedMessage &precommit) const override;
 
+    bool verifyBatch(
+        const std::vector<const SignedMessage *> &votes) const override;
+
     std::optional<SignedMessage> signPrimaryPropose(
         const PrimaryPropose &primary_propose) const override;
     std::optional<SignedMessage> signPrevote(
@@ -42,11 +59,15 @@ namespace kagome::consensus::grandpa {
    private:
     std::optional<SignedMessage> sign(Vote vote) const;
     bool verify(const SignedMessage &vote, RoundNumber number) const;
+    common::Buffer payload(const Vote &vote, RoundNumber number) const;
 
     std::shared_ptr<crypto::Ed25519Keypair> keypair_;
     std::shared_ptr<crypto::Ed25519Provider> ed_provider_;
     const RoundNumber round_number_;
     std::shared_ptr<VoterSet> voter_set_;
+    std::shared_ptr<PoolHandler> worker_pool_handler_;
+    /// Encoded votes of this round, verified by `verifyBatch`
+    mutable SafeObject<std::unordered_set<common::Buffer>> verified_;
   };
 
 }  // namespace kagome::consensus::grandpa
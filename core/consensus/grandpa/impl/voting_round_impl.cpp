@@ -149,6 +149,17 @@ namespace kagome::consensus::grandpa {
     last_finalized_block_ = round_state.last_finalized_block;
 
     if (round_number_ != 0) {
+      std::vector<const SignedMessage *> votes;
+      for (auto &vote : round_state.votes) {
+        if (auto e = boost::get<EquivocatorySignedMessage>(&vote)) {
+          votes.emplace_back(&e->first);
+          votes.emplace_back(&e->second);
+        } else {
+          votes.emplace_back(&boost::get<SignedMessage>(vote));
+        }
+      }
+      verifyVotes(votes);
+
       VotingRoundUpdate update{.round = *this};
       for (auto &vote : round_state.votes) {
         update.vote(vote);
@@ -707,6 +718,14 @@ namespace kagome::consensus::grandpa {
     std::unordered_map<Id, BlockInfo> validators;
     std::unordered_set<Id> equivocators;
 
+    // invalid signatures are identified one by one below
+    std::vector<const SignedMessage *> precommits;
+    precommits.reserve(justification.items.size());
+    for (const auto &signed_precommit : justification.items) {
+      precommits.emplace_back(&signed_precommit);
+    }
+    std::ignore = vote_crypto_provider_->verifyBatch(precommits);
+
     for (const auto &signed_precommit : justification.items) {
       // Skip known equivocators
       if (auto index = voter_set_->voterIndex(signed_precommit.id);
@@ -889,6 +908,11 @@ namespace kagome::consensus::grandpa {
     }
   }
 
+  void VotingRoundImpl::verifyVotes(
+      const std::vector<const SignedMessage *> &votes) const {
+    std::ignore = vote_crypto_provider_->verifyBatch(votes);
+  }
+
   bool VotingRoundImpl::onPrevote(OptRef<GrandpaContext> grandpa_context,
                                   const SignedMessage &prevote,
                                   Propagation propagation) {
@@ -151,6 +151,9 @@ namespace kagome::consensus::grandpa {
                      const SignedMessage &precommit,
                      Propagation propagation) override;
 
+    void verifyVotes(
+        const std::vector<const SignedMessage *> &votes) const override;
+
     /**
      * Updates inner state if something (see params) was changed since last call
      * @param is_previous_round_changed is true if previous round is changed
@@ -22,6 +22,15 @@ namespace kagome::consensus::grandpa {
     virtual bool verifyPrevote(const SignedMessage &prevote) const = 0;
     virtual bool verifyPrecommit(const SignedMessage &precommit) const = 0;
 
+    /**
+     * Verifies signatures of \arg votes of any type together. Valid votes are
+     * remembered, so following `verify*` calls for them don't check their
+     * signatures again, and invalid ones are identified by those calls.
+     * @return true if all signatures are valid
+     */
+    virtual bool verifyBatch(
+        const std::vector<const SignedMessage *> &votes) const = 0;
+
     virtual std::optional<SignedMessage> signPrimaryPropose(
         const PrimaryPropose &primary_propose) const = 0;
     virtual std::optional<SignedMessage> signPrevote(
@@ -88,6 +88,13 @@ namespace kagome::consensus::grandpa {
                              const SignedMessage &precommit,
                              Propagation propagation) = 0;
 
+    /**
+     * Verifies signatures of \arg votes together, before they are imported
+     * one by one
+     */
+    virtual void verifyVotes(
+        const std::vector<const SignedMessage *> &votes) const = 0;
+
     using IsPreviousRoundChanged = Tagged<bool, struct IsPreviousRoundChanged>;
     using IsPrevotesChanged = Tagged<bool, struct IsPrevotesChanged>;
     using IsPrecommitsChanged = Tagged<bool, struct IsPrecommitsChanged>;
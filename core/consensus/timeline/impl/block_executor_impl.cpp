@@ -14,6 +14,7 @@
 #include "consensus/babe/babe_config_repository.hpp"
 #include "consensus/timeline/impl/block_addition_error.hpp"
 #include "consensus/timeline/impl/block_appender_base.hpp"
+#include "consensus/timeline/impl/block_prefetcher.hpp"
 #include "metrics/histogram_timer.hpp"
 #include "runtime/runtime_api/core.hpp"
 #include "runtime/runtime_api/offchain_worker_api.hpp"
@@ -31,6 +32,20 @@ namespace kagome::consensus {
         "Time taken to verify and import blocks",
         {0.005, 0.01, 0.025, 0.05, 0.1, 0.25, 0.5, 1, 2.5, 5, 10},
     };
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+    metrics::HistogramTimer metric_core_execute_block_time{
+        "kagome_block_execution_time",
+        "Time taken by Core_execute_block runtime call",
+        {0.005, 0.01, 0.025, 0.05, 0.1, 0.25, 0.5, 1, 2.5, 5, 10},
+    };
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+    metrics::GaugeHelper metric_block_import_speed{
+        "kagome_block_import_speed",
+        "Number of blocks imported per second",
+    };
+
+    // period to average import speed over
+    constexpr auto kImportSpeedWindow = std::chrono::seconds(10);
   }  // namespace
 
   BlockExecutorImpl::BlockExecutorImpl(
@@ -44,6 +59,7 @@ namespace kagome::consensus {
       std::shared_ptr<runtime::OffchainWorkerApi> offchain_worker_api,
       primitives::events::StorageSubscriptionEnginePtr storage_sub_engine,
       primitives::events::ChainSubscriptionEnginePtr chain_sub_engine,
+      std::shared_ptr<BlockPrefetcher> prefetcher,
       std::unique_ptr<BlockAppenderBase> appender)
       : block_tree_{std::move(block_tree)},
         main_pool_handler_{main_thread_pool.handler(app_state_manager)},
@@ -55,9 +71,11 @@ namespace kagome::consensus {
         offchain_worker_api_(std::move(offchain_worker_api)),
         storage_sub_engine_{std::move(storage_sub_engine)},
         chain_subscription_engine_{std::move(chain_sub_engine)},
+        prefetcher_{std::move(prefetcher)},
         appender_{std::move(appender)},
         logger_{log::createLogger("BlockExecutor", "block_executor")},
-        telemetry_{telemetry::createTelemetryService()} {
+        telemetry_{telemetry::createTelemetryService()},
+        import_speed_start_{std::chrono::steady_clock::now()} {
     BOOST_ASSERT(block_tree_ != nullptr);
     BOOST_ASSERT(main_pool_handler_ != nullptr);
     BOOST_ASSERT(worker_pool_handler_ != nullptr);
@@ -65,6 +83,7 @@ namespace kagome::consensus {
     BOOST_ASSERT(tx_pool_ != nullptr);
     BOOST_ASSERT(hasher_ != nullptr);
     BOOST_ASSERT(offchain_worker_api_ != nullptr);
+    BOOST_ASSERT(prefetcher_ != nullptr);
     BOOST_ASSERT(logger_ != nullptr);
     BOOST_ASSERT(telemetry_ != nullptr);
     BOOST_ASSERT(appender_ != nullptr);
@@ -150,11 +169,22 @@ namespace kagome::consensus {
           .body = block.body,
       };
 
+      // warm the node cache in parallel with execution, which reads what is
+      // not loaded yet from database
+      auto prefetched = prefetcher_->prefetch(block, parent.state_root);
+      if (prefetcher_->enabled()) {
+        changes_tracker->recordReads();
+      }
+
+      auto execution_timer = metric_core_execute_block_time.manual();
       if (auto res = core_->execute_block_ref(block_ref, changes_tracker);
           res.has_error()) {
+        prefetcher_->abandon();
         callback(res.as_failure());
         return;
       }
+      execution_timer();
+      prefetcher_->onExecuted(prefetched, changes_tracker->takeReadKeys());
 
       auto duration_ms = timer().count();
       SL_DEBUG(logger_, "Core_execute_block: {} ms", duration_ms);
@@ -217,8 +247,13 @@ namespace kagome::consensus {
           }
 
           // remove block's extrinsics from tx pool
+          std::vector<common::BufferView> extrinsics;
+          extrinsics.reserve(block.body.size());
           for (const auto &extrinsic : block.body) {
-            auto extrinsic_hash = self->hasher_->blake2b_256(extrinsic.data);
+            extrinsics.emplace_back(extrinsic.data);
+          }
+          for (const auto &extrinsic_hash :
+               self->hasher_->blake2b_256_batch(extrinsics)) {
             SL_DEBUG(self->logger_,
                      "Contains extrinsic with hash: {}",
                      extrinsic_hash);
@@ -267,6 +302,8 @@ namespace kagome::consensus {
 
           auto now = std::chrono::steady_clock::now();
 
+          self->updateImportSpeed(now);
+
           self->logger_->info(
               "Imported block {} within {} ms.{}",
               block_info,
@@ -299,4 +336,18 @@ namespace kagome::consensus {
         });
   }
 
+  void BlockExecutorImpl::updateImportSpeed(
+      clock::SteadyClock::TimePoint now) {
+    ++import_speed_blocks_;
+    auto elapsed = now - import_speed_start_;
+    if (elapsed < kImportSpeedWindow) {
+      return;
+    }
+    metric_block_import_speed->set(
+        static_cast<double>(import_speed_blocks_)
+        / std::chrono::duration<double>(elapsed).count());
+    import_speed_start_ = now;
+    import_speed_blocks_ = 0;
+  }
+
 }  // namespace kagome::consensus
@@ -50,6 +50,7 @@ namespace kagome::transaction_pool {
 namespace kagome::consensus {
 
   class BlockAppenderBase;
+  class BlockPrefetcher;
 
   class BlockExecutorImpl
       : public BlockExecutor,
@@ -66,6 +67,7 @@ namespace kagome::consensus {
         std::shared_ptr<runtime::OffchainWorkerApi> offchain_worker_api,
         primitives::events::StorageSubscriptionEnginePtr storage_sub_engine,
         primitives::events::ChainSubscriptionEnginePtr chain_sub_engine,
+        std::shared_ptr<BlockPrefetcher> prefetcher,
         std::unique_ptr<BlockAppenderBase> appender);
 
     ~BlockExecutorImpl();
@@ -85,6 +87,9 @@ namespace kagome::consensus {
         const primitives::BlockInfo &previous_best_block);
 
    private:
+    /// Accounts imported block in import speed metric, on main thread
+    void updateImportSpeed(clock::SteadyClock::TimePoint now);
+
     std::shared_ptr<blockchain::BlockTree> block_tree_;
     std::shared_ptr<PoolHandler> main_pool_handler_;
     std::shared_ptr<PoolHandlerReady> worker_pool_handler_;
@@ -94,11 +99,15 @@ namespace kagome::consensus {
     std::shared_ptr<runtime::OffchainWorkerApi> offchain_worker_api_;
     primitives::events::StorageSubscriptionEnginePtr storage_sub_engine_;
     primitives::events::ChainSubscriptionEnginePtr chain_subscription_engine_;
+    std::shared_ptr<BlockPrefetcher> prefetcher_;
 
     std::unique_ptr<BlockAppenderBase> appender_;
 
     log::Logger logger_;
     telemetry::Telemetry telemetry_;
+
+    clock::SteadyClock::TimePoint import_speed_start_;
+    size_t import_speed_blocks_ = 0;
   };
 
 }  // namespace kagome::consensus
@@ -0,0 +1,232 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "consensus/timeline/impl/block_prefetcher.hpp"
+
+#include <algorithm>
+#include <tuple>
+
+#include "crypto/hasher.hpp"
+#include "metrics/histogram_timer.hpp"
+#include "storage/trie/polkadot_trie/polkadot_trie.hpp"
+#include "storage/trie/serialization/trie_serializer.hpp"
+#include "utils/parallel_for.hpp"
+#include "utils/thread_pool.hpp"
+
+namespace kagome::consensus {
+  namespace {
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+    metrics::HistogramTimer metric_prefetch_time{
+        "kagome_block_prefetch_time",
+        "Time taken to load trie nodes predicted to be read by a block before "
+        "its execution",
+        {0.001, 0.0025, 0.005, 0.01, 0.025, 0.05, 0.1, 0.25, 0.5, 1},
+    };
+    // Predicted keys are only scheduled to be loaded, execution may read them
+    // before their nodes are loaded.
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+    metrics::CounterHelper metric_predicted_reads{
+        "kagome_block_prefetch_predicted_reads",
+        "Number of storage keys read by block execution, which were predicted "
+        "to be read and scheduled for prefetching",
+    };
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+    metrics::CounterHelper metric_unpredicted_reads{
+        "kagome_block_prefetch_unpredicted_reads",
+        "Number of storage keys read by block execution, which were not "
+        "predicted to be read",
+    };
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+    metrics::GaugeHelper metric_predicted_ratio{
+        "kagome_block_prefetch_predicted_ratio",
+        "Share of storage keys read by last executed block, which were "
+        "predicted to be read",
+    };
+
+    // enough chunks of keys to keep every thread busy when loads differ
+    constexpr size_t kChunksPerThread = 4;
+
+    // bounds the prediction taken from a block reading a lot of keys
+    constexpr size_t kMaxLastReadKeys = 1 << 14;
+
+    // version byte of signed extrinsic of format version 4
+    constexpr uint8_t kSignedExtrinsicV4 = 0x84;
+    // `MultiAddress::Id` variant of signer address
+    constexpr uint8_t kMultiAddressId = 0;
+    constexpr size_t kAccountIdSize = 32;
+
+    using PrefetchTimer = decltype(metric_prefetch_time.manual());
+  }  // namespace
+
+  struct BlockPrefetcher::Loading {
+    primitives::BlockInfo block;
+    storage::trie::RootHash parent_state;
+    // neighbouring keys share most of their paths, so sorted chunks load
+    // fewer nodes twice
+    std::vector<common::Buffer> sorted;
+    size_t generation = 0;
+    std::optional<PrefetchTimer> timer;
+  };
+
+  BlockPrefetcher::BlockPrefetcher(
+      std::shared_ptr<ThreadPool> pool,
+      size_t threads,
+      std::shared_ptr<storage::trie::TrieSerializer> serializer,
+      std::shared_ptr<crypto::Hasher> hasher)
+      : pool_{threads != 0 ? std::move(pool) : nullptr},
+        threads_{threads},
+        serializer_{std::move(serializer)},
+        hasher_{std::move(hasher)},
+        logger_{log::createLogger("BlockPrefetcher", "block_executor")} {
+    if (pool_ == nullptr) {
+      return;
+    }
+    BOOST_ASSERT(serializer_ != nullptr);
+    BOOST_ASSERT(hasher_ != nullptr);
+
+    auto storage_prefix = [&](std::string_view pallet, std::string_view item) {
+      common::Buffer key;
+      key.put(hasher_->twox_128(common::Buffer::fromString(pallet)));
+      key.put(hasher_->twox_128(common::Buffer::fromString(item)));
+      return key;
+    };
+    account_prefix_ = storage_prefix("System", "Account");
+    // read by every block, predicted until there is a previous block
+    static_keys_ = {
+        storage_prefix("System", "Number"),
+        storage_prefix("System", "ParentHash"),
+        storage_prefix("System", "Digest"),
+        storage_prefix("System", "Events"),
+        storage_prefix("System", "EventCount"),
+        storage_prefix("System", "BlockWeight"),
+        storage_prefix("System", "AllExtrinsicsLen"),
+        storage_prefix("System", "ExecutionPhase"),
+        storage_prefix("Timestamp", "Now"),
+        storage_prefix("Timestamp", "DidUpdate"),
+        storage_prefix("Balances", "TotalIssuance"),
+    };
+  }
+
+  BlockPrefetcher::Keys BlockPrefetcher::predict(
+      const primitives::Block &block) const {
+    Keys keys{static_keys_.begin(), static_keys_.end()};
+    for (auto &extrinsic : block.body) {
+      auto &data = extrinsic.data;
+      if (data.size() < 2 + kAccountIdSize or data[0] != kSignedExtrinsicV4
+          or data[1] != kMultiAddressId) {
+        continue;
+      }
+      // fees are withdrawn from signer, nonce is checked and incremented
+      keys.emplace(accountKey(data.view(2, kAccountIdSize)));
+    }
+    return keys;
+  }
+
+  BlockPrefetcher::Keys BlockPrefetcher::prefetch(
+      const primitives::Block &block,
+      const storage::trie::RootHash &parent_state) {
+    if (not enabled()) {
+      return {};
+    }
+    auto keys = predict(block);
+    last_read_.sharedAccess(
+        [&](const Keys &last) { keys.insert(last.begin(), last.end()); });
+
+    auto chunks = std::min(keys.size(), threads_ * kChunksPerThread);
+    if (chunks == 0) {
+      return keys;
+    }
+    auto loading = std::make_shared<Loading>();
+    loading->block = block.header.blockInfo();
+    loading->parent_state = parent_state;
+    loading->sorted.assign(keys.begin(), keys.end());
+    std::ranges::sort(loading->sorted);
+    loading->generation = ++generation_;
+    loading->timer.emplace(metric_prefetch_time.manual());
+    auto self = shared_from_this();
+    parallelForAsync(
+        *pool_->io_context(),
+        chunks,
+        [self, loading, chunks](size_t chunk) {
+          auto size = loading->sorted.size();
+          self->load(
+              *loading, size * chunk / chunks, size * (chunk + 1) / chunks);
+        },
+        [self, loading] { self->onLoaded(*loading); });
+    return keys;
+  }
+
+  void BlockPrefetcher::load(Loading &loading, size_t begin, size_t end) const {
+    auto abandoned = [&] { return generation_ != loading.generation; };
+    if (not abandoned()) {
+      // trie isn't thread-safe, so every chunk walks its own, and they share
+      // nodes through the node cache of serializer
+      auto trie = serializer_->retrieveTrie(loading.parent_state, nullptr);
+      if (trie) {
+        const storage::trie::PolkadotTrie &t = *trie.value();
+        for (auto i = begin; i < end and not abandoned(); ++i) {
+          // path to a missing key is loaded too, it's read by execution the
+          // same way
+          auto nibbles =
+              storage::trie::KeyNibbles::fromByteBuffer(loading.sorted[i]);
+          std::ignore = t.getNode(t.getRoot(), nibbles);
+        }
+      }
+    }
+  }
+
+  void BlockPrefetcher::onLoaded(Loading &loading) const {
+    if (generation_ != loading.generation) {
+      SL_TRACE(logger_,
+               "Prefetch of block {} abandoned, block execution finished",
+               loading.block);
+      return;
+    }
+    auto duration = (*loading.timer)();
+    SL_TRACE(logger_,
+             "Prefetched {} keys of block {} in {} ms",
+             loading.sorted.size(),
+             loading.block,
+             duration.count());
+  }
+
+  void BlockPrefetcher::abandon() {
+    ++generation_;
+  }
+
+  void BlockPrefetcher::onExecuted(const Keys &predicted, Keys read) {
+    if (not enabled()) {
+      return;
+    }
+    abandon();
+    size_t predicted_reads = 0;
+    for (auto &key : read) {
+      if (predicted.contains(key)) {
+        ++predicted_reads;
+      }
+    }
+    metric_predicted_reads->inc(predicted_reads);
+    metric_unpredicted_reads->inc(read.size() - predicted_reads);
+    if (not read.empty()) {
+      metric_predicted_ratio->set(static_cast<double>(predicted_reads)
+                                  / static_cast<double>(read.size()));
+    }
+    if (read.size() > kMaxLastReadKeys) {
+      read.clear();
+    }
+    last_read_.exclusiveAccess([&](Keys &last) { last = std::move(read); });
+  }
+
+  common::Buffer BlockPrefetcher::accountKey(
+      common::BufferView account) const {
+    // `Blake2_128Concat` hasher of the map
+    common::Buffer key{account_prefix_};
+    key.put(hasher_->blake2b_128(account));
+    key.put(account);
+    return key;
+  }
+
+}  // namespace kagome::consensus
@@ -0,0 +1,110 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <atomic>
+#include <unordered_set>
+
+#include "log/logger.hpp"
+#include "primitives/block.hpp"
+#include "storage/trie/types.hpp"
+#include "utils/safe_object.hpp"
+
+namespace kagome {
+  class ThreadPool;
+}  // namespace kagome
+
+namespace kagome::crypto {
+  class Hasher;
+}
+
+namespace kagome::storage::trie {
+  class TrieSerializer;
+}
+
+namespace kagome::consensus {
+
+  /**
+   * Loads the trie nodes, which execution of a block is expected to read,
+   * before the execution, so that the single executing thread finds them in
+   * the node cache instead of waiting for the database on each miss.
+   * Predicted keys are the keys read by the previously executed block, a few
+   * well-known keys of System, Timestamp and Balances pallets, and the
+   * accounts of extrinsic signers.
+   * Paths to the keys are loaded on several threads of the pool in parallel
+   * with the execution, which reads from the database what is not loaded yet.
+   */
+  class BlockPrefetcher
+      : public std::enable_shared_from_this<BlockPrefetcher> {
+   public:
+    using Keys = std::unordered_set<common::Buffer>;
+
+    /**
+     * @param pool pool to load nodes on, null disables prefetching
+     * @param threads number of threads of \arg pool to split loading
+     * between, 0 disables prefetching
+     */
+    BlockPrefetcher(std::shared_ptr<ThreadPool> pool,
+                    size_t threads,
+                    std::shared_ptr<storage::trie::TrieSerializer> serializer,
+                    std::shared_ptr<crypto::Hasher> hasher);
+
+    bool enabled() const {
+      return pool_ != nullptr;
+    }
+
+    /**
+     * Starts loading nodes on the paths to the keys predicted for \arg block
+     * from the state of its parent \arg parent_state, and returns without
+     * waiting for them. Loading for the previous block is abandoned, failures
+     * are ignored.
+     * @return predicted keys
+     */
+    Keys prefetch(const primitives::Block &block,
+                  const storage::trie::RootHash &parent_state);
+
+    /**
+     * Counts keys \arg read by execution of a block, which were \arg predicted,
+     * and remembers them as a prediction for the next block.
+     * Abandons loading for the executed block.
+     */
+    void onExecuted(const Keys &predicted, Keys read);
+
+    /// Abandons loading for a block which execution failed
+    void abandon();
+
+    /**
+     * Keys expected to be read by execution of \arg block, without the keys
+     * read by previous block
+     */
+    Keys predict(const primitives::Block &block) const;
+
+   private:
+    struct Loading;
+
+    /// Loads paths to keys [\arg begin, \arg end) of \arg loading
+    void load(Loading &loading, size_t begin, size_t end) const;
+
+    /// Called after all keys of \arg loading are loaded or abandoned
+    void onLoaded(Loading &loading) const;
+
+    /// System.Account storage key of \arg account
+    common::Buffer accountKey(common::BufferView account) const;
+
+    std::shared_ptr<ThreadPool> pool_;
+    size_t threads_;
+    std::shared_ptr<storage::trie::TrieSerializer> serializer_;
+    std::shared_ptr<crypto::Hasher> hasher_;
+    /// Incremented to abandon loading in progress
+    std::atomic_size_t generation_ = 0;
+    common::Buffer account_prefix_;
+    std::vector<common::Buffer> static_keys_;
+    SafeObject<Keys> last_read_;
+    log::Logger logger_;
+  };
+
+}  // namespace kagome::consensus
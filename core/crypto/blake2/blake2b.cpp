@@ -12,6 +12,9 @@
 
 #include "blake2b.h"
 
+#include <algorithm>
+#include <cstring>
+
 namespace kagome::crypto {
 
   // Cyclic right rotation.
@@ -149,9 +152,9 @@ namespace kagome::crypto {
                       const void *in,
                       size_t inlen)  // data bytes
   {
-    size_t i;
+    auto *p = (const uint8_t *)in;
 
-    for (i = 0; i < inlen; i++) {
+    while (inlen > 0) {
       if (ctx->c == 128) {         // buffer full ?
         ctx->t[0] += ctx->c;       // add counters
         if (ctx->t[0] < ctx->c) {  // carry overflow ?
@@ -160,7 +163,12 @@ namespace kagome::crypto {
         blake2b_compress(ctx, 0);  // compress (not last)
         ctx->c = 0;                // counter to zero
       }
-      ctx->b[ctx->c++] = ((const uint8_t *)in)[i];
+      // copy as much as fits, instead of byte by byte
+      size_t n = std::min(128 - ctx->c, inlen);
+      memcpy(ctx->b + ctx->c, p, n);
+      ctx->c += n;
+      p += n;
+      inlen -= n;
     }
   }
 
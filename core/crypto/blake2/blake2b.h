@@ -52,6 +52,15 @@ namespace kagome::crypto {
               const void *in,
               size_t inlen);  // data to be hashed
 
+  // Unkeyed hashes of "count" independent inputs, "outlen" bytes each,
+  //      placed in "out" one after another.
+  //      Inputs of the same number of blocks are compressed together in
+  //      SIMD lanes, when CPU supports AVX2 or AVX-512.
+  int blake2b_batch(uint8_t *out,
+                    size_t outlen,
+                    const common::BufferView *in,
+                    size_t count);
+
   template <size_t N>
   inline common::Blob<N> blake2b(common::BufferView buf) {
     common::Blob<N> out;
@@ -0,0 +1,341 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+// Multi-buffer BLAKE2b.
+// Every SIMD lane hashes its own input, so that one compression of vectors
+// compresses blocks of 4 (AVX2) or 8 (AVX-512) inputs.
+// Lanes are compressed in lockstep, so inputs are grouped by number of blocks.
+
+#include "blake2b.h"
+
+#include <algorithm>
+#include <cstring>
+#include <numeric>
+#include <vector>
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define KAGOME_BLAKE2B_X86
+#include <immintrin.h>
+#endif
+
+namespace kagome::crypto {
+  namespace {
+    constexpr size_t kBlockSize = 128;
+    constexpr size_t kMaxLanes = 8;
+
+    constexpr uint64_t kIv[8] = {0x6A09E667F3BCC908,
+                                 0xBB67AE8584CAA73B,
+                                 0x3C6EF372FE94F82B,
+                                 0xA54FF53A5F1D36F1,
+                                 0x510E527FADE682D1,
+                                 0x9B05688C2B3E6C1F,
+                                 0x1F83D9ABFB41BD6B,
+                                 0x5BE0CD19137E2179};
+
+    constexpr uint8_t kSigma[12][16] = {
+        {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15},
+        {14, 10, 4, 8, 9, 15, 13, 6, 1, 12, 0, 2, 11, 7, 5, 3},
+        {11, 8, 12, 0, 5, 2, 15, 13, 10, 14, 3, 6, 7, 1, 9, 4},
+        {7, 9, 3, 1, 13, 12, 11, 14, 2, 6, 5, 10, 4, 0, 15, 8},
+        {9, 0, 5, 7, 2, 4, 10, 15, 14, 1, 11, 12, 6, 8, 3, 13},
+        {2, 12, 6, 10, 0, 11, 8, 3, 4, 13, 7, 5, 15, 14, 1, 9},
+        {12, 5, 1, 15, 14, 13, 4, 10, 0, 7, 6, 3, 9, 2, 8, 11},
+        {13, 11, 7, 14, 12, 1, 3, 9, 5, 0, 15, 4, 8, 6, 2, 10},
+        {6, 15, 14, 9, 11, 3, 0, 8, 12, 2, 13, 7, 1, 4, 10, 5},
+        {10, 2, 8, 4, 7, 6, 1, 5, 15, 11, 9, 14, 3, 12, 13, 0},
+        {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15},
+        {14, 10, 4, 8, 9, 15, 13, 6, 1, 12, 0, 2, 11, 7, 5, 3}};
+
+    // Number of compressed blocks, empty input is one block of zeros.
+    size_t blockCount(size_t len) {
+      return len == 0 ? 1 : (len + kBlockSize - 1) / kBlockSize;
+    }
+
+    // Input of one lane.
+    struct Lane {
+      void init(const common::BufferView &in, uint8_t *out) {
+        data = in.data();
+        len = in.size();
+        digest = out;
+        blocks = blockCount(len);
+        auto offset = (blocks - 1) * kBlockSize;
+        memset(tail, 0, kBlockSize);
+        if (len > offset) {
+          memcpy(tail, data + offset, len - offset);
+        }
+      }
+
+      // Block "i", last one is padded with zeros.
+      const uint8_t *block(size_t i) const {
+        return i + 1 < blocks ? data + i * kBlockSize : tail;
+      }
+
+      // Byte counter after block "i".
+      uint64_t counter(size_t i) const {
+        return i + 1 < blocks ? (i + 1) * kBlockSize : len;
+      }
+
+      const uint8_t *data;
+      size_t len;
+      size_t blocks;
+      uint8_t *digest;
+      uint8_t tail[kBlockSize];
+    };
+
+    // Transposes message words of block "i" of lanes, so that "words[w]"
+    // holds word "w" of every lane.
+    void gather(const Lane *lanes,
+                size_t n,
+                size_t i,
+                uint64_t (*words)[kMaxLanes],
+                uint64_t *counters) {
+      for (size_t l = 0; l < n; ++l) {
+        auto *block = lanes[l].block(i);
+        for (size_t w = 0; w < 16; ++w) {
+          memcpy(&words[w][l], block + 8 * w, 8);
+        }
+        counters[l] = lanes[l].counter(i);
+      }
+    }
+
+    // Little-endian digests from transposed chained state.
+    void scatter(Lane *lanes,
+                 size_t n,
+                 size_t outlen,
+                 const uint64_t (*h)[kMaxLanes]) {
+      for (size_t l = 0; l < n; ++l) {
+        for (size_t i = 0; i < outlen; ++i) {
+          lanes[l].digest[i] = (h[i >> 3][l] >> (8 * (i & 7))) & 0xFF;
+        }
+      }
+    }
+
+#ifdef KAGOME_BLAKE2B_X86
+#define B2B_AVX2 __attribute__((target("avx2")))
+#define B2B_AVX512 __attribute__((target("avx512f")))
+
+    B2B_AVX2 inline void g4(__m256i *v,
+                            int a,
+                            int b,
+                            int c,
+                            int d,
+                            __m256i x,
+                            __m256i y) {
+      const __m256i r16 = _mm256_setr_epi8(2, 3, 4, 5, 6, 7, 0, 1,
+                                           10, 11, 12, 13, 14, 15, 8, 9,
+                                           2, 3, 4, 5, 6, 7, 0, 1,
+                                           10, 11, 12, 13, 14, 15, 8, 9);
+      const __m256i r24 = _mm256_setr_epi8(3, 4, 5, 6, 7, 0, 1, 2,
+                                           11, 12, 13, 14, 15, 8, 9, 10,
+                                           3, 4, 5, 6, 7, 0, 1, 2,
+                                           11, 12, 13, 14, 15, 8, 9, 10);
+      v[a] = _mm256_add_epi64(_mm256_add_epi64(v[a], v[b]), x);
+      v[d] = _mm256_shuffle_epi32(_mm256_xor_si256(v[d], v[a]),
+                                  _MM_SHUFFLE(2, 3, 0, 1));
+      v[c] = _mm256_add_epi64(v[c], v[d]);
+      v[b] = _mm256_shuffle_epi8(_mm256_xor_si256(v[b], v[c]), r24);
+      v[a] = _mm256_add_epi64(_mm256_add_epi64(v[a], v[b]), y);
+      v[d] = _mm256_shuffle_epi8(_mm256_xor_si256(v[d], v[a]), r16);
+      v[c] = _mm256_add_epi64(v[c], v[d]);
+      v[b] = _mm256_xor_si256(v[b], v[c]);
+      v[b] = _mm256_or_si256(_mm256_srli_epi64(v[b], 63),
+                             _mm256_add_epi64(v[b], v[b]));
+    }
+
+    // Hashes 4 inputs of the same number of blocks.
+    B2B_AVX2 void compress4(Lane *lanes, size_t outlen) {
+      alignas(64) uint64_t words[16][kMaxLanes];
+      alignas(64) uint64_t counters[kMaxLanes];
+      __m256i h[8];
+      __m256i v[16];
+      __m256i m[16];
+      for (int i = 0; i < 8; ++i) {
+        h[i] = _mm256_set1_epi64x(static_cast<int64_t>(kIv[i]));
+      }
+      const auto param = static_cast<int64_t>(0x01010000 ^ outlen);
+      h[0] = _mm256_xor_si256(h[0], _mm256_set1_epi64x(param));
+
+      const auto blocks = lanes[0].blocks;
+      for (size_t i = 0; i < blocks; ++i) {
+        gather(lanes, 4, i, words, counters);
+        for (int w = 0; w < 16; ++w) {
+          m[w] = _mm256_load_si256(
+              reinterpret_cast<const __m256i *>(words[w]));
+        }
+        for (int j = 0; j < 8; ++j) {
+          v[j] = h[j];
+          v[j + 8] = _mm256_set1_epi64x(static_cast<int64_t>(kIv[j]));
+        }
+        v[12] = _mm256_xor_si256(
+            v[12], _mm256_load_si256(reinterpret_cast<__m256i *>(counters)));
+        if (i + 1 == blocks) {
+          v[14] = _mm256_xor_si256(v[14], _mm256_set1_epi64x(-1));
+        }
+        for (const auto &s : kSigma) {
+          g4(v, 0, 4, 8, 12, m[s[0]], m[s[1]]);
+          g4(v, 1, 5, 9, 13, m[s[2]], m[s[3]]);
+          g4(v, 2, 6, 10, 14, m[s[4]], m[s[5]]);
+          g4(v, 3, 7, 11, 15, m[s[6]], m[s[7]]);
+          g4(v, 0, 5, 10, 15, m[s[8]], m[s[9]]);
+          g4(v, 1, 6, 11, 12, m[s[10]], m[s[11]]);
+          g4(v, 2, 7, 8, 13, m[s[12]], m[s[13]]);
+          g4(v, 3, 4, 9, 14, m[s[14]], m[s[15]]);
+        }
+        for (int j = 0; j < 8; ++j) {
+          h[j] = _mm256_xor_si256(h[j], _mm256_xor_si256(v[j], v[j + 8]));
+        }
+      }
+
+      alignas(64) uint64_t state[8][kMaxLanes];
+      for (int j = 0; j < 8; ++j) {
+        _mm256_store_si256(reinterpret_cast<__m256i *>(state[j]), h[j]);
+      }
+      scatter(lanes, 4, outlen, state);
+    }
+
+    B2B_AVX512 inline void g8(__m512i *v,
+                              int a,
+                              int b,
+                              int c,
+                              int d,
+                              __m512i x,
+                              __m512i y) {
+      v[a] = _mm512_add_epi64(_mm512_add_epi64(v[a], v[b]), x);
+      v[d] = _mm512_ror_epi64(_mm512_xor_si512(v[d], v[a]), 32);
+      v[c] = _mm512_add_epi64(v[c], v[d]);
+      v[b] = _mm512_ror_epi64(_mm512_xor_si512(v[b], v[c]), 24);
+      v[a] = _mm512_add_epi64(_mm512_add_epi64(v[a], v[b]), y);
+      v[d] = _mm512_ror_epi64(_mm512_xor_si512(v[d], v[a]), 16);
+      v[c] = _mm512_add_epi64(v[c], v[d]);
+      v[b] = _mm512_ror_epi64(_mm512_xor_si512(v[b], v[c]), 63);
+    }
+
+    // Hashes 8 inputs of the same number of blocks.
+    B2B_AVX512 void compress8(Lane *lanes, size_t outlen) {
+      alignas(64) uint64_t words[16][kMaxLanes];
+      alignas(64) uint64_t counters[kMaxLanes];
+      __m512i h[8];
+      __m512i v[16];
+      __m512i m[16];
+      for (int i = 0; i < 8; ++i) {
+        h[i] = _mm512_set1_epi64(static_cast<int64_t>(kIv[i]));
+      }
+      const auto param = static_cast<int64_t>(0x01010000 ^ outlen);
+      h[0] = _mm512_xor_si512(h[0], _mm512_set1_epi64(param));
+
+      const auto blocks = lanes[0].blocks;
+      for (size_t i = 0; i < blocks; ++i) {
+        gather(lanes, 8, i, words, counters);
+        for (int w = 0; w < 16; ++w) {
+          m[w] = _mm512_load_si512(words[w]);
+        }
+        for (int j = 0; j < 8; ++j) {
+          v[j] = h[j];
+          v[j + 8] = _mm512_set1_epi64(static_cast<int64_t>(kIv[j]));
+        }
+        v[12] = _mm512_xor_si512(v[12], _mm512_load_si512(counters));
+        if (i + 1 == blocks) {
+          v[14] = _mm512_xor_si512(v[14], _mm512_set1_epi64(-1));
+        }
+        for (const auto &s : kSigma) {
+          g8(v, 0, 4, 8, 12, m[s[0]], m[s[1]]);
+          g8(v, 1, 5, 9, 13, m[s[2]], m[s[3]]);
+          g8(v, 2, 6, 10, 14, m[s[4]], m[s[5]]);
+          g8(v, 3, 7, 11, 15, m[s[6]], m[s[7]]);
+          g8(v, 0, 5, 10, 15, m[s[8]], m[s[9]]);
+          g8(v, 1, 6, 11, 12, m[s[10]], m[s[11]]);
+          g8(v, 2, 7, 8, 13, m[s[12]], m[s[13]]);
+          g8(v, 3, 4, 9, 14, m[s[14]], m[s[15]]);
+        }
+        for (int j = 0; j < 8; ++j) {
+          h[j] = _mm512_xor_si512(h[j], _mm512_xor_si512(v[j], v[j + 8]));
+        }
+      }
+
+      alignas(64) uint64_t state[8][kMaxLanes];
+      for (int j = 0; j < 8; ++j) {
+        _mm512_store_si512(state[j], h[j]);
+      }
+      scatter(lanes, 8, outlen, state);
+    }
+#endif
+
+    // Number of lanes supported by CPU, 0 if there is no SIMD support.
+    size_t detectLanes() {
+#ifdef KAGOME_BLAKE2B_X86
+      __builtin_cpu_init();
+      if (__builtin_cpu_supports("avx512f")) {
+        return 8;
+      }
+      if (__builtin_cpu_supports("avx2")) {
+        return 4;
+      }
+#endif
+      return 0;
+    }
+  }  // namespace
+
+  // Hashes inputs of the same number of blocks in lanes and the rest one by
+  // one with reference implementation.
+
+  int blake2b_batch(uint8_t *out,
+                    size_t outlen,
+                    const common::BufferView *in,
+                    size_t count) {
+    static const size_t max_lanes = detectLanes();
+
+    if (outlen == 0 || outlen > 64) {
+      return -1;  // illegal parameters
+    }
+
+    std::vector<size_t> order(count);
+    std::iota(order.begin(), order.end(), 0);
+    if (max_lanes != 0) {
+      std::stable_sort(order.begin(), order.end(), [&](size_t l, size_t r) {
+        return blockCount(in[l].size()) < blockCount(in[r].size());
+      });
+    }
+
+    size_t i = 0;
+    while (i < count) {
+      size_t n = 1;
+      if (max_lanes != 0) {
+        const auto blocks = blockCount(in[order[i]].size());
+        while (i + n < count && blockCount(in[order[i + n]].size()) == blocks) {
+          ++n;
+        }
+      }
+#ifdef KAGOME_BLAKE2B_X86
+      Lane lanes[kMaxLanes];
+      while (n >= 4 && max_lanes != 0) {
+        const size_t width = max_lanes == 8 && n >= 8 ? 8 : 4;
+        for (size_t l = 0; l < width; ++l) {
+          lanes[l].init(in[order[i + l]], out + order[i + l] * outlen);
+        }
+        if (width == 8) {
+          compress8(lanes, outlen);
+        } else {
+          compress4(lanes, outlen);
+        }
+        i += width;
+        n -= width;
+      }
+#endif
+      for (; n != 0; --n, ++i) {
+        auto &input = in[order[i]];
+        blake2b(out + order[i] * outlen,
+                outlen,
+                nullptr,
+                0,
+                input.data(),
+                input.size());
+      }
+    }
+
+    return 0;
+  }
+
+}  // namespace kagome::crypto
@@ -6,6 +6,9 @@
 
 #pragma once
 
+#include <span>
+#include <vector>
+
 #include "common/blob.hpp"
 #include "common/buffer_view.hpp"
 
@@ -62,6 +65,22 @@ namespace kagome::crypto {
      */
     virtual Hash256 blake2b_256(common::BufferView data) const = 0;
 
+    /**
+     * @brief blake2b_256_batch calculates 32-byte blake2b hashes of many
+     * independent values, which implementation may hash together
+     * @param data source values
+     * @return 256-bit hash values in the order of source values
+     */
+    virtual std::vector<Hash256> blake2b_256_batch(
+        std::span<const common::BufferView> data) const {
+      std::vector<Hash256> hashes;
+      hashes.reserve(data.size());
+      for (auto &item : data) {
+        hashes.emplace_back(blake2b_256(item));
+      }
+      return hashes;
+    }
+
     /**
      * @brief blake2b_512 function calculates 64-byte blake2b hash
      * @param data source value
@@ -44,6 +44,19 @@ namespace kagome::crypto {
     return blake2b<32>(data);
   }
 
+  std::vector<Hash256> HasherImpl::blake2b_256_batch(
+      std::span<const common::BufferView> data) const {
+    std::vector<Hash256> hashes(data.size());
+    // hashes are written one after another
+    static_assert(sizeof(Hash256) == Hash256::size());
+    BOOST_VERIFY(blake2b_batch(reinterpret_cast<uint8_t *>(hashes.data()),
+                               Hash256::size(),
+                               data.data(),
+                               data.size())
+                 == 0);
+    return hashes;
+  }
+
   Hash512 HasherImpl::blake2b_512(common::BufferView data) const {
     return blake2b<64>(data);
   }
@@ -26,6 +26,9 @@ namespace kagome::crypto {
 
     Hash256 blake2b_256(common::BufferView data) const override;
 
+    std::vector<Hash256> blake2b_256_batch(
+        std::span<const common::BufferView> data) const override;
+
     Hash256 keccak_256(common::BufferView data) const override;
 
     Hash256 blake2s_256(common::BufferView data) const override;
@@ -6,9 +6,132 @@
 
 #include "crypto/twox/twox.hpp"
 
+#include <algorithm>
+#include <cstring>
+
+#include <boost/endian/conversion.hpp>
 #include <xxhash.h>
 
 namespace kagome::crypto {
+  namespace {
+    constexpr uint64_t kPrime1 = 0x9E3779B185EBCA87ULL;
+    constexpr uint64_t kPrime2 = 0xC2B2AE3D27D4EB4FULL;
+    constexpr uint64_t kPrime3 = 0x165667B19E3779F9ULL;
+    constexpr uint64_t kPrime4 = 0x85EBCA77C2B2AE63ULL;
+    constexpr uint64_t kPrime5 = 0x27D4EB2F165667C5ULL;
+
+    uint64_t rotl(uint64_t x, int r) {
+      return (x << r) | (x >> (64 - r));
+    }
+
+    uint64_t round(uint64_t acc, uint64_t input) {
+      acc += input * kPrime2;
+      acc = rotl(acc, 31);
+      return acc * kPrime1;
+    }
+
+    uint64_t mergeRound(uint64_t acc, uint64_t val) {
+      acc ^= round(0, val);
+      return acc * kPrime1 + kPrime4;
+    }
+
+    /**
+     * Loads up to 8 bytes, zero padded, without going through memory, as
+     * copying to a zeroed word and reading it back stalls store forwarding
+     */
+    uint64_t loadWord(const uint8_t *p, size_t n) {
+      if (n == 8) {
+        return boost::endian::load_little_u64(p);
+      }
+      if (n >= 4) {
+        uint64_t lo = boost::endian::load_little_u32(p);
+        uint64_t hi = boost::endian::load_little_u32(p + n - 4);
+        return lo | (hi << ((n - 4) * 8));
+      }
+      return uint64_t{p[0]} | (uint64_t{p[n / 2]} << (n / 2 * 8))
+           | (uint64_t{p[n - 1]} << ((n - 1) * 8));
+    }
+
+    /**
+     * XXH64 of input with seeds 0..N-1, as twox hashes are.
+     * Input is read once, every word of it is mixed into the state of every
+     * seed one after another.
+     */
+    template <size_t N>
+    void xxh64Seeds(const uint8_t *in, size_t len, uint8_t *out) {
+      const uint8_t *p = in;
+      const uint8_t *const end = in + len;
+      uint64_t h[N];
+
+      if (len >= 32) {
+        uint64_t v[N][4];
+        for (size_t s = 0; s < N; ++s) {
+          v[s][0] = s + kPrime1 + kPrime2;
+          v[s][1] = s + kPrime2;
+          v[s][2] = s;
+          v[s][3] = s - kPrime1;
+        }
+        const uint8_t *const limit = end - 32;
+        do {
+          const uint64_t in0 = boost::endian::load_little_u64(p);
+          const uint64_t in1 = boost::endian::load_little_u64(p + 8);
+          const uint64_t in2 = boost::endian::load_little_u64(p + 16);
+          const uint64_t in3 = boost::endian::load_little_u64(p + 24);
+          for (size_t s = 0; s < N; ++s) {
+            v[s][0] = round(v[s][0], in0);
+            v[s][1] = round(v[s][1], in1);
+            v[s][2] = round(v[s][2], in2);
+            v[s][3] = round(v[s][3], in3);
+          }
+          p += 32;
+        } while (p <= limit);
+        for (size_t s = 0; s < N; ++s) {
+          h[s] = rotl(v[s][0], 1) + rotl(v[s][1], 7) + rotl(v[s][2], 12)
+               + rotl(v[s][3], 18);
+          for (auto lane : v[s]) {
+            h[s] = mergeRound(h[s], lane);
+          }
+        }
+      } else {
+        for (size_t s = 0; s < N; ++s) {
+          h[s] = s + kPrime5;
+        }
+      }
+
+      // the tail doesn't depend on seed until it is mixed into the state
+      for (size_t s = 0; s < N; ++s) {
+        h[s] += len;
+      }
+      for (; p + 8 <= end; p += 8) {
+        const auto k = round(0, boost::endian::load_little_u64(p));
+        for (size_t s = 0; s < N; ++s) {
+          h[s] = rotl(h[s] ^ k, 27) * kPrime1 + kPrime4;
+        }
+      }
+      if (p + 4 <= end) {
+        const auto k = boost::endian::load_little_u32(p) * kPrime1;
+        for (size_t s = 0; s < N; ++s) {
+          h[s] = rotl(h[s] ^ k, 23) * kPrime2 + kPrime3;
+        }
+        p += 4;
+      }
+      for (; p < end; ++p) {
+        const auto k = *p * kPrime5;
+        for (size_t s = 0; s < N; ++s) {
+          h[s] = rotl(h[s] ^ k, 11) * kPrime1;
+        }
+      }
+
+      for (size_t s = 0; s < N; ++s) {
+        h[s] ^= h[s] >> 33;
+        h[s] *= kPrime2;
+        h[s] ^= h[s] >> 29;
+        h[s] *= kPrime3;
+        h[s] ^= h[s] >> 32;
+        boost::endian::store_little_u64(out + s * sizeof(uint64_t), h[s]);
+      }
+    }
+  }  // namespace
 
   void make_twox64(const uint8_t *in, uint32_t len, uint8_t *out) {
     // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
@@ -23,42 +146,40 @@ namespace kagome::crypto {
     return hash;
   }
 
-  void make_twox128(const uint8_t *in, uint32_t len, uint8_t *out) {
-    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
-    auto *ptr = reinterpret_cast<uint64_t *>(out);
-    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-    ptr[0] = XXH64(in, len, 0);
-    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-    ptr[1] = XXH64(in, len, 1);
-  }
-
   common::Hash128 make_twox128(common::BufferView buf) {
     common::Hash128 hash{};
-    make_twox128(buf.data(), buf.size(), hash.data());
+    xxh64Seeds<2>(buf.data(), buf.size(), hash.data());
     return hash;
   }
 
-  void make_twox256(const uint8_t *in, uint32_t len, uint8_t *out) {
-    // Ensure the buffer is aligned to the boundary required for uint64_t
-    // (required for happy UBSAN)
-    std::array<uint8_t, 4 * sizeof(uint64_t)> aligned_out{};
-    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
-    auto *ptr = reinterpret_cast<uint64_t *>(aligned_out.data());
-    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-    ptr[0] = XXH64(in, len, 0);
-    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-    ptr[1] = XXH64(in, len, 1);
-    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-    ptr[2] = XXH64(in, len, 2);
-    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-    ptr[3] = XXH64(in, len, 3);
-    std::memcpy(out, aligned_out.data(), 4 * sizeof(uint64_t));
-  }
-
   common::Hash256 make_twox256(common::BufferView buf) {
     common::Hash256 hash{};
-    make_twox256(buf.data(), buf.size(), hash.data());
+    xxh64Seeds<4>(buf.data(), buf.size(), hash.data());
     return hash;
   }
 
+  common::Hash128 Twox128Cache::get(common::BufferView buf) {
+    if (buf.size() > kMaxSize) {
+      return make_twox128(buf);
+    }
+    // zero padded, so that lookup compares words of fixed size
+    Key key{};
+    for (size_t i = 0, offset = 0; offset < buf.size();
+         ++i, offset += sizeof(uint64_t)) {
+      key[i] = loadWord(buf.data() + offset,
+                        std::min(buf.size() - offset, sizeof(uint64_t)));
+    }
+    const auto mix = key[0] ^ rotl(key[1], 17) ^ rotl(key[2], 31)
+                   ^ rotl(key[3], 47) ^ buf.size();
+    static_assert(kEntries == 64);
+    auto &entry = entries_[(mix * kPrime1) >> 58];
+    if (entry.size == buf.size() and entry.key == key) {
+      return entry.hash;
+    }
+    entry.size = buf.size();
+    entry.key = key;
+    entry.hash = make_twox128(buf);
+    return entry.hash;
+  }
+
 }  // namespace kagome::crypto
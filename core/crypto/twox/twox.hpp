@@ -6,6 +6,8 @@
 
 #pragma once
 
+#include <array>
+
 #include "common/blob.hpp"
 
 namespace kagome::crypto {
@@ -16,4 +18,29 @@ namespace kagome::crypto {
 
   common::Hash256 make_twox256(common::BufferView buf);
 
+  /**
+   * Remembers twox_128 of short inputs, like names of pallets and storage
+   * items, which are hashed by runtime before almost every storage access.
+   * Direct-mapped, not thread-safe.
+   */
+  class Twox128Cache {
+   public:
+    static constexpr size_t kMaxSize = 32;
+    static constexpr size_t kEntries = 64;
+
+    common::Hash128 get(common::BufferView buf);
+
+   private:
+    using Key = std::array<uint64_t, kMaxSize / sizeof(uint64_t)>;
+
+    struct Entry {
+      // never matches, as input size is at most `kMaxSize`
+      size_t size = kMaxSize + 1;
+      Key key{};
+      common::Hash128 hash;
+    };
+
+    std::array<Entry, kEntries> entries_{};
+  };
+
 }  // namespace kagome::crypto
@@ -462,6 +462,15 @@ namespace kagome::host_api {
         runtime::WasmSpan msg,
         runtime::WasmPointer pubkey_data) = 0;
 
+    /**
+     * Left for backwards compatibility with older runtimes and should not be
+     * used anymore.
+     */
+    [[nodiscard]] virtual int32_t ext_crypto_ecdsa_batch_verify_version_1(
+        runtime::WasmPointer sig_data,
+        runtime::WasmSpan msg,
+        runtime::WasmPointer pubkey_data) = 0;
+
     /**
      * @brief Verifies an ecdsa signature. Returns true when the verification is
      * either successful or batched. If no batching verification extension is
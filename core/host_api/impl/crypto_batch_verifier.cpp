@@ -0,0 +1,69 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "host_api/impl/crypto_batch_verifier.hpp"
+
+#include "utils/thread_pool.hpp"
+
+namespace kagome::host_api {
+  CryptoBatchVerifier::CryptoBatchVerifier(std::shared_ptr<ThreadPool> pool)
+      : pool_{std::move(pool)} {
+    chunk_.reserve(kChunkSize);
+  }
+
+  void CryptoBatchVerifier::push(Check check) {
+    chunk_.emplace_back(std::move(check));
+    ++count_;
+    if (pool_ and chunk_.size() >= kChunkSize) {
+      dispatch();
+    }
+  }
+
+  CryptoBatchVerifier::Result CryptoBatchVerifier::finish() {
+    // the tail is verified on the calling thread, which would block anyway
+    auto tail = verifyChunk(chunk_);
+    chunk_.clear();
+
+    Result result{
+        .ok = tail.ok,
+        .count = count_,
+        .verify_time = tail.verify_time,
+        .saved_time = {},
+    };
+    auto wait_begin = Clock::now();
+    tasks_.wait();
+    result.saved_time -= Clock::now() - wait_begin;
+    for (auto &chunk : pending_) {
+      result.ok = result.ok and chunk->result.ok;
+      result.verify_time += chunk->result.verify_time;
+      result.saved_time += chunk->result.verify_time;
+    }
+    pending_.clear();
+    return result;
+  }
+
+  CryptoBatchVerifier::ChunkResult CryptoBatchVerifier::verifyChunk(
+      const std::vector<Check> &checks) {
+    auto begin = Clock::now();
+    bool ok = true;
+    for (auto &check : checks) {
+      // all signatures are verified even after a failure, to keep the cost
+      // of a batch independent of its validity
+      ok = check() and ok;
+    }
+    return {ok, Clock::now() - begin};
+  }
+
+  void CryptoBatchVerifier::dispatch() {
+    auto chunk = std::make_shared<Chunk>();
+    chunk->checks = std::move(chunk_);
+    pending_.emplace_back(chunk);
+    tasks_.spawn(*pool_->io_context(),
+                 [chunk] { chunk->result = verifyChunk(chunk->checks); });
+    chunk_ = {};
+    chunk_.reserve(kChunkSize);
+  }
+}  // namespace kagome::host_api
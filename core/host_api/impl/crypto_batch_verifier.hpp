@@ -0,0 +1,87 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include "utils/parallel_for.hpp"
+
+namespace kagome {
+  class ThreadPool;
+}  // namespace kagome
+
+namespace kagome::host_api {
+  /**
+   * Collects signature checks pushed between ext_crypto_start_batch_verify and
+   * ext_crypto_finish_batch_verify. Checks are grouped into chunks which are
+   * verified on the worker pool while the runtime keeps executing, and the
+   * results are joined in `finish()`.
+   */
+  class CryptoBatchVerifier {
+   public:
+    using Check = std::function<bool()>;
+    using Clock = std::chrono::steady_clock;
+
+    /// Number of checks verified by a single worker task
+    static constexpr size_t kChunkSize = 16;
+
+    struct Result {
+      bool ok;
+      /// Number of signatures in the batch
+      size_t count;
+      /// Total time spent verifying signatures, summed over all threads
+      Clock::duration verify_time;
+      /// Time of all chunks, minus time `finish()` spent verifying and
+      /// waiting for them
+      Clock::duration saved_time;
+    };
+
+    /**
+     * @param pool to verify chunks on, checks are verified on the calling
+     * thread without it
+     */
+    explicit CryptoBatchVerifier(std::shared_ptr<ThreadPool> pool);
+    CryptoBatchVerifier(const CryptoBatchVerifier &) = delete;
+    CryptoBatchVerifier &operator=(const CryptoBatchVerifier &) = delete;
+
+    /**
+     * Queues a check. Full chunks are dispatched to the worker pool
+     * immediately.
+     */
+    void push(Check check);
+
+    /**
+     * Verifies the remaining checks and chunks not yet taken by the pool on
+     * the calling thread, and waits for the rest.
+     */
+    Result finish();
+
+   private:
+    struct ChunkResult {
+      bool ok;
+      Clock::duration verify_time;
+    };
+
+    struct Chunk {
+      std::vector<Check> checks;
+      ChunkResult result{};
+    };
+
+    static ChunkResult verifyChunk(const std::vector<Check> &checks);
+    void dispatch();
+
+    std::shared_ptr<ThreadPool> pool_;
+    size_t count_ = 0;
+    std::vector<Check> chunk_;
+    std::vector<std::shared_ptr<Chunk>> pending_;
+    /// Chunk is verified either by pool or by `finish()`, whichever takes it
+    TaskGroup tasks_;
+  };
+}  // namespace kagome::host_api
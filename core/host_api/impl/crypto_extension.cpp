@@ -22,6 +22,7 @@
 #include "crypto/secp256k1/secp256k1_provider_impl.hpp"
 #include "crypto/sr25519_provider.hpp"
 #include "log/trace_macros.hpp"
+#include "metrics/histogram_timer.hpp"
 #include "runtime/ptr_size.hpp"
 #include "scale/kagome_scale.hpp"
 
@@ -36,6 +37,20 @@ namespace {
     throw std::runtime_error(msg);
   }
 
+  // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+  kagome::metrics::HistogramHelper metric_batch_verify_signatures{
+      "kagome_crypto_batch_verify_signatures",
+      "Number of signatures verified in one batch",
+      kagome::metrics::exponentialBuckets(1, 2, 14),
+  };
+
+  // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+  kagome::metrics::HistogramHelper metric_batch_verify_time_saved{
+      "kagome_crypto_batch_verify_time_saved",
+      "Time saved by verifying batched signatures in parallel, in seconds",
+      {0.001, 0.0025, 0.005, 0.01, 0.025, 0.05, 0.1, 0.25, 0.5, 1},
+  };
+
   void checkIfKeyIsSupported(kagome::crypto::KeyType key_type,
                              const kagome::log::Logger &log) {
     if (not key_type.is_supported()) {
@@ -65,7 +80,8 @@ namespace kagome::host_api {
       std::shared_ptr<const crypto::Ed25519Provider> ed25519_provider,
       std::shared_ptr<const crypto::Secp256k1Provider> secp256k1_provider,
       std::shared_ptr<const crypto::Hasher> hasher,
-      std::optional<std::shared_ptr<crypto::KeyStore>> key_store)
+      std::optional<std::shared_ptr<crypto::KeyStore>> key_store,
+      std::shared_ptr<ThreadPool> batch_verify_pool)
       : memory_provider_(std::move(memory_provider)),
         sr25519_provider_(std::move(sr25519_provider)),
         ecdsa_provider_(std::move(ecdsa_provider)),
@@ -73,7 +89,8 @@ namespace kagome::host_api {
         secp256k1_provider_(std::move(secp256k1_provider)),
         hasher_(std::move(hasher)),
         key_store_(std::move(key_store)),
-        logger_{log::createLogger("CryptoExtension", "crypto_extension")} {
+        logger_{log::createLogger("CryptoExtension", "crypto_extension")},
+        batch_verify_pool_{std::move(batch_verify_pool)} {
     BOOST_ASSERT(memory_provider_ != nullptr);
     BOOST_ASSERT(sr25519_provider_ != nullptr);
     BOOST_ASSERT(ecdsa_provider_ != nullptr);
@@ -142,7 +159,8 @@ namespace kagome::host_api {
       runtime::WasmSpan data) {
     auto [addr, len] = runtime::PtrSize(data);
     const auto &buf = getMemory().loadN(addr, len);
-    auto hash = hasher_->twox_128(buf);
+    // runtime hashes the same pallet and item names again and again
+    auto hash = twox_128_cache_.get(buf);
     SL_TRACE_FUNC_CALL(logger_, hash, buf);
 
     return getMemory().storeBuffer(hash);
@@ -162,7 +180,7 @@ namespace kagome::host_api {
     if (batch_verify_) {
       throw_with_error(logger_, "batch already started");
     }
-    batch_verify_ = kVerifySuccess;
+    batch_verify_.emplace(batch_verify_pool_);
   }
 
   runtime::WasmSize
@@ -170,9 +188,23 @@ namespace kagome::host_api {
     if (not batch_verify_) {
       throw_with_error(logger_, "batch not started");
     }
-    auto ok = *batch_verify_;
+    auto result = batch_verify_->finish();
     batch_verify_.reset();
-    return ok;
+
+    using Seconds = std::chrono::duration<double>;
+    auto saved = std::chrono::duration_cast<Seconds>(result.saved_time);
+    metric_batch_verify_signatures.observe(result.count);
+    metric_batch_verify_time_saved.observe(std::max(saved.count(), 0.0));
+    SL_DEBUG(logger_,
+             "Batch of {} signatures verified in {} ms, {} ms saved",
+             result.count,
+             std::chrono::duration_cast<std::chrono::milliseconds>(
+                 result.verify_time)
+                 .count(),
+             std::chrono::duration_cast<std::chrono::milliseconds>(
+                 result.saved_time)
+                 .count());
+    return result.ok ? kVerifySuccess : kVerifyFail;
   }
 
   runtime::WasmSpan CryptoExtension::ext_crypto_ed25519_public_keys_version_1(
@@ -294,12 +326,27 @@ namespace kagome::host_api {
       runtime::WasmPointer sig,
       runtime::WasmSpan msg_span,
       runtime::WasmPointer pubkey_data) {
-    SL_TRACE_FUNC_CALL(
-        logger_,
-        "Deprecated API method ext_crypto_ed25519_batch_verify_version_1 being "
-        "called. Passing call to ext_crypto_ed25519_verify_version_1");
-    return batchVerify(
-        ext_crypto_ed25519_verify_version_1(sig, msg_span, pubkey_data));
+    if (not batch_verify_) {
+      return ext_crypto_ed25519_verify_version_1(sig, msg_span, pubkey_data);
+    }
+    auto [msg_data, msg_len] = runtime::PtrSize(msg_span);
+    common::Buffer msg{getMemory().loadN(msg_data, msg_len)};
+    auto signature =
+        crypto::Ed25519Signature::fromSpan(
+            getMemory().loadN(sig, ed25519_constants::SIGNATURE_SIZE))
+            .value();
+    auto pubkey =
+        crypto::Ed25519PublicKey::fromSpan(
+            getMemory().loadN(pubkey_data, ed25519_constants::PUBKEY_SIZE))
+            .value();
+    SL_TRACE_FUNC_CALL(logger_, kVerifySuccess, signature, msg, pubkey);
+
+    batchVerify(
+        [provider{ed25519_provider_}, signature, msg{std::move(msg)}, pubkey] {
+          auto res = provider->verify(signature, msg, pubkey);
+          return res and res.value();
+        });
+    return kVerifySuccess;
   }
 
   runtime::WasmSpan CryptoExtension::ext_crypto_sr25519_public_keys_version_1(
@@ -431,12 +478,30 @@ namespace kagome::host_api {
       runtime::WasmPointer sig,
       runtime::WasmSpan msg_span,
       runtime::WasmPointer pubkey_data) {
-    SL_TRACE_FUNC_CALL(
-        logger_,
-        "Deprecated API method ext_crypto_sr25519_batch_verify_version_1 being "
-        "called. Passing call to ext_crypto_sr25519_verify_version_1");
-    return batchVerify(  // NOLINT(cppcoreguidelines-narrowing-conversions)
-        ext_crypto_sr25519_verify_version_1(sig, msg_span, pubkey_data));
+    if (not batch_verify_) {
+      return ext_crypto_sr25519_verify_version_1(sig, msg_span, pubkey_data);
+    }
+    auto [msg_data, msg_len] = runtime::PtrSize(msg_span);
+    common::Buffer msg{getMemory().loadN(msg_data, msg_len)};
+    auto signature_buffer =
+        getMemory().loadN(sig, sr25519_constants::SIGNATURE_SIZE);
+    crypto::Sr25519Signature signature{};
+    std::copy_n(signature_buffer.begin(),
+                sr25519_constants::SIGNATURE_SIZE,
+                signature.begin());
+    auto pubkey =
+        crypto::Sr25519PublicKey::fromSpan(
+            getMemory().loadN(pubkey_data, sr25519_constants::PUBLIC_SIZE))
+            .value();
+    SL_TRACE_FUNC_CALL(logger_, kVerifySuccess, signature, msg, pubkey);
+
+    // same as ext_crypto_sr25519_verify_version_1
+    batchVerify(
+        [provider{sr25519_provider_}, signature, msg{std::move(msg)}, pubkey] {
+          auto res = provider->verify_deprecated(signature, msg, pubkey);
+          return res and res.value();
+        });
+    return kVerifySuccess;
   }
 
   int32_t CryptoExtension::ext_crypto_sr25519_verify_version_1(
@@ -725,6 +790,35 @@ namespace kagome::host_api {
     return ecdsaVerify(/* allow_overflow= */ false, sig, msg, pub);
   }
 
+  int32_t CryptoExtension::ext_crypto_ecdsa_batch_verify_version_1(
+      runtime::WasmPointer sig,
+      runtime::WasmSpan msg_span,
+      runtime::WasmPointer pubkey_data) {
+    if (not batch_verify_) {
+      return ext_crypto_ecdsa_verify_version_1(sig, msg_span, pubkey_data);
+    }
+    auto [msg_data, msg_len] = runtime::PtrSize(msg_span);
+    common::Buffer msg{getMemory().loadN(msg_data, msg_len)};
+    auto signature =
+        crypto::EcdsaSignature::fromSpan(
+            getMemory().loadN(sig, ecdsa_constants::SIGNATURE_SIZE))
+            .value();
+    auto pubkey =
+        crypto::EcdsaPublicKey::fromSpan(
+            getMemory().loadN(pubkey_data, ecdsa_constants::PUBKEY_SIZE))
+            .value();
+    SL_TRACE_FUNC_CALL(logger_, kVerifySuccess, signature, msg, pubkey);
+
+    // same as ext_crypto_ecdsa_verify_version_1
+    batchVerify(
+        [provider{ecdsa_provider_}, signature, msg{std::move(msg)}, pubkey] {
+          auto res = provider->verify(
+              msg, signature, pubkey, /* allow_overflow= */ true);
+          return res and res.value();
+        });
+    return kVerifySuccess;
+  }
+
   int32_t CryptoExtension::ext_crypto_ecdsa_verify_prehashed_version_1(
       runtime::WasmPointer sig,
       runtime::WasmPointer msg,
@@ -759,11 +853,9 @@ namespace kagome::host_api {
     batch_verify_.reset();
   }
 
-  runtime::WasmSize CryptoExtension::batchVerify(runtime::WasmSize ok) {
-    if (batch_verify_) {
-      *batch_verify_ &= ok;
-    }
-    return ok;
+  void CryptoExtension::batchVerify(CryptoBatchVerifier::Check check) {
+    BOOST_ASSERT(batch_verify_);
+    batch_verify_->push(std::move(check));
   }
 
   runtime::WasmPointer
@@ -11,6 +11,8 @@
 #include <queue>
 
 #include "crypto/key_store.hpp"
+#include "crypto/twox/twox.hpp"
+#include "host_api/impl/crypto_batch_verifier.hpp"
 #include "log/logger.hpp"
 #include "runtime/memory_provider.hpp"
 #include "runtime/types.hpp"
@@ -42,7 +44,8 @@ namespace kagome::host_api {
         std::shared_ptr<const crypto::Ed25519Provider> ed25519_provider,
         std::shared_ptr<const crypto::Secp256k1Provider> secp256k1_provider,
         std::shared_ptr<const crypto::Hasher> hasher,
-        std::optional<std::shared_ptr<crypto::KeyStore>> key_store);
+        std::optional<std::shared_ptr<crypto::KeyStore>> key_store,
+        std::shared_ptr<ThreadPool> batch_verify_pool);
 
     void reset();
 
@@ -122,10 +125,10 @@ namespace kagome::host_api {
 
     /**
      * @see HostApi::ext_crypto_ed25519_batch_verify
-     * Deprecated and left here for backward-compatibility with old runtimes and
-     * not going to be used now.
+     * Deprecated and left here for backward-compatibility with old runtimes.
      *
-     * Emulates the behavior, but isn't doing any batch verification.
+     * Queues the signature if a batch is started, verifies it immediately
+     * otherwise.
      */
     runtime::WasmSize ext_crypto_ed25519_batch_verify_version_1(
         runtime::WasmPointer sig,
@@ -162,10 +165,10 @@ namespace kagome::host_api {
 
     /**
      * @see HostApi::ext_crypto_sr25519_batch_verify
-     * Deprecated and left here for backward-compatibility with old runtimes and
-     * not going to be used now.
+     * Deprecated and left here for backward-compatibility with old runtimes.
      *
-     * Emulates the behavior, but isn't doing any batch verification.
+     * Queues the signature if a batch is started, verifies it immediately
+     * otherwise.
      */
     int32_t ext_crypto_sr25519_batch_verify_version_1(
         runtime::WasmPointer sig,
@@ -235,6 +238,17 @@ namespace kagome::host_api {
                                               runtime::WasmSpan msg,
                                               runtime::WasmPointer key) const;
 
+    /**
+     * @see HostApi::ext_crypto_ecdsa_batch_verify
+     * Deprecated and left here for backward-compatibility with old runtimes.
+     *
+     * Queues the signature if a batch is started, verifies it immediately
+     * otherwise.
+     */
+    int32_t ext_crypto_ecdsa_batch_verify_version_1(runtime::WasmPointer sig,
+                                                    runtime::WasmSpan msg,
+                                                    runtime::WasmPointer key);
+
     /**
      * @see HostApi::ext_crypto_ecdsa_verify_prehashed_version_1
      */
@@ -268,7 +282,7 @@ namespace kagome::host_api {
     runtime::WasmSpan ecdsaRecoverCompressed(bool allow_overflow,
                                              runtime::WasmPointer sig,
                                              runtime::WasmPointer msg);
-    runtime::WasmSize batchVerify(runtime::WasmSize ok);
+    void batchVerify(CryptoBatchVerifier::Check check);
     crypto::KeyType loadKeyType(runtime::WasmPointer ptr) const;
 
     std::shared_ptr<const runtime::MemoryProvider> memory_provider_;
@@ -281,6 +295,9 @@ namespace kagome::host_api {
     // not needed in PVF workers
     std::optional<std::shared_ptr<crypto::KeyStore>> key_store_;
     log::Logger logger_;
-    std::optional<runtime::WasmSize> batch_verify_;
+    // not available in PVF workers
+    std::shared_ptr<ThreadPool> batch_verify_pool_;
+    std::optional<CryptoBatchVerifier> batch_verify_;
+    crypto::Twox128Cache twox_128_cache_;
   };
 }  // namespace kagome::host_api
@@ -6,6 +6,7 @@
 
 #include "host_api/impl/host_api_factory_impl.hpp"
 
+#include "common/worker_thread_pool.hpp"
 #include "host_api/impl/host_api_impl.hpp"
 
 namespace kagome::host_api {
@@ -23,7 +24,8 @@ namespace kagome::host_api {
       std::shared_ptr<offchain::OffchainPersistentStorage>
           offchain_persistent_storage,
       std::shared_ptr<offchain::OffchainWorkerPool> offchain_worker_pool,
-      LazySPtr<api::StateApi> state_api)
+      LazySPtr<api::StateApi> state_api,
+      std::shared_ptr<common::WorkerThreadPool> worker_thread_pool)
       : offchain_config_(offchain_config),
         ecdsa_provider_(std::move(ecdsa_provider)),
         ed25519_provider_(std::move(ed25519_provider)),
@@ -37,7 +39,8 @@ namespace kagome::host_api {
         key_store_(key_store ? std::optional(key_store) : std::nullopt),
         offchain_persistent_storage_(std::move(offchain_persistent_storage)),
         offchain_worker_pool_(std::move(offchain_worker_pool)),
-        state_api_(std::move(state_api)) {
+        state_api_(std::move(state_api)),
+        worker_thread_pool_(std::move(worker_thread_pool)) {
     BOOST_ASSERT(ecdsa_provider_ != nullptr);
     BOOST_ASSERT(ed25519_provider_ != nullptr);
     BOOST_ASSERT(sr25519_provider_ != nullptr);
@@ -65,7 +68,8 @@ namespace kagome::host_api {
                                          key_store_,
                                          offchain_persistent_storage_,
                                          offchain_worker_pool_,
-                                         state_api_);
+                                         state_api_,
+                                         worker_thread_pool_);
   }
 
 }  // namespace kagome::host_api
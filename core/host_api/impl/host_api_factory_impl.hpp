@@ -23,6 +23,10 @@ namespace kagome::crypto {
   class KeyStore;
 }  // namespace kagome::crypto
 
+namespace kagome::common {
+  class WorkerThreadPool;
+}  // namespace kagome::common
+
 namespace kagome::offchain {
   class OffchainPersistentStorage;
   class OffchainWorkerPool;
@@ -47,7 +51,8 @@ namespace kagome::host_api {
         std::shared_ptr<offchain::OffchainPersistentStorage>
             offchain_persistent_storage,
         std::shared_ptr<offchain::OffchainWorkerPool> offchain_worker_pool,
-        LazySPtr<api::StateApi> state_api);
+        LazySPtr<api::StateApi> state_api,
+        std::shared_ptr<common::WorkerThreadPool> worker_thread_pool);
 
     std::unique_ptr<HostApi> make(
         std::shared_ptr<const runtime::CoreApiFactory> core_factory,
@@ -69,6 +74,8 @@ namespace kagome::host_api {
         offchain_persistent_storage_;
     std::shared_ptr<offchain::OffchainWorkerPool> offchain_worker_pool_;
     LazySPtr<api::StateApi> state_api_;
+    // not available in PVF workers
+    std::shared_ptr<common::WorkerThreadPool> worker_thread_pool_;
   };
 
 }  // namespace kagome::host_api
@@ -85,7 +85,8 @@ namespace kagome::host_api {
       std::shared_ptr<offchain::OffchainPersistentStorage>
           offchain_persistent_storage,
       std::shared_ptr<offchain::OffchainWorkerPool> offchain_worker_pool,
-      LazySPtr<api::StateApi> state_api)
+      LazySPtr<api::StateApi> state_api,
+      std::shared_ptr<ThreadPool> batch_verify_pool)
       : memory_provider_([&] {
           BOOST_ASSERT(memory_provider);
           return std::move(memory_provider);
@@ -100,7 +101,8 @@ namespace kagome::host_api {
                     std::move(ed25519_provider),
                     std::move(secp256k1_provider),
                     hasher,
-                    std::move(key_store)),
+                    std::move(key_store),
+                    std::move(batch_verify_pool)),
         elliptic_curves_ext_(memory_provider_, std::move(elliptic_curves)),
         io_ext_(memory_provider_),
         memory_ext_(memory_provider_),
@@ -367,6 +369,13 @@ namespace kagome::host_api {
     return crypto_ext_.ext_crypto_ecdsa_verify_version_2(sig, msg, key);
   }
 
+  int32_t HostApiImpl::ext_crypto_ecdsa_batch_verify_version_1(
+      runtime::WasmPointer sig,
+      runtime::WasmSpan msg,
+      runtime::WasmPointer key) {
+    return crypto_ext_.ext_crypto_ecdsa_batch_verify_version_1(sig, msg, key);
+  }
+
   int32_t HostApiImpl::ext_crypto_ecdsa_verify_prehashed_version_1(
       runtime::WasmPointer sig,
       runtime::WasmPointer msg,
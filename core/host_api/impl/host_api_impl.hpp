@@ -50,7 +50,8 @@ namespace kagome::host_api {
         std::shared_ptr<offchain::OffchainPersistentStorage>
             offchain_persistent_storage,
         std::shared_ptr<offchain::OffchainWorkerPool> offchain_worker_pool,
-        LazySPtr<api::StateApi> state_api);
+        LazySPtr<api::StateApi> state_api,
+        std::shared_ptr<ThreadPool> batch_verify_pool);
 
     ~HostApiImpl() override = default;
 
@@ -207,6 +208,11 @@ namespace kagome::host_api {
         runtime::WasmSpan msg,
         runtime::WasmPointer key) override;
 
+    int32_t ext_crypto_ecdsa_batch_verify_version_1(
+        runtime::WasmPointer sig,
+        runtime::WasmSpan msg,
+        runtime::WasmPointer key) override;
+
     int32_t ext_crypto_ecdsa_verify_prehashed_version_1(
         runtime::WasmPointer sig,
         runtime::WasmPointer msg,
@@ -23,7 +23,6 @@
 #include "runtime/memory_provider.hpp"
 #include "runtime/ptr_size.hpp"
 #include "runtime/trie_storage_provider.hpp"
-#include "scale/encode_append.hpp"
 #include "scale/kagome_scale.hpp"
 #include "storage/predefined_keys.hpp"
 #include "storage/trie/impl/topper_trie_batch_impl.hpp"
@@ -280,25 +279,12 @@ namespace kagome::host_api {
     auto key_bytes = memory.loadN(key_ptr, key_size);
     auto append_bytes = memory.loadN(append_ptr, append_size);
 
-    auto val_opt_res = get(key_bytes);
-    if (val_opt_res.has_error()) {
+    // overlay appends item without copying the whole vector
+    auto batch = storage_provider_->getCurrentBatch();
+    SL_TRACE_VOID_FUNC_CALL(logger_, key_bytes, append_bytes);
+    if (auto res = batch->append(key_bytes, append_bytes); not res) {
       throw std::runtime_error(fmt::format(
-          "Error fetching value from storage: {}", val_opt_res.error()));
-    }
-    auto &val_opt = val_opt_res.value();
-    auto &&val = val_opt ? common::Buffer{val_opt.value()} : common::Buffer{};
-
-    if (scale::append_or_new_vec(val.asVector(), append_bytes).has_value()) {
-      auto batch = storage_provider_->getCurrentBatch();
-      SL_TRACE_VOID_FUNC_CALL(logger_, key_bytes, val);
-      auto put_result = batch->put(key_bytes, std::move(val));
-      if (not put_result) {
-        logger_->error(
-            "ext_storage_append_version_1 failed, due to fail in trie db "
-            "with reason: {}",
-            put_result.error());
-      }
-      return;
+          "ext_storage_append_version_1 failed with reason: {}", res.error()));
     }
   }
 
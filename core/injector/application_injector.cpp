@@ -83,6 +83,7 @@
 #include "consensus/timeline/impl/block_appender_base.hpp"
 #include "consensus/timeline/impl/block_executor_impl.hpp"
 #include "consensus/timeline/impl/block_header_appender_impl.hpp"
+#include "consensus/timeline/impl/block_prefetcher.hpp"
 #include "consensus/timeline/impl/consensus_selector_impl.hpp"
 #include "consensus/timeline/impl/slots_util_impl.hpp"
 #include "consensus/timeline/impl/timeline_impl.hpp"
@@ -155,6 +156,7 @@
 #include "parachain/approval/approval_thread_pool.hpp"
 #include "parachain/availability/bitfield/signer.hpp"
 #include "parachain/availability/bitfield/store_impl.hpp"
+#include "parachain/availability/erasure_coder.hpp"
 #include "parachain/availability/fetch/fetch_impl.hpp"
 #include "parachain/availability/recovery/recovery_impl.hpp"
 #include "parachain/availability/store/store_impl.hpp"
@@ -226,6 +228,8 @@
 #include "storage/trie/impl/trie_storage_impl.hpp"
 #include "storage/trie/polkadot_trie/polkadot_trie_factory_impl.hpp"
 #include "storage/trie/serialization/polkadot_codec.hpp"
+#include "storage/trie/serialization/trie_node_cache.hpp"
+#include "storage/trie/serialization/trie_state_overlay.hpp"
 #include "storage/trie/serialization/trie_serializer_impl.hpp"
 #include "storage/trie_pruner/impl/trie_pruner_impl.hpp"
 #include "telemetry/impl/service_impl.hpp"
@@ -401,6 +405,13 @@ namespace {
           return std::make_shared<kagome::runtime::wavm::CompartmentWrapper>(
               "Runtime Compartment");
         }),
+        bind_by_lambda<runtime::wavm::ModuleParams>([](const auto &injector) {
+          const auto &config =
+              injector.template create<const application::AppConfiguration &>();
+          auto module_params = std::make_shared<runtime::wavm::ModuleParams>();
+          module_params->memory_snapshot = config.wasmMemorySnapshot();
+          return module_params;
+        }),
         bind_by_lambda<runtime::wavm::IntrinsicModule>(
             [](const auto &injector) {
               auto compartment = injector.template create<
@@ -593,7 +604,10 @@ namespace {
   auto makeApplicationInjector(sptr<application::AppConfiguration> config,
                                Ts &&...args) {
     // default values for configurations
-    api::WsSession::Configuration ws_config{};
+    api::WsSession::Configuration ws_config{
+        .max_queue_size = config->wsMaxQueueSize(),
+        .slow_consumer_policy = config->wsSlowConsumerPolicy(),
+    };
     transaction_pool::PoolModeratorImpl::Params pool_moderator_config{};
     transaction_pool::TransactionPool::Limits tp_pool_limits{};
     libp2p::protocol::PingConfig ping_config{};
@@ -610,6 +624,7 @@ namespace {
                     Compile
             ? runtime::wasm_edge::ModuleFactoryImpl::ExecType::Compiled
             : runtime::wasm_edge::ModuleFactoryImpl::ExecType::Interpreted,
+        config->wasmMemorySnapshot(),
     };
 #endif
 
@@ -799,6 +814,11 @@ namespace {
             di::bind<network::SyncProtocolObserver>.template to<network::SyncProtocolObserverImpl>(),
             di::bind<network::DisputeRequestObserver>.template to<dispute::DisputeCoordinatorImpl>(),
             di::bind<parachain::AvailabilityStore>.template to<parachain::AvailabilityStoreImpl>(),
+            bind_by_lambda<parachain::ErasureCoder>([](const auto &injector) {
+              return std::make_shared<parachain::ErasureCoder>(
+                  injector.template create<sptr<common::WorkerThreadPool>>(),
+                  std::max<size_t>(1, std::thread::hardware_concurrency() / 2));
+            }),
             di::bind<network::IPeerView>.template to<network::PeerView>(),
             di::bind<parachain::IBitfieldSigner>.template to<parachain::BitfieldSigner>(),
             di::bind<parachain::Fetch>.template to<parachain::FetchImpl>(),
@@ -872,7 +892,28 @@ namespace {
             bind_by_lambda<storage::trie::PolkadotCodec>([](const auto&) {
               return std::make_shared<storage::trie::PolkadotCodec>(crypto::blake2b<32>);
             }),
-            di::bind<storage::trie::TrieSerializer>.template to<storage::trie::TrieSerializerImpl>(),
+            bind_by_lambda<storage::trie::TrieNodeCache>([](const auto &injector) {
+              auto &app_config = injector.template create<const application::AppConfiguration &>();
+              return std::make_shared<storage::trie::TrieNodeCache>(
+                  size_t{app_config.trieNodeCacheSize()} * 1024 * 1024);
+            }),
+            bind_by_lambda<storage::trie::TrieStateOverlay>([](const auto &injector) {
+              auto &app_config = injector.template create<const application::AppConfiguration &>();
+              return std::make_shared<storage::trie::TrieStateOverlay>(
+                  app_config.trieStateOverlaySize(),
+                  size_t{app_config.trieStateOverlayCapacity()} * 1024 * 1024,
+                  injector.template create<primitives::events::ChainSubscriptionEnginePtr>());
+            }),
+            bind_by_lambda<storage::trie::TrieSerializer>([](const auto &injector) {
+              return std::make_shared<storage::trie::TrieSerializerImpl>(
+                  injector.template create<sptr<storage::trie::PolkadotTrieFactory>>(),
+                  injector.template create<sptr<storage::trie::Codec>>(),
+                  injector.template create<sptr<storage::trie::TrieStorageBackend>>(),
+                  injector.template create<sptr<storage::trie::TrieNodeCache>>(),
+                  injector.template create<sptr<common::WorkerThreadPool>>(),
+                  std::max<size_t>(1, std::thread::hardware_concurrency() / 2),
+                  injector.template create<sptr<storage::trie::TrieStateOverlay>>());
+            }),
             bind_by_lambda<storage::trie_pruner::TriePruner>(
                 [](const auto &injector)
                     -> sptr<storage::trie_pruner::TriePruner> {
@@ -902,6 +943,14 @@ namespace {
             di::bind<network::ReqCollationProtocol>.template to<network::ReqCollationProtocolImpl>(),
             di::bind<network::ReqPovProtocol>.template to<network::ReqPovProtocolImpl>(),
             di::bind<consensus::BlockHeaderAppender>.template to<consensus::BlockHeaderAppenderImpl>(),
+            bind_by_lambda<consensus::BlockPrefetcher>([](const auto &injector) {
+              auto &app_config = injector.template create<const application::AppConfiguration &>();
+              return std::make_shared<consensus::BlockPrefetcher>(
+                  injector.template create<sptr<common::WorkerThreadPool>>(),
+                  app_config.statePrefetchThreads(),
+                  injector.template create<sptr<storage::trie::TrieSerializer>>(),
+                  injector.template create<sptr<crypto::Hasher>>());
+            }),
             di::bind<consensus::BlockExecutor>.template to<consensus::BlockExecutorImpl>(),
             di::bind<consensus::grandpa::Grandpa>.template to<consensus::grandpa::GrandpaImpl>(),
             di::bind<consensus::grandpa::JustificationObserver>.template to<consensus::grandpa::GrandpaImpl>(),
@@ -27,6 +27,13 @@ namespace kagome::storage::trie_pruner {
       return outcome::success();
     }
 
+    outcome::result<std::unique_ptr<BufferBatch>> addNewState(
+        const storage::trie::PolkadotTrie &new_trie,
+        storage::trie::StateVersion version,
+        std::unique_ptr<BufferBatch> batch) override {
+      return batch;
+    }
+
     void schedulePrune(const trie::RootHash &,
                        const primitives::BlockInfo &,
                        PruneReason) override {}
@@ -28,6 +28,30 @@ namespace kagome::network {
     }
   }
 
+  StateSyncRequestFlow::StateSyncRequestFlow(
+      std::shared_ptr<storage::trie::TrieStorageBackend> node_db,
+      const primitives::BlockInfo &block_info,
+      const primitives::BlockHeader &block,
+      const Level::Item &root,
+      uint8_t partition)
+      : node_db_{std::move(node_db)},
+        block_info_{block_info},
+        block_{block},
+        partition_{partition},
+        log_{log::createLogger("StateSync")} {
+    // copy of root node with single child, so cursor stops after it
+    auto node =
+        std::make_shared<storage::trie::BranchNode>(root.node->getKeyNibbles());
+    node->setChild(partition, root.node->asBranch().getChildren()[partition]);
+    auto &level = levels_.emplace_back();
+    level.push({
+        .node = node,
+        .branch = partition,
+        .child = false,
+        .t = {.hash = root.t.hash, .encoded = {}},
+    });
+  }
+
   StateRequest StateSyncRequestFlow::nextRequest() const {
     BOOST_ASSERT(not complete());
     StateRequest req{
@@ -35,16 +59,20 @@ namespace kagome::network {
         .start = {},
         .no_proof = false,
     };
+    if (not start_.empty()) {
+      req.start = start_;
+      return req;
+    }
     for (auto &level : levels_) {
       storage::trie::KeyNibbles nibbles;
       for (auto &item : level.stack) {
-        nibbles.put(item.node->getKeyNibbles());
+        nibbles.append(item.node->getKeyNibbles());
         if (item.branch) {
-          nibbles.putUint8(*item.branch);
+          nibbles.push_back(*item.branch);
         }
       }
       if (nibbles.size() % 2 != 0) {
-        nibbles.putUint8(0);
+        nibbles.push_back(0);
       }
       req.start.emplace_back(nibbles.toByteBuffer());
     }
@@ -53,20 +81,136 @@ namespace kagome::network {
 
   outcome::result<void> StateSyncRequestFlow::onResponse(
       const StateResponse &res) {
-    storage::trie::PolkadotCodec codec;
+    storage::trie::CompactDecoded rest;
+    return onResponse(res, rest);
+  }
+
+  outcome::result<void> StateSyncRequestFlow::onResponse(
+      const StateResponse &res, storage::trie::CompactDecoded &rest) {
     BOOST_ASSERT(not complete());
     BOOST_OUTCOME_TRY(auto nodes, storage::trie::compactDecode(res.proof));
     auto diff_count = nodes.size(), diff_size = res.proof.size();
     if (diff_count != 0) {
       stat_count_ += diff_count;
       stat_size_ += diff_size;
-      SL_INFO(log_,
-              "received {} nodes {}mb, total {} nodes {}mb",
-              diff_count,
-              diff_size >> 20,
-              stat_count_,
-              stat_size_ >> 20);
+      if (partition_) {
+        SL_INFO(log_,
+                "partition {:x}: received {} nodes {}mb, total {} nodes {}mb",
+                *partition_,
+                diff_count,
+                diff_size >> 20,
+                stat_count_,
+                stat_size_ >> 20);
+      } else {
+        SL_INFO(log_,
+                "received {} nodes {}mb, total {} nodes {}mb",
+                diff_count,
+                diff_size >> 20,
+                stat_count_,
+                stat_size_ >> 20);
+      }
     }
+    start_.clear();
+    auto batch = node_db_->batch();
+    OUTCOME_TRY(process(nodes, *batch));
+    OUTCOME_TRY(batch->commit());
+    rest = std::move(nodes);
+    return outcome::success();
+  }
+
+  outcome::result<void> StateSyncRequestFlow::onNodes(
+      storage::trie::CompactDecoded &nodes) {
+    BOOST_ASSERT(not complete());
+    auto count = nodes.size();
+    auto batch = node_db_->batch();
+    OUTCOME_TRY(process(nodes, *batch));
+    OUTCOME_TRY(batch->commit());
+    if (nodes.size() == count) {
+      return outcome::success();
+    }
+    // cursor has moved, start of next request follows it
+    start_.clear();
+    SL_DEBUG(log_,
+             "partition {:x}: used {} nodes of other response",
+             partition_.value_or(0),
+             count - nodes.size());
+    return outcome::success();
+  }
+
+  std::vector<StateSyncRequestFlow> StateSyncRequestFlow::partitions() {
+    std::vector<StateSyncRequestFlow> partitions;
+    if (done_ or partition_ or levels_.empty()
+        or levels_.front().stack.empty()) {
+      return partitions;
+    }
+    auto root = levels_.front().stack.front();
+    if (not root.branch or not root.node->isBranch()) {
+      return partitions;
+    }
+    const auto &children = root.node->asBranch().getChildren();
+    for (uint8_t i = *root.branch; i < children.size(); ++i) {
+      // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+      auto &child = children[i];
+      if (not child) {
+        continue;
+      }
+      auto hash = child->asDummy().db_key.asHash();
+      if (not hash) {
+        continue;
+      }
+      if (i != *root.branch and isKnown(*hash)) {
+        continue;
+      }
+      auto &partition = partitions.emplace_back(StateSyncRequestFlow{
+          node_db_, block_info_, block_, root, i});
+      if (i == *root.branch) {
+        // partition continues nodes already fetched by this flow
+        auto front = std::move(partition.levels_.front().stack.front());
+        partition.levels_ = std::move(levels_);
+        partition.levels_.front().stack.front() = std::move(front);
+        partition.levels_.front().update();
+        partition.stat_count_ = stat_count_;
+        partition.stat_size_ = stat_size_;
+      }
+    }
+    levels_.clear();
+    auto &level = levels_.emplace_back();
+    root.child = false;
+    level.push(std::move(root));
+    return partitions;
+  }
+
+  outcome::result<void> StateSyncRequestFlow::resume() {
+    BOOST_ASSERT(not complete());
+    storage::trie::CompactDecoded nodes;
+    auto batch = node_db_->batch();
+    OUTCOME_TRY(process(nodes, *batch));
+    OUTCOME_TRY(batch->commit());
+    return outcome::success();
+  }
+
+  void StateSyncRequestFlow::setStart(std::vector<common::Buffer> start) {
+    start_ = std::move(start);
+  }
+
+  bool StateSyncRequestFlow::contains(
+      const std::vector<common::Buffer> &start) const {
+    if (not partition_) {
+      return true;
+    }
+    if (start.empty() or levels_.empty() or levels_.front().stack.empty()) {
+      return false;
+    }
+    auto prefix = levels_.front().stack.front().node->getKeyNibbles();
+    prefix.push_back(*partition_);
+    return storage::trie::KeyNibbles::fromByteBuffer(start.front())
+        .view()
+        .startsWith(prefix);
+  }
+
+  outcome::result<void> StateSyncRequestFlow::process(
+      storage::trie::CompactDecoded &nodes, storage::BufferBatch &batch) {
+    storage::trie::PolkadotCodec codec;
     while (not levels_.empty()) {
       auto &level = levels_.back();
       auto push = [&](decltype(nodes)::iterator it) -> outcome::result<void> {
@@ -110,8 +254,9 @@ namespace kagome::network {
           if (it == nodes.end()) {
             return outcome::success();
           }
-          OUTCOME_TRY(node_db_->put(it->first, std::move(it->second.first)));
+          OUTCOME_TRY(batch.put(it->first, std::move(it->second.first)));
           known_.emplace(it->first);
+          nodes.erase(it);
         }
         for (level.branchInit(); not level.branch_end; level.branchNext()) {
           if (not level.branch_hash or isKnown(*level.branch_hash)) {
@@ -125,9 +270,13 @@ namespace kagome::network {
           break;
         }
         if (level.branch_end) {
-          auto &t = level.stack.back().t;
-          OUTCOME_TRY(node_db_->put(t.hash, std::move(t.encoded)));
-          known_.emplace(t.hash);
+          // root of partition is stored by flow it was split from
+          if (not partition_ or levels_.size() != 1
+              or level.stack.size() != 1) {
+            auto &t = level.stack.back().t;
+            OUTCOME_TRY(batch.put(t.hash, std::move(t.encoded)));
+            known_.emplace(t.hash);
+          }
           level.pop();
           if (not level.stack.empty()) {
             level.branchNext();
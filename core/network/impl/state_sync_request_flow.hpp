@@ -12,6 +12,8 @@
 #include "network/types/state_request.hpp"
 #include "network/types/state_response.hpp"
 #include "primitives/block_header.hpp"
+#include "storage/buffer_map_types.hpp"
+#include "storage/trie/compact_decode.hpp"
 #include "storage/trie/raw_cursor.hpp"
 
 namespace kagome::storage::trie {
@@ -22,6 +24,9 @@ namespace kagome::network {
   /**
    * Recursive coroutine to fetch missing trie nodes with "/state/2" protocol.
    *
+   * State may be split into partitions, one per missing child of the state
+   * root node, which are fetched independently, e.g. from different peers.
+   *
    * https://github.com/paritytech/substrate/blob/master/client/network/sync/src/state.rs
    */
   class StateSyncRequestFlow {
@@ -46,6 +51,11 @@ namespace kagome::network {
       return block_.state_root;
     }
 
+    /// Index of root node child fetched by this flow, if it is a partition
+    auto &partition() const {
+      return partition_;
+    }
+
     bool complete() const {
       return done_;
     }
@@ -54,16 +64,67 @@ namespace kagome::network {
 
     outcome::result<void> onResponse(const StateResponse &res);
 
+    /**
+     * Same as `onResponse`, but leaves nodes which are not part of this flow
+     * in \arg rest.
+     * Peers don't know where partition ends, so response for partition may
+     * contain nodes of following partitions.
+     */
+    outcome::result<void> onResponse(const StateResponse &res,
+                                     storage::trie::CompactDecoded &rest);
+
+    /**
+     * Stores nodes of this flow from \arg nodes, e.g. left from response for
+     * other partition, and removes them from \arg nodes
+     */
+    outcome::result<void> onNodes(storage::trie::CompactDecoded &nodes);
+
+    /**
+     * Splits remaining state into partitions after the state root node was
+     * received.
+     * Returns nothing if root node was not received yet or is not a branch.
+     * This flow may be continued with `resume` when all partitions complete.
+     */
+    std::vector<StateSyncRequestFlow> partitions();
+
+    /**
+     * Continues with nodes stored by partitions of this flow
+     */
+    outcome::result<void> resume();
+
+    /**
+     * Next request starts with \arg start, e.g. of a request which was sent
+     * by this flow before restart
+     */
+    void setStart(std::vector<common::Buffer> start);
+
+    /**
+     * Whether \arg start of some request points into keys of this flow
+     */
+    bool contains(const std::vector<common::Buffer> &start) const;
+
    private:
+    StateSyncRequestFlow(
+        std::shared_ptr<storage::trie::TrieStorageBackend> node_db,
+        const primitives::BlockInfo &block_info,
+        const primitives::BlockHeader &block,
+        const Level::Item &root,
+        uint8_t partition);
+
+    outcome::result<void> process(storage::trie::CompactDecoded &nodes,
+                                  storage::BufferBatch &batch);
+
     bool isKnown(const common::Hash256 &hash);
 
     std::shared_ptr<storage::trie::TrieStorageBackend> node_db_;
 
     primitives::BlockInfo block_info_;
     primitives::BlockHeader block_;
+    std::optional<uint8_t> partition_;
 
     std::vector<Level> levels_;
     std::unordered_set<common::Hash256> known_;
+    std::vector<common::Buffer> start_;
 
     size_t stat_count_ = 0, stat_size_ = 0;
 
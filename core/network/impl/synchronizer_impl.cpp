@@ -66,7 +66,13 @@ OUTCOME_CPP_DEFINE_CATEGORY(kagome::network, SynchronizerImpl::Error, e) {
 namespace {
   constexpr const char *kImportQueueLength =
       "kagome_import_queue_blocks_submitted";
+  constexpr const char *kStateSyncBytes = "kagome_state_sync_bytes";
+  constexpr const char *kStateSyncResponses = "kagome_state_sync_responses";
+  constexpr const char *kStateSyncPeers = "kagome_state_sync_peers";
   constexpr auto kLoadBlocksMaxExpire = std::chrono::seconds{5};
+  /// Interval between writes of state sync progress, fetched again after
+  /// restart at most
+  constexpr auto kStateSyncStartsSaveInterval = std::chrono::seconds{10};
 
   constexpr auto kRandomWarpInterval = std::chrono::minutes{1};
 
@@ -112,7 +118,8 @@ namespace kagome::network {
       std::shared_ptr<Beefy> beefy,
       std::shared_ptr<consensus::grandpa::Environment> grandpa_environment,
       common::MainThreadPool &main_thread_pool,
-      std::shared_ptr<blockchain::BlockStorage> block_storage)
+      std::shared_ptr<blockchain::BlockStorage> block_storage,
+      std::shared_ptr<storage::SpacedStorage> db)
       : log_(log::createLogger("Synchronizer", "synchronizer")),
         block_tree_(std::move(block_tree)),
         block_appender_(std::move(block_appender)),
@@ -132,6 +139,8 @@ namespace kagome::network {
             poolHandlerReadyMake(app_state_manager, main_thread_pool)},
         block_storage_{std::move(block_storage)},
         max_parallel_downloads_{app_config.maxParallelDownloads()},
+        max_state_sync_peers_{app_config.maxStateSyncPeers()},
+        db_{db->getSpace(storage::Space::kDefault)},
         random_gen_{std::random_device{}()} {
     BOOST_ASSERT(block_tree_);
     BOOST_ASSERT(block_executor_);
@@ -145,6 +154,7 @@ namespace kagome::network {
     BOOST_ASSERT(chain_sub_engine_);
     BOOST_ASSERT(main_pool_handler_);
     BOOST_ASSERT(block_storage_);
+    BOOST_ASSERT(db_);
 
     sync_method_ = app_config.syncMethod();
 
@@ -154,6 +164,20 @@ namespace kagome::network {
     metric_import_queue_length_ =
         metrics_registry_->registerGaugeMetric(kImportQueueLength);
     metric_import_queue_length_->set(0);
+    metrics_registry_->registerCounterFamily(
+        kStateSyncBytes, "Size of state sync responses received from peers");
+    metric_state_sync_bytes_ =
+        metrics_registry_->registerCounterMetric(kStateSyncBytes);
+    metrics_registry_->registerCounterFamily(
+        kStateSyncResponses,
+        "Number of state sync responses received from peers");
+    metric_state_sync_responses_ =
+        metrics_registry_->registerCounterMetric(kStateSyncResponses);
+    metrics_registry_->registerGaugeFamily(
+        kStateSyncPeers, "Number of peers state partitions are fetched from");
+    metric_state_sync_peers_ =
+        metrics_registry_->registerGaugeMetric(kStateSyncPeers);
+    metric_state_sync_peers_->set(0);
 
     app_state_manager.takeControl(*this);
   }
@@ -919,13 +943,34 @@ namespace kagome::network {
     }
     if (not state_sync_flow_ or state_sync_flow_->blockInfo() != block) {
       state_sync_flow_.emplace(trie_node_db_, block, header);
+      state_sync_partitions_.clear();
+      ++state_sync_epoch_;
+      state_sync_starts_.clear();
+      if (auto raw = db_->tryGet(storage::kStateSyncStartsKey);
+          raw and raw.value()) {
+        auto saved = scale::decode<
+            std::tuple<primitives::BlockInfo,
+                       std::vector<std::vector<common::Buffer>>>>(*raw.value());
+        if (saved and std::get<0>(saved.value()) == block) {
+          state_sync_starts_ = std::move(std::get<1>(saved.value()));
+        }
+      }
+      if (not state_sync_starts_.empty()) {
+        // starts are sorted, all state before first one is already stored
+        state_sync_flow_->setStart(state_sync_starts_.front());
+      }
     }
+    state_sync_failed_peers_.clear();
     state_sync_.emplace(StateSync{
         .peer = peer_id,
         .cb = std::move(handler),
     });
     SL_INFO(log_, "Sync of state for block {} has started", block);
-    syncState();
+    if (state_sync_partitions_.empty()) {
+      syncState();
+    } else {
+      syncStatePartitions(lock);
+    }
   }
 
   void SynchronizerImpl::syncState() {
@@ -939,19 +984,22 @@ namespace kagome::network {
     auto protocol = router_->getStateProtocol();
     BOOST_ASSERT_MSG(protocol, "Router did not provide state protocol");
 
-    auto response_handler = [wp{weak_from_this()}](auto &&_res) mutable {
+    auto response_handler = [wp{weak_from_this()},
+                             peer{state_sync_->peer},
+                             time{std::chrono::steady_clock::now()}](
+                                auto &&_res) mutable {
       auto self = wp.lock();
       if (not self) {
         return;
       }
       std::unique_lock lock{self->state_sync_mutex_};
+      if (_res) {
+        self->onStateResponse(
+            peer, _res.value(), std::chrono::steady_clock::now() - time);
+      }
       auto ok = self->syncState(lock, std::move(_res));
       if (not ok) {
-        auto cb = std::move(self->state_sync_->cb);
-        SL_WARN(self->log_, "State syncing failed with error: {}", ok.error());
-        self->state_sync_.reset();
-        lock.unlock();
-        cb(ok.error());
+        self->failStateSync(lock, ok.error());
       }
     };
 
@@ -965,14 +1013,280 @@ namespace kagome::network {
     OUTCOME_TRY(res, std::move(_res));
     setHangTimer();
     OUTCOME_TRY(state_sync_flow_->onResponse(res));
-    if (not state_sync_flow_->complete()) {
-      syncState();
+    if (state_sync_flow_->complete()) {
+      return finishStateSync(lock);
+    }
+    if (max_state_sync_peers_ > 1) {
+      auto partitions = state_sync_flow_->partitions();
+      if (not partitions.empty()) {
+        SL_INFO(log_,
+                "State of block {} is split into {} partitions",
+                state_sync_flow_->blockInfo(),
+                partitions.size());
+        for (auto &flow : partitions) {
+          for (auto &start : state_sync_starts_) {
+            if (flow.contains(start)) {
+              flow.setStart(start);
+              break;
+            }
+          }
+          state_sync_partitions_.emplace_back(StateSyncPartition{
+              .flow = std::move(flow),
+              .peer = std::nullopt,
+          });
+        }
+        state_sync_starts_.clear();
+        saveStateSyncStarts();
+        syncStatePartitions(lock);
+        return outcome::success();
+      }
+    }
+    state_sync_starts_.clear();
+    saveStateSyncStarts();
+    syncState();
+    return outcome::success();
+  }
+
+  void SynchronizerImpl::syncStatePartitions(
+      std::unique_lock<std::mutex> &lock) {
+    auto in_progress = false, complete = true;
+    for (size_t i = 0; i < state_sync_partitions_.size(); ++i) {
+      auto &partition = state_sync_partitions_[i];
+      if (partition.flow.complete()) {
+        continue;
+      }
+      complete = false;
+      if (not partition.peer) {
+        partition.peer = chooseStatePeer();
+        if (not partition.peer) {
+          continue;
+        }
+        syncStatePartition(i);
+      }
+      in_progress = true;
+    }
+    updateStateSyncPeers();
+    if (complete) {
+      state_sync_partitions_.clear();
+      ++state_sync_epoch_;
+      auto ok = state_sync_flow_->resume();
+      if (ok and state_sync_flow_->complete()) {
+        ok = finishStateSync(lock);
+      } else if (ok) {
+        // some node is still missing, continue without partitions
+        syncState();
+      }
+      if (not ok) {
+        failStateSync(lock, ok.error());
+      }
+      return;
+    }
+    if (not in_progress) {
+      SL_WARN(log_, "No peers left to fetch state partitions from");
+      failStateSync(lock, Error::EMPTY_RESPONSE);
+    }
+  }
+
+  void SynchronizerImpl::syncStatePartition(size_t index) {
+    auto &partition = state_sync_partitions_[index];
+    SL_TRACE(log_,
+             "State sync request for partition {:x} has sent to {} for block "
+             "{}",
+             partition.flow.partition().value_or(0),
+             *partition.peer,
+             partition.flow.blockInfo());
+
+    auto request = partition.flow.nextRequest();
+
+    auto protocol = router_->getStateProtocol();
+    BOOST_ASSERT_MSG(protocol, "Router did not provide state protocol");
+
+    auto response_handler = [wp{weak_from_this()},
+                             index,
+                             peer{*partition.peer},
+                             epoch{state_sync_epoch_},
+                             time{std::chrono::steady_clock::now()}](
+                                auto &&_res) mutable {
+      auto self = wp.lock();
+      if (not self) {
+        return;
+      }
+      std::unique_lock lock{self->state_sync_mutex_};
+      if (epoch != self->state_sync_epoch_ or not self->state_sync_) {
+        return;
+      }
+      self->onStatePartition(lock,
+                             index,
+                             peer,
+                             std::move(_res),
+                             std::chrono::steady_clock::now() - time);
+    };
+
+    protocol->request(
+        *partition.peer, std::move(request), std::move(response_handler));
+  }
+
+  void SynchronizerImpl::onStatePartition(
+      std::unique_lock<std::mutex> &lock,
+      size_t index,
+      const libp2p::peer::PeerId &peer,
+      outcome::result<StateResponse> &&_res,
+      std::chrono::steady_clock::duration duration) {
+    auto &partition = state_sync_partitions_[index];
+    auto ok = [&]() -> outcome::result<void> {
+      OUTCOME_TRY(res, std::move(_res));
+      setHangTimer();
+      onStateResponse(peer, res, duration);
+      if (partition.flow.complete()) {
+        // completed with nodes of other partition response
+        return outcome::success();
+      }
+      storage::trie::CompactDecoded rest;
+      OUTCOME_TRY(partition.flow.onResponse(res, rest));
+      // peer doesn't stop at end of partition, so nodes after it are used by
+      // following partitions instead of being fetched again
+      for (auto i = index + 1;
+           i < state_sync_partitions_.size() and not rest.empty();
+           ++i) {
+        auto &next = state_sync_partitions_[i].flow;
+        if (next.complete()) {
+          continue;
+        }
+        // response of this partition is already applied, so the peer is not
+        // blamed, and the following partition fetches its nodes itself
+        if (auto r = next.onNodes(rest); not r) {
+          SL_WARN(log_,
+                  "State partition {:x} failed to use nodes of other "
+                  "response: {}",
+                  next.partition().value_or(0),
+                  r.error());
+          break;
+        }
+      }
       return outcome::success();
+    }();
+    if (not ok) {
+      SL_WARN(log_,
+              "State partition {:x} syncing with {} failed with error: {}",
+              partition.flow.partition().value_or(0),
+              peer,
+              ok.error());
+      state_sync_failed_peers_.emplace(peer);
+      partition.peer.reset();
+    } else if (not partition.flow.complete()) {
+      saveStateSyncStarts();
+      syncStatePartition(index);
+      return;
+    } else {
+      SL_INFO(log_,
+              "State partition {:x} syncing has finished",
+              partition.flow.partition().value_or(0));
+      partition.peer.reset();
+      saveStateSyncStarts();
+    }
+    syncStatePartitions(lock);
+  }
+
+  std::optional<libp2p::peer::PeerId> SynchronizerImpl::chooseStatePeer() {
+    std::set<libp2p::peer::PeerId> busy;
+    for (auto &partition : state_sync_partitions_) {
+      if (partition.peer) {
+        busy.emplace(*partition.peer);
+      }
+    }
+    auto free = [&](const libp2p::peer::PeerId &peer) {
+      return not busy.contains(peer)
+         and not state_sync_failed_peers_.contains(peer);
+    };
+    if (free(state_sync_->peer)) {
+      return state_sync_->peer;
+    }
+    if (busy.size() >= max_state_sync_peers_ or not peer_manager_) {
+      return std::nullopt;
+    }
+    return peer_manager_->peerFinalized(state_sync_flow_->blockInfo().number,
+                                        free);
+  }
+
+  void SynchronizerImpl::onStateResponse(
+      const libp2p::peer::PeerId &peer,
+      const StateResponse &res,
+      std::chrono::steady_clock::duration duration) {
+    metric_state_sync_bytes_->inc(res.proof.size());
+    metric_state_sync_responses_->inc();
+    auto ms = std::max<int64_t>(
+        std::chrono::duration_cast<std::chrono::milliseconds>(duration)
+            .count(),
+        1);
+    SL_DEBUG(log_,
+             "State response from {}: {}kb in {}ms, {}kb/s",
+             peer,
+             res.proof.size() >> 10,
+             ms,
+             res.proof.size() * 1000 / ms >> 10);
+  }
+
+  void SynchronizerImpl::updateStateSyncPeers() {
+    metric_state_sync_peers_->set(std::ranges::count_if(
+        state_sync_partitions_,
+        [](const StateSyncPartition &partition) {
+          return partition.peer.has_value();
+        }));
+  }
+
+  void SynchronizerImpl::saveStateSyncStarts() {
+    // older starts are safe to resume from, so progress is not written after
+    // each response
+    auto now = std::chrono::steady_clock::now();
+    if (now - state_sync_starts_saved_ < kStateSyncStartsSaveInterval) {
+      return;
+    }
+    state_sync_starts_saved_ = now;
+    std::vector<std::vector<common::Buffer>> starts;
+    if (state_sync_partitions_.empty()) {
+      if (not state_sync_flow_->complete()) {
+        starts.emplace_back(state_sync_flow_->nextRequest().start);
+      }
+    } else {
+      for (auto &partition : state_sync_partitions_) {
+        if (not partition.flow.complete()) {
+          starts.emplace_back(partition.flow.nextRequest().start);
+        }
+      }
+    }
+    auto ok = db_->put(
+        storage::kStateSyncStartsKey,
+        scale::encode(std::tuple(state_sync_flow_->blockInfo(), starts))
+            .value());
+    if (not ok) {
+      SL_WARN(log_, "Can't save state sync progress: {}", ok.error());
+    }
+  }
+
+  void SynchronizerImpl::failStateSync(std::unique_lock<std::mutex> &lock,
+                                       std::error_code error) {
+    auto cb = std::move(state_sync_->cb);
+    SL_WARN(log_, "State syncing failed with error: {}", error);
+    state_sync_.reset();
+    ++state_sync_epoch_;
+    for (auto &partition : state_sync_partitions_) {
+      partition.peer.reset();
     }
+    updateStateSyncPeers();
+    lock.unlock();
+    cb(error);
+  }
+
+  outcome::result<void> SynchronizerImpl::finishStateSync(
+      std::unique_lock<std::mutex> &lock) {
     OUTCOME_TRY(trie_pruner_->addNewState(state_sync_flow_->root(),
                                           storage::trie::StateVersion::V0));
     auto block = state_sync_flow_->blockInfo();
     state_sync_flow_.reset();
+    ++state_sync_epoch_;
+    if (auto ok = db_->remove(storage::kStateSyncStartsKey); not ok) {
+      SL_WARN(log_, "Can't remove state sync progress: {}", ok.error());
+    }
     SL_INFO(log_, "State syncing block {} has finished.", block);
     chain_sub_engine_->notify(primitives::events::ChainEventType::kNewRuntime,
                               block.hash);
@@ -131,7 +131,8 @@ namespace kagome::network {
         std::shared_ptr<Beefy> beefy,
         std::shared_ptr<consensus::grandpa::Environment> grandpa_environment,
         common::MainThreadPool &main_thread_pool,
-        std::shared_ptr<blockchain::BlockStorage> block_storage);
+        std::shared_ptr<blockchain::BlockStorage> block_storage,
+        std::shared_ptr<storage::SpacedStorage> db);
 
     /** @see AppStateManager::takeControl */
     bool start();
@@ -240,6 +241,35 @@ namespace kagome::network {
     outcome::result<void> syncState(std::unique_lock<std::mutex> &lock,
                                     outcome::result<StateResponse> &&_res);
 
+    /// Sends requests for state partitions to free peers.
+    /// Completes state sync when all partitions are fetched.
+    void syncStatePartitions(std::unique_lock<std::mutex> &lock);
+    void syncStatePartition(size_t index);
+    void onStatePartition(std::unique_lock<std::mutex> &lock,
+                          size_t index,
+                          const libp2p::peer::PeerId &peer,
+                          outcome::result<StateResponse> &&_res,
+                          std::chrono::steady_clock::duration duration);
+
+    /// Chooses peer to fetch next state partition from
+    std::optional<libp2p::peer::PeerId> chooseStatePeer();
+
+    /// Updates state sync metrics, logs transfer rate of \arg peer
+    void onStateResponse(const libp2p::peer::PeerId &peer,
+                         const StateResponse &res,
+                         std::chrono::steady_clock::duration duration);
+
+    /// Persists starts of next state requests to resume after restart, at
+    /// most once per interval
+    void saveStateSyncStarts();
+
+    /// Sets gauge of peers which partitions are being fetched from
+    void updateStateSyncPeers();
+
+    outcome::result<void> finishStateSync(std::unique_lock<std::mutex> &lock);
+    void failStateSync(std::unique_lock<std::mutex> &lock,
+                       std::error_code error);
+
     void fetch(const libp2p::peer::PeerId &peer,
                BlocksRequest request,
                const char *reason,
@@ -274,6 +304,8 @@ namespace kagome::network {
     std::shared_ptr<PoolHandlerReady> main_pool_handler_;
     std::shared_ptr<blockchain::BlockStorage> block_storage_;
     uint32_t max_parallel_downloads_;
+    uint32_t max_state_sync_peers_;
+    std::shared_ptr<storage::BufferStorage> db_;
     std::mt19937 random_gen_;
 
     application::SyncMethod sync_method_;
@@ -281,6 +313,9 @@ namespace kagome::network {
     // Metrics
     metrics::RegistryPtr metrics_registry_ = metrics::createRegistry();
     metrics::Gauge *metric_import_queue_length_;
+    metrics::Counter *metric_state_sync_bytes_;
+    metrics::Counter *metric_state_sync_responses_;
+    metrics::Gauge *metric_state_sync_peers_;
 
     telemetry::Telemetry telemetry_ = telemetry::createTelemetryService();
 
@@ -289,9 +324,23 @@ namespace kagome::network {
       SyncResultHandler cb;
     };
 
+    struct StateSyncPartition {
+      StateSyncRequestFlow flow;
+      std::optional<libp2p::peer::PeerId> peer;
+    };
+
     mutable std::mutex state_sync_mutex_;
     std::optional<StateSyncRequestFlow> state_sync_flow_;
     std::optional<StateSync> state_sync_;
+    /// Partitions of `state_sync_flow_` fetched in parallel
+    std::vector<StateSyncPartition> state_sync_partitions_;
+    /// Starts of requests persisted before restart
+    std::vector<std::vector<common::Buffer>> state_sync_starts_;
+    std::set<libp2p::peer::PeerId> state_sync_failed_peers_;
+    /// Incremented when state sync stops or partitions are replaced, to
+    /// ignore late responses
+    size_t state_sync_epoch_ = 0;
+    std::chrono::steady_clock::time_point state_sync_starts_saved_;
 
     bool node_is_shutting_down_ = false;
 
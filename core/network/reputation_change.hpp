@@ -94,6 +94,9 @@ namespace kagome::network {
       const ReputationChange INVALID_IMPORT_DISPUTE       = {.value = -100, .reason = "Dispute: Import was deemed invalid by dispute-coordinator"};
       const ReputationChange APPARENT_FLOOD_DISPUTE       = {.value = -100, .reason = "Dispute: Peer exceeded the rate limit"};
 
+      // Approval distribution penalties
+      const ReputationChange APPROVAL_FLOOD               = {.value = -100, .reason = "Approval: Peer exceeded the rate limit"};
+
       // Statement distribution penalties
       const ReputationChange INVALID_REQUEST_BITFIELD_SIZE = {.value = -300, .reason = "Statement: Attested candidate request bitfields have wrong size"};
       const ReputationChange UNEXPECTED_MANIFEST_MISSING_KNOWLEDGE = {.value = -100, .reason = "Statement: Unexpected Manifest, missing knowledge for relay parent"};
@@ -4,7 +4,9 @@
  * SPDX-License-Identifier: Apache-2.0
  */
 
+#include <chrono>
 #include <optional>
+#include <thread>
 
 #include <fmt/std.h>
 #include <boost/date_time/posix_time/posix_time.hpp>
@@ -668,8 +670,33 @@ namespace kagome::parachain {
         });
   }
 
+  common::Buffer approvalSigningPayload(
+      const std::vector<CandidateHash> &candidate_hashes,
+      SessionIndex session_index) {
+    static constexpr std::array<uint8_t, 4> kMagic{'A', 'P', 'P', 'R'};
+    // single candidate approval is signed the same way as by V1 votes
+    if (candidate_hashes.size() == 1) {
+      return common::Buffer{
+          scale::encode(
+              std::make_tuple(kMagic, candidate_hashes[0], session_index))
+              .value()};
+    }
+    return common::Buffer{
+        scale::encode(std::make_tuple(kMagic, candidate_hashes, session_index))
+            .value()};
+  }
+
   constexpr auto kMetricNoShowsTotal =
       "kagome_parachain_approvals_no_shows_total";
+  constexpr auto kMetricIncomingQueueSize =
+      "kagome_parachain_approval_incoming_queue_size";
+  constexpr auto kMetricIncomingVerificationTime =
+      "kagome_parachain_approval_incoming_verification_time";
+
+  /// Limits the number of queued messages verified together.
+  constexpr size_t kMaxIncomingBatch = 2048;
+  /// Messages from peers beyond it are dropped.
+  constexpr size_t kMaxIncomingQueue = 16 * kMaxIncomingBatch;
 
   ApprovalDistribution::ApprovalDistribution(
       std::shared_ptr<consensus::babe::BabeConfigRepository> babe_config_repo,
@@ -691,7 +718,8 @@ namespace kagome::parachain {
       ApprovalThreadPool &approval_thread_pool,
       common::MainThreadPool &main_thread_pool,
       LazySPtr<dispute::DisputeCoordinator> dispute_coordinator,
-      std::shared_ptr<authority_discovery::Query> query_audi)
+      std::shared_ptr<authority_discovery::Query> query_audi,
+      std::shared_ptr<network::ReputationRepository> reputation_repository)
       : approval_thread_handler_{poolHandlerReadyMake(
             this, app_state_manager, approval_thread_pool, logger_)},
         worker_pool_handler_{worker_thread_pool.handler(*app_state_manager)},
@@ -713,6 +741,7 @@ namespace kagome::parachain {
         main_pool_handler_{main_thread_pool.handler(*app_state_manager)},
         dispute_coordinator_{dispute_coordinator},
         query_audi_(std::move(query_audi)),
+        reputation_repository_(std::move(reputation_repository)),
         scheduler_{std::make_shared<libp2p::basic::SchedulerImpl>(
             std::make_shared<libp2p::basic::AsioSchedulerBackend>(
                 approval_thread_pool.io_context()),
@@ -734,6 +763,7 @@ namespace kagome::parachain {
     BOOST_ASSERT(worker_pool_handler_);
     BOOST_ASSERT(approval_thread_handler_);
     BOOST_ASSERT(query_audi_);
+    BOOST_ASSERT(reputation_repository_);
 
     metrics_registry_->registerCounterFamily(
         kMetricNoShowsTotal,
@@ -741,6 +771,23 @@ namespace kagome::parachain {
         "subsystem");
     metric_no_shows_total_ =
         metrics_registry_->registerCounterMetric(kMetricNoShowsTotal);
+
+    metrics_registry_->registerHistogramFamily(
+        kMetricIncomingQueueSize,
+        "Number of assignments and approvals from peers, waiting for "
+        "verification when new ones are queued");
+    metric_incoming_queue_size_ = metrics_registry_->registerHistogramMetric(
+        kMetricIncomingQueueSize,
+        {16, 64, 256, 1024, 4096, kMaxIncomingQueue});
+
+    metrics_registry_->registerHistogramFamily(
+        kMetricIncomingVerificationTime,
+        "Time taken to verify a batch of assignments and approvals from peers "
+        "on the worker pool");
+    metric_incoming_verification_time_ =
+        metrics_registry_->registerHistogramMetric(
+            kMetricIncomingVerificationTime,
+            {0.001, 0.0025, 0.005, 0.01, 0.025, 0.05, 0.1, 0.25, 0.5, 1});
   }
 
   bool ApprovalDistribution::tryStart() {
@@ -770,6 +817,30 @@ namespace kagome::parachain {
 
     /// TODO(iceseer): clear `known_by` when peer disconnected
 
+    incoming_ = std::make_shared<IncomingQueue>(
+        IncomingQueue::Config{
+            .capacity = kMaxIncomingQueue,
+            .max_batch = kMaxIncomingBatch,
+            .max_chunks =
+                std::max<size_t>(1, std::thread::hardware_concurrency()),
+        },
+        approval_thread_handler_,
+        worker_pool_handler_,
+        [WEAK_SELF](std::vector<IncomingMessage> &messages) {
+          auto self = weak_self.lock();
+          if (not self) {
+            return IncomingQueue::Checks{};
+          }
+          return self->prepare_signature_checks(messages);
+        },
+        [WEAK_SELF](std::vector<IncomingMessage> messages,
+                    std::chrono::steady_clock::duration verification_time) {
+          WEAK_LOCK(self);
+          self->metric_incoming_verification_time_->observe(
+              std::chrono::duration<double>(verification_time).count());
+          self->import_verified(std::move(messages));
+        });
+
     return true;
   }
 
@@ -1556,6 +1627,7 @@ namespace kagome::parachain {
       storedDistribBlockEntries().set(meta.hash,
                                       DistribBlockEntry{
                                           .candidates = std::move(candidates),
+                                          .subjects = {},
                                           .knowledge = {},
                                           .known_by = {},
                                           .number = meta.number,
@@ -1874,104 +1946,126 @@ namespace kagome::parachain {
   }                                                 \
   auto &name = __##name->get();
 
-  ApprovalDistribution::AssignmentCheckResult
-  ApprovalDistribution::check_and_import_assignment(
+  std::optional<ApprovalDistribution::AssignmentClaim>
+  ApprovalDistribution::assignment_claim(
+      const BlockEntry &block_entry,
       const approval::IndirectAssignmentCertV2 &assignment,
       const scale::BitVector &candidate_indices) {
-    BOOST_ASSERT(approval_thread_handler_->isInCurrentThread());
-    const auto tick_now = ::tickNow();
-
-    GET_OPT_VALUE_OR_EXIT(block_entry,
-                          AssignmentCheckResult::Bad,
-                          storedBlockEntries().get(assignment.block_hash));
-
-    std::optional<runtime::SessionInfo> opt_session_info{};
-    if (auto session_info_res = parachain_host_->session_info(
-            block_entry.parent_hash, block_entry.session);
-        session_info_res.has_value()) {
-      opt_session_info = std::move(session_info_res.value());
-    } else {
-      SL_WARN(logger_,
-              "Assignment. Session info runtime request failed. "
-              "(parent_hash={}, session_index={}, error={})",
-              block_entry.parent_hash,
-              block_entry.session,
-              session_info_res.error());
-      return AssignmentCheckResult::Bad;
-    }
-
-    if (!opt_session_info) {
-      logger_->debug(
-          "Can't obtain SessionInfo. (parent_hash={}, session_index={})",
-          block_entry.parent_hash,
-          block_entry.session);
-      return AssignmentCheckResult::Bad;
-    }
-
-    runtime::SessionInfo &session_info = *opt_session_info;
-    const auto n_cores = size_t(session_info.n_cores);
-
-    // Early check the candidate bitfield and core bitfields lengths <
-    // `n_cores`. Core bitfield length is checked later in
-    // `check_assignment_cert`.
-    if (candidate_indices.size() > n_cores) {
-      SL_TRACE(logger_,
-               "Oversized bitfield. (validator={}, n_cores={}, "
-               "candidate_bitfield_len={})",
-               assignment.validator,
-               n_cores,
-               candidate_indices.size());
-      return AssignmentCheckResult::Bad;
-    }
-
-    std::vector<GroupIndex> backing_groups;
+    AssignmentClaim claim;
     std::vector<CoreIndex> claimed_core_indices;
-    std::vector<CandidateHash> assigned_candidate_hashes;
 
     for (size_t candidate_index = 0; candidate_index < candidate_indices.size();
          ++candidate_index) {
       if (!candidate_indices[candidate_index]) {
         continue;
       }
+      if (candidate_index >= block_entry.candidates.size()) {
+        return std::nullopt;
+      }
 
       auto &[claimed_core_index, assigned_candidate_hash] =
           block_entry.candidates[candidate_index];
 
       GET_OPT_VALUE_OR_EXIT(
           candidate_entry,
-          AssignmentCheckResult::Bad,
+          std::nullopt,
           storedCandidateEntries().get(assigned_candidate_hash));
 
       GET_OPT_VALUE_OR_EXIT(
           approval_entry,
-          AssignmentCheckResult::Bad,
+          std::nullopt,
           candidate_entry.approval_entry(assignment.block_hash));
 
-      backing_groups.emplace_back(approval_entry.backing_group);
+      claim.backing_groups.emplace_back(approval_entry.backing_group);
       claimed_core_indices.emplace_back(claimed_core_index);
-      assigned_candidate_hashes.emplace_back(assigned_candidate_hash);
+      claim.candidate_hashes.emplace_back(assigned_candidate_hash);
     }
 
     // Error on null assignments.
     if (claimed_core_indices.empty()) {
-      return AssignmentCheckResult::Bad;
+      return std::nullopt;
     }
 
-    scale::BitVector bits;
     for (const auto ci : claimed_core_indices) {
-      if (ci >= bits.size()) {
-        bits.resize(ci + 1);
+      if (ci >= claim.cores.size()) {
+        claim.cores.resize(ci + 1);
+      }
+      claim.cores[ci] = true;
+    }
+    return claim;
+  }
+
+  ApprovalDistribution::AssignmentCheckResult
+  ApprovalDistribution::check_and_import_assignment(
+      const approval::IndirectAssignmentCertV2 &assignment,
+      const scale::BitVector &candidate_indices,
+      const Verified &verified) {
+    BOOST_ASSERT(approval_thread_handler_->isInCurrentThread());
+    const auto tick_now = ::tickNow();
+
+    GET_OPT_VALUE_OR_EXIT(block_entry,
+                          AssignmentCheckResult::Bad,
+                          storedBlockEntries().get(assignment.block_hash));
+
+    auto session_info_ptr = verified.session_info;
+    if (!session_info_ptr) {
+      std::optional<runtime::SessionInfo> opt_session_info{};
+      if (auto session_info_res = parachain_host_->session_info(
+              block_entry.parent_hash, block_entry.session);
+          session_info_res.has_value()) {
+        opt_session_info = std::move(session_info_res.value());
+      } else {
+        SL_WARN(logger_,
+                "Assignment. Session info runtime request failed. "
+                "(parent_hash={}, session_index={}, error={})",
+                block_entry.parent_hash,
+                block_entry.session,
+                session_info_res.error());
+        return AssignmentCheckResult::Bad;
       }
-      bits[ci] = true;
+
+      if (!opt_session_info) {
+        logger_->debug(
+            "Can't obtain SessionInfo. (parent_hash={}, session_index={})",
+            block_entry.parent_hash,
+            block_entry.session);
+        return AssignmentCheckResult::Bad;
+      }
+      session_info_ptr = std::make_shared<const runtime::SessionInfo>(
+          std::move(*opt_session_info));
+    }
+
+    const runtime::SessionInfo &session_info = *session_info_ptr;
+    const auto n_cores = size_t(session_info.n_cores);
+
+    // Early check the candidate bitfield and core bitfields lengths <
+    // `n_cores`. Core bitfield length is checked later in
+    // `check_assignment_cert`.
+    if (candidate_indices.size() > n_cores) {
+      SL_TRACE(logger_,
+               "Oversized bitfield. (validator={}, n_cores={}, "
+               "candidate_bitfield_len={})",
+               assignment.validator,
+               n_cores,
+               candidate_indices.size());
+      return AssignmentCheckResult::Bad;
     }
 
+    auto claim = assignment_claim(block_entry, assignment, candidate_indices);
+    if (!claim) {
+      return AssignmentCheckResult::Bad;
+    }
+    const auto &assigned_candidate_hashes = claim->candidate_hashes;
+
     DelayTranche tranche;  // NOLINT(cppcoreguidelines-init-variables)
-    if (auto res = checkAssignmentCert(bits,
-                                       assignment.validator,
-                                       session_info,
-                                       block_entry.relay_vrf_story,
-                                       assignment.cert,
-                                       backing_groups);
+    if (auto res = verified.cert
+                     ? *verified.cert
+                     : checkAssignmentCert(claim->cores,
+                                           assignment.validator,
+                                           session_info,
+                                           block_entry.relay_vrf_story,
+                                           assignment.cert,
+                                           claim->backing_groups);
         res.has_value()) {
       const auto current_tranche =
           ::trancheNow(config_.slot_duration_millis, block_entry.slot);
@@ -2037,7 +2131,8 @@ namespace kagome::parachain {
 
   ApprovalDistribution::ApprovalCheckResult
   ApprovalDistribution::check_and_import_approval(
-      const approval::IndirectSignedApprovalVoteV2 &approval) {
+      const approval::IndirectSignedApprovalVoteV2 &approval,
+      const Verified &verified) {
     GET_OPT_VALUE_OR_EXIT(
         block_entry,
         ApprovalCheckResult::Bad,
@@ -2064,32 +2159,63 @@ namespace kagome::parachain {
       return ApprovalCheckResult::Bad;
     }
 
-    std::optional<runtime::SessionInfo> opt_session_info;
-    if (auto session_info_res = parachain_host_->session_info(
-            approval.payload.payload.block_hash, block_entry.session);
-        session_info_res.has_value()) {
-      opt_session_info = std::move(session_info_res.value());
-    } else {
-      logger_->warn(
-          "Approval. Session info runtime request failed. (block_hash={}, "
-          "session_index={}, error={})",
-          approval.payload.payload.block_hash,
-          block_entry.session,
-          session_info_res.error());
-      return ApprovalCheckResult::Bad;
+    auto session_info_ptr = verified.session_info;
+    if (!session_info_ptr) {
+      std::optional<runtime::SessionInfo> opt_session_info;
+      if (auto session_info_res = parachain_host_->session_info(
+              approval.payload.payload.block_hash, block_entry.session);
+          session_info_res.has_value()) {
+        opt_session_info = std::move(session_info_res.value());
+      } else {
+        logger_->warn(
+            "Approval. Session info runtime request failed. (block_hash={}, "
+            "session_index={}, error={})",
+            approval.payload.payload.block_hash,
+            block_entry.session,
+            session_info_res.error());
+        return ApprovalCheckResult::Bad;
+      }
+
+      if (!opt_session_info) {
+        logger_->debug(
+            "Can't obtain SessionInfo. (parent_hash={}, session_index={})",
+            approval.payload.payload.block_hash,
+            block_entry.session);
+        return ApprovalCheckResult::Bad;
+      }
+      session_info_ptr = std::make_shared<const runtime::SessionInfo>(
+          std::move(*opt_session_info));
     }
 
-    if (!opt_session_info) {
-      logger_->debug(
-          "Can't obtain SessionInfo. (parent_hash={}, session_index={})",
-          approval.payload.payload.block_hash,
-          block_entry.session);
+    const runtime::SessionInfo &session_info = *session_info_ptr;
+    if (approval.payload.ix >= session_info.validators.size()) {
+      SL_WARN(logger_,
+              "Approval from unknown validator. (validator index={})",
+              approval.payload.ix);
       return ApprovalCheckResult::Bad;
     }
-
-    runtime::SessionInfo &session_info = *opt_session_info;
     const auto &pubkey = session_info.validators[approval.payload.ix];
 
+    auto signature_valid = verified.signature;
+    if (!signature_valid) {
+      std::vector<CandidateHash> candidate_hashes;
+      for (const auto &info : approved_candidates_info) {
+        candidate_hashes.emplace_back(info.second);
+      }
+      auto res = crypto_provider_->verify(
+          approval.signature,
+          approvalSigningPayload(candidate_hashes, block_entry.session),
+          pubkey);
+      signature_valid = res.has_value() && res.value();
+    }
+    if (!*signature_valid) {
+      SL_WARN(logger_,
+              "Invalid approval signature. (block hash={}, validator={})",
+              approval.payload.payload.block_hash,
+              approval.payload.ix);
+      return ApprovalCheckResult::Bad;
+    }
+
     for (const auto &[approval_candidate_index, approved_candidate_hash] :
          approved_candidates_info) {
       GET_OPT_VALUE_OR_EXIT(
@@ -2137,7 +2263,8 @@ namespace kagome::parachain {
   void ApprovalDistribution::import_and_circulate_assignment(
       const MessageSource &source,
       const approval::IndirectAssignmentCertV2 &assignment,
-      const scale::BitVector &claimed_candidate_indices) {
+      const scale::BitVector &claimed_candidate_indices,
+      const Verified &verified) {
     BOOST_ASSERT(approval_thread_handler_->isInCurrentThread());
     const auto &block_hash = assignment.block_hash;
     const auto validator_index = assignment.validator;
@@ -2164,14 +2291,16 @@ namespace kagome::parachain {
     auto &entry = opt_entry->get();
     auto message_subject{std::make_tuple(
         block_hash, claimed_candidate_indices, validator_index)};
+    // interned only when the assignment is accepted
+    auto subject = entry.subjects.find(message_subject);
     const auto message_kind{approval::MessageKind::Assignment};
 
     if (source) {
       const auto &peer_id = source->get();
       if (auto it = entry.known_by.find(peer_id); it != entry.known_by.end()) {
         auto &peer_knowledge = it->second;
-        if (peer_knowledge.contains(message_subject, message_kind)) {
-          if (!peer_knowledge.received.insert(message_subject, message_kind)) {
+        if (peer_knowledge.contains(subject, message_kind)) {
+          if (!peer_knowledge.received.insert(subject, message_kind)) {
             SL_TRACE(logger_,
                      "Duplicate assignment. (peer id={}, block hash={}, "
                      "validator index={})",
@@ -2191,22 +2320,23 @@ namespace kagome::parachain {
       }
 
       /// if the assignment is known to be valid, reward the peer
-      if (entry.knowledge.contains(message_subject, message_kind)) {
+      if (entry.knowledge.contains(subject, message_kind)) {
         /// TODO(iceseer): modify reputation
         if (auto it = entry.known_by.find(peer_id);
             it != entry.known_by.end()) {
           SL_TRACE(logger_, "Known assignment. (peer id={})", peer_id);
-          it->second.received.insert(message_subject, message_kind);
+          it->second.received.insert(subject, message_kind);
         }
       }
 
-      switch (
-          check_and_import_assignment(assignment, claimed_candidate_indices)) {
+      switch (check_and_import_assignment(
+          assignment, claimed_candidate_indices, verified)) {
         case AssignmentCheckResult::Accepted: {
-          entry.knowledge.insert(message_subject, message_kind);
+          subject = entry.subjects.intern(message_subject);
+          entry.knowledge.insert(subject, message_kind);
           if (auto it = entry.known_by.find(peer_id);
               it != entry.known_by.end()) {
-            it->second.received.insert(message_subject, message_kind);
+            it->second.received.insert(subject, message_kind);
           }
         } break;
         case AssignmentCheckResult::Bad: {
@@ -2228,7 +2358,8 @@ namespace kagome::parachain {
           if (auto it = entry.known_by.find(peer_id);
               it != entry.known_by.end()) {
             auto &peer_knowledge = it->second;
-            peer_knowledge.received.insert(message_subject, message_kind);
+            subject = entry.subjects.intern(message_subject);
+            peer_knowledge.received.insert(subject, message_kind);
           }
           SL_TRACE(logger_,
                    "Got an `AcceptedDuplicate` assignment. (peer id={}, block "
@@ -2239,7 +2370,8 @@ namespace kagome::parachain {
           return;
       }
     } else {
-      if (!entry.knowledge.insert(message_subject, message_kind)) {
+      subject = entry.subjects.intern(message_subject);
+      if (!entry.knowledge.insert(subject, message_kind)) {
         SL_WARN(logger_,
                 "Importing locally an already known assignment. "
                 "(block_hash={}, validator index={})",
@@ -2404,7 +2536,7 @@ namespace kagome::parachain {
       if ((!source || peer_id != source->get())
           && peer_filter(peer_id, peer_knowledge)) {
         peers.insert(peer_id);
-        peer_knowledge.sent.insert(message_subject, message_kind);
+        peer_knowledge.sent.insert(subject, message_kind);
       }
     }
 
@@ -2416,7 +2548,8 @@ namespace kagome::parachain {
 
   void ApprovalDistribution::import_and_circulate_approval(
       const MessageSource &source,
-      const approval::IndirectSignedApprovalVoteV2 &vote) {
+      const approval::IndirectSignedApprovalVoteV2 &vote,
+      const Verified &verified) {
     BOOST_ASSERT(approval_thread_handler_->isInCurrentThread());
     const auto &block_hash = vote.payload.payload.block_hash;
     const auto validator_index = vote.payload.ix;
@@ -2445,11 +2578,14 @@ namespace kagome::parachain {
     auto &entry = opt_entry->get();
     auto message_subject{
         std::make_tuple(block_hash, candidate_indices, validator_index)};
+    // a remote approval is only accepted with known assignment, so the subject
+    // is interned already
+    auto subject = entry.subjects.find(message_subject);
     const auto message_kind{approval::MessageKind::Approval};
 
     if (source) {
       const auto &peer_id = source->get();
-      if (!entry.knowledge.contains(message_subject,
+      if (!entry.knowledge.contains(subject,
                                     approval::MessageKind::Assignment)) {
         SL_TRACE(logger_,
                  "Unknown approval assignment. (peer id={}, block hash={}, "
@@ -2463,8 +2599,8 @@ namespace kagome::parachain {
       // check if our knowledge of the peer already contains this approval
       if (auto it = entry.known_by.find(peer_id); it != entry.known_by.end()) {
         if (auto &peer_knowledge = it->second;
-            peer_knowledge.contains(message_subject, message_kind)) {
-          if (!peer_knowledge.received.insert(message_subject, message_kind)) {
+            peer_knowledge.contains(subject, message_kind)) {
+          if (!peer_knowledge.received.insert(subject, message_kind)) {
             SL_TRACE(logger_,
                      "Duplicate approval. (peer id={}, block_hash={}, "
                      "validator index={})",
@@ -2484,7 +2620,7 @@ namespace kagome::parachain {
       }
 
       /// if the approval is known to be valid, reward the peer
-      if (entry.knowledge.contains(message_subject, message_kind)) {
+      if (entry.knowledge.contains(subject, message_kind)) {
         SL_TRACE(logger_,
                  "Known approval. (peer id={}, block hash={}, validator={})",
                  peer_id,
@@ -2493,17 +2629,17 @@ namespace kagome::parachain {
 
         if (auto it = entry.known_by.find(peer_id);
             it != entry.known_by.end()) {
-          it->second.received.insert(message_subject, message_kind);
+          it->second.received.insert(subject, message_kind);
         }
         return;
       }
 
-      switch (check_and_import_approval(vote)) {
+      switch (check_and_import_approval(vote, verified)) {
         case ApprovalCheckResult::Accepted: {
-          entry.knowledge.insert(message_subject, message_kind);
+          entry.knowledge.insert(subject, message_kind);
           if (auto it = entry.known_by.find(peer_id);
               it != entry.known_by.end()) {
-            it->second.received.insert(message_subject, message_kind);
+            it->second.received.insert(subject, message_kind);
           }
         } break;
         case ApprovalCheckResult::Bad: {
@@ -2515,7 +2651,8 @@ namespace kagome::parachain {
           return;
       }
     } else {
-      if (!entry.knowledge.insert(message_subject, message_kind)) {
+      subject = entry.subjects.intern(message_subject);
+      if (!entry.knowledge.insert(subject, message_kind)) {
         // if we already imported an approval, there is no need to distribute it
         // again
         SL_WARN(logger_,
@@ -2545,7 +2682,7 @@ namespace kagome::parachain {
     const auto &nar = res.value();
     SL_TRACE(logger_, "NAR. (peers=[{}])", fmt::join(nar.second, ","));
 
-    auto peer_filter = [&nar, &source, &message_subject, &message_kind, &entry](
+    auto peer_filter = [&nar, &source, &subject, &message_kind, &entry](
                            const auto &peer, const auto &peer_kn) {
       if (source && peer == source->get()) {
         return false;
@@ -2564,14 +2701,14 @@ namespace kagome::parachain {
         const auto n_peers_total = entry.known_by.size();
         return random_routing.sample(n_peers_total);
       }
-      return peer_kn.sent.can_send(message_subject, message_kind);
+      return peer_kn.sent.can_send(subject, message_kind);
     };
 
     std::unordered_set<libp2p::peer::PeerId> peers{};
     for (auto &[peer_id, peer_knowledge] : entry.known_by) {
       if (peer_filter(peer_id, peer_knowledge)) {
         peers.insert(peer_id);
-        peer_knowledge.sent.insert(message_subject, message_kind);
+        peer_knowledge.sent.insert(subject, message_kind);
       }
     }
 
@@ -2740,6 +2877,7 @@ namespace kagome::parachain {
       return;
     }
 
+    std::vector<PendingMessage> incoming;
     visit_in_place(
         m->get(),
         [&](const network::vstaging::Assignments &assignments) {
@@ -2761,9 +2899,7 @@ namespace kagome::parachain {
               continue;
             }
 
-            import_and_circulate_assignment(peer_id,
-                                            assignment.indirect_assignment_cert,
-                                            assignment.candidate_bitfield);
+            incoming.emplace_back(assignment);
           }
         },
         [&](const network::vstaging::Approvals &approvals) {
@@ -2785,10 +2921,223 @@ namespace kagome::parachain {
               continue;
             }
 
-            import_and_circulate_approval(peer_id, approval_vote);
+            incoming.emplace_back(approval_vote);
           }
         },
         [&](const auto &) { UNREACHABLE; });
+
+    queue_incoming(peer_id, std::move(incoming));
+  }
+
+  void ApprovalDistribution::queue_incoming(
+      const libp2p::peer::PeerId &peer_id,
+      std::vector<PendingMessage> messages) {
+    BOOST_ASSERT(approval_thread_handler_->isInCurrentThread());
+    size_t dropped = 0;
+    for (auto &message : messages) {
+      if (incoming_->full()) {
+        ++dropped;
+        continue;
+      }
+      auto check = prepare_signature_check(message);
+      incoming_->push(IncomingMessage{
+          .peer_id = peer_id,
+          .message = std::move(message),
+          .check = std::move(check),
+      });
+    }
+    if (dropped != 0) {
+      SL_DEBUG(logger_,
+               "Incoming queue is full, messages dropped.(peer_id={}, "
+               "count={})",
+               peer_id,
+               dropped);
+      reputation_repository_->change(
+          peer_id, network::reputation::cost::APPROVAL_FLOOD * dropped);
+    }
+    metric_incoming_queue_size_->observe(incoming_->size());
+    incoming_->verify();
+  }
+
+  std::optional<ApprovalDistribution::SignatureCheck>
+  ApprovalDistribution::prepare_signature_check(
+      const PendingMessage &message) {
+    return visit_in_place(
+        message,
+        [&](const network::vstaging::Assignment &assignment)
+            -> std::optional<SignatureCheck> {
+          const auto &cert = assignment.indirect_assignment_cert;
+          auto block_entry = storedBlockEntries().get(cert.block_hash);
+          if (!block_entry) {
+            return std::nullopt;
+          }
+          auto claim = assignment_claim(
+              block_entry->get(), cert, assignment.candidate_bitfield);
+          if (!claim) {
+            return std::nullopt;
+          }
+          return AssignmentCertCheck{
+              .claim = std::move(*claim),
+              .relay_vrf_story = block_entry->get().relay_vrf_story,
+              .parent_hash = block_entry->get().parent_hash,
+              .session = block_entry->get().session,
+          };
+        },
+        [&](const approval::IndirectSignedApprovalVoteV2 &vote)
+            -> std::optional<SignatureCheck> {
+          const auto &block_hash = vote.payload.payload.block_hash;
+          auto block_entry = storedBlockEntries().get(block_hash);
+          if (!block_entry) {
+            return std::nullopt;
+          }
+          const auto &candidates = block_entry->get().candidates;
+          std::vector<CandidateHash> candidate_hashes;
+          auto r = approval::iter_ones(
+              vote.payload.payload.candidate_indices,
+              [&](const auto candidate_index) -> outcome::result<void> {
+                if (candidate_index >= candidates.size()) {
+                  return ApprovalDistributionError::
+                      CANDIDATE_INDEX_OUT_OF_BOUNDS;
+                }
+                candidate_hashes.emplace_back(
+                    candidates[candidate_index].second);
+                return outcome::success();
+              });
+          if (r.has_error()) {
+            return std::nullopt;
+          }
+          return ApprovalSignatureCheck{
+              .candidate_hashes = std::move(candidate_hashes),
+              .block_hash = block_hash,
+              .session = block_entry->get().session,
+          };
+        });
+  }
+
+  ApprovalDistribution::IncomingQueue::Checks
+  ApprovalDistribution::prepare_signature_checks(
+      std::vector<IncomingMessage> &messages) const {
+    std::map<std::pair<Hash, SessionIndex>,
+             std::shared_ptr<const runtime::SessionInfo>>
+        session_infos;
+    auto get_session_info = [&](const Hash &block_hash, SessionIndex session)
+        -> std::shared_ptr<const runtime::SessionInfo> {
+      auto &session_info = session_infos[std::make_pair(block_hash, session)];
+      if (!session_info) {
+        if (auto res = parachain_host_->session_info(block_hash, session);
+            res.has_value() && res.value()) {
+          session_info = std::make_shared<const runtime::SessionInfo>(
+              std::move(*res.value()));
+        }
+      }
+      return session_info;
+    };
+
+    // indices of identical messages received from several peers
+    std::vector<std::vector<size_t>> identical;
+    std::unordered_map<Hash, size_t> identical_by_hash;
+    for (size_t i = 0; i < messages.size(); ++i) {
+      if (!messages[i].check) {
+        continue;
+      }
+      auto encoded = visit_in_place(messages[i].message, [](const auto &m) {
+        return scale::encode(m).value();
+      });
+      auto [it, inserted] = identical_by_hash.emplace(
+          hasher_->blake2b_256(encoded), identical.size());
+      if (inserted) {
+        identical.emplace_back();
+      }
+      identical[it->second].emplace_back(i);
+    }
+
+    IncomingQueue::Checks checks;
+    for (auto &indices : identical) {
+      const auto &first = messages[indices.front()];
+      auto session_info = visit_in_place(
+          *first.check,
+          [&](const AssignmentCertCheck &check) {
+            return get_session_info(check.parent_hash, check.session);
+          },
+          [&](const ApprovalSignatureCheck &check) {
+            return get_session_info(check.block_hash, check.session);
+          });
+      if (!session_info) {
+        continue;
+      }
+      for (auto i : indices) {
+        messages[i].verified.session_info = session_info;
+      }
+      visit_in_place(
+          *first.check,
+          [&](const AssignmentCertCheck &check) {
+            const auto &assignment =
+                boost::get<network::vstaging::Assignment>(first.message);
+            // oversized bitfield is rejected on import
+            if (assignment.candidate_bitfield.size()
+                > size_t(session_info->n_cores)) {
+              return;
+            }
+            checks.emplace_back([&messages,
+                                 indices{std::move(indices)},
+                                 &check,
+                                 &cert = assignment.indirect_assignment_cert,
+                                 session_info] {
+              auto res = checkAssignmentCert(check.claim.cores,
+                                             cert.validator,
+                                             *session_info,
+                                             check.relay_vrf_story,
+                                             cert.cert,
+                                             check.claim.backing_groups);
+              for (auto i : indices) {
+                messages[i].verified.cert = res;
+              }
+            });
+          },
+          [&](const ApprovalSignatureCheck &check) {
+            const auto &vote =
+                boost::get<approval::IndirectSignedApprovalVoteV2>(
+                    first.message);
+            if (vote.payload.ix >= session_info->validators.size()) {
+              return;
+            }
+            checks.emplace_back([crypto_provider{crypto_provider_},
+                                 &messages,
+                                 indices{std::move(indices)},
+                                 &check,
+                                 &vote,
+                                 session_info] {
+              auto res = crypto_provider->verify(
+                  vote.signature,
+                  approvalSigningPayload(check.candidate_hashes,
+                                         check.session),
+                  session_info->validators[vote.payload.ix]);
+              for (auto i : indices) {
+                messages[i].verified.signature = res.has_value() && res.value();
+              }
+            });
+          });
+    }
+    return checks;
+  }
+
+  void ApprovalDistribution::import_verified(
+      std::vector<IncomingMessage> messages) {
+    BOOST_ASSERT(approval_thread_handler_->isInCurrentThread());
+    for (auto &incoming : messages) {
+      visit_in_place(
+          incoming.message,
+          [&](const network::vstaging::Assignment &assignment) {
+            import_and_circulate_assignment(incoming.peer_id,
+                                            assignment.indirect_assignment_cert,
+                                            assignment.candidate_bitfield,
+                                            incoming.verified);
+          },
+          [&](const approval::IndirectSignedApprovalVoteV2 &vote) {
+            import_and_circulate_approval(
+                incoming.peer_id, vote, incoming.verified);
+          });
+    }
   }
 
   void ApprovalDistribution::runDistributeAssignment(
@@ -3037,9 +3386,7 @@ namespace kagome::parachain {
       logger_->warn("No key pair in store for {}", pubkey);
       return std::nullopt;
     }
-    static std::array<uint8_t, 4ull> kMagic{'A', 'P', 'P', 'R'};
-    auto d = std::make_tuple(kMagic, candidate_hash, session_index);
-    auto payload = scale::encode(d).value();
+    auto payload = approvalSigningPayload({candidate_hash}, session_index);
 
     if (auto res = crypto_provider_->sign(key_pair.value(), payload);
         res.has_value()) {
@@ -3618,8 +3965,10 @@ namespace kagome::parachain {
           const auto approval_messages = approval_entry.get_approvals();
           const auto [assignment_knowledge, message_kind] =
               approval_entry.create_assignment_knowledge(block);
+          const auto assignment_subject =
+              entry.subjects.intern(assignment_knowledge);
 
-          if (!peer_knowledge.contains(assignment_knowledge, message_kind)) {
+          if (!peer_knowledge.contains(assignment_subject, message_kind)) {
             SL_TRACE(logger_,
                      "Want to send assignment. (block_hash={}, "
                      "valdator={}, block={})",
@@ -3627,7 +3976,7 @@ namespace kagome::parachain {
                      assignment_message.first.validator,
                      block);
 
-            peer_knowledge.sent.insert(assignment_knowledge, message_kind);
+            peer_knowledge.sent.insert(assignment_subject, message_kind);
             assignments_to_send.emplace_back(network::vstaging::Assignment{
                 .indirect_assignment_cert = assignment_message.first,
                 .candidate_bitfield = assignment_message.second,
@@ -3635,15 +3984,15 @@ namespace kagome::parachain {
           }
 
           for (const auto &approval_message : approval_messages) {
-            auto approval_knowledge =
+            auto [approval_knowledge, approval_kind] =
                 approval::PeerKnowledge::generate_approval_key(
                     approval_message);
+            const auto approval_subject =
+                entry.subjects.intern(approval_knowledge);
 
-            if (!peer_knowledge.contains(approval_knowledge.first,
-                                         approval_knowledge.second)) {
+            if (!peer_knowledge.contains(approval_subject, approval_kind)) {
               approvals_to_send.emplace_back(approval_message);
-              peer_knowledge.sent.insert(approval_knowledge.first,
-                                         approval_knowledge.second);
+              peer_knowledge.sent.insert(approval_subject, approval_kind);
             }
           }
         }
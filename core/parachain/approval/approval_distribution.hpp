@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include <map>
 #include <unordered_set>
 #include <vector>
 
@@ -28,10 +29,12 @@
 #include "injector/lazy.hpp"
 #include "metrics/metrics.hpp"
 #include "network/peer_view.hpp"
+#include "network/reputation_repository.hpp"
 #include "network/types/collator_messages_vstaging.hpp"
 #include "parachain/approval/approved_ancestor.hpp"
 #include "parachain/approval/knowledge.hpp"
 #include "parachain/approval/store.hpp"
+#include "parachain/approval/verification_queue.hpp"
 #include "parachain/availability/recovery/recovery.hpp"
 #include "parachain/backing/grid.hpp"
 #include "runtime/runtime_api/parachain_host.hpp"
@@ -58,6 +61,17 @@ namespace kagome::parachain {
       const RelayVRFStory &relay_vrf_story,
       const approval::AssignmentCertV2 &assignment,
       const std::vector<GroupIndex> &backing_groups);
+
+  /**
+   * @brief Payload signed by a validator approving candidates
+   * @param candidate_hashes Approved candidates
+   * @param session_index Session of the approving validator
+   * @return Payload of a single candidate approval if one candidate is
+   * approved, otherwise payload of multiple candidates approval
+   */
+  common::Buffer approvalSigningPayload(
+      const std::vector<CandidateHash> &candidate_hashes,
+      SessionIndex session_index);
 }  // namespace kagome::parachain
 
 namespace kagome {
@@ -330,7 +344,8 @@ namespace kagome::parachain {
         ApprovalThreadPool &approval_thread_pool,
         common::MainThreadPool &main_thread_pool,
         LazySPtr<dispute::DisputeCoordinator> dispute_coordinator,
-        std::shared_ptr<authority_discovery::Query> query_audi);
+        std::shared_ptr<authority_discovery::Query> query_audi,
+        std::shared_ptr<network::ReputationRepository> reputation_repository);
     ~ApprovalDistribution() = default;
 
     /// AppStateManager impl
@@ -504,6 +519,9 @@ namespace kagome::parachain {
       /// A votes entry for each candidate indexed by [`CandidateIndex`].
       std::vector<DistribCandidateEntry> candidates{};
 
+      /// Subjects of messages known by us or by peers, indexed by knowledge.
+      approval::MessageSubjects subjects{};
+
       /// Our knowledge of messages.
       approval::Knowledge knowledge{};
 
@@ -687,18 +705,98 @@ namespace kagome::parachain {
     void imported_block_info(const primitives::BlockHash &block_hash,
                              const primitives::BlockHeader &block_header);
 
-    AssignmentCheckResult check_and_import_assignment(
+    /// Result of `checkAssignmentCert`, if it was done ahead.
+    using CheckedCert = std::optional<outcome::result<DelayTranche>>;
+    /// Result of approval signature check, if it was done ahead.
+    using CheckedSignature = std::optional<bool>;
+
+    /// Results of checks done ahead on the worker pool.
+    struct Verified {
+      /// Session info fetched for the checks, reused on import.
+      std::shared_ptr<const runtime::SessionInfo> session_info;
+      CheckedCert cert;
+      CheckedSignature signature;
+    };
+
+    /// Candidates claimed by an assignment.
+    struct AssignmentClaim {
+      /// Cores the claimed candidates are leaving.
+      scale::BitVector cores;
+      std::vector<GroupIndex> backing_groups;
+      std::vector<CandidateHash> candidate_hashes;
+    };
+
+    /// Inputs of assignment certificate check, looked up on the approval
+    /// thread.
+    struct AssignmentCertCheck {
+      AssignmentClaim claim;
+      RelayVRFStory relay_vrf_story;
+      Hash parent_hash;
+      SessionIndex session;
+    };
+
+    /// Inputs of approval signature check, looked up on the approval thread.
+    struct ApprovalSignatureCheck {
+      std::vector<CandidateHash> candidate_hashes;
+      Hash block_hash;
+      SessionIndex session;
+    };
+
+    using SignatureCheck =
+        boost::variant<AssignmentCertCheck, ApprovalSignatureCheck>;
+
+    /// Assignment or approval from a peer, queued for verification.
+    struct IncomingMessage {
+      libp2p::peer::PeerId peer_id;
+      PendingMessage message;
+      /// Unset if the message can't be checked ahead, then it is checked on
+      /// import.
+      std::optional<SignatureCheck> check;
+      Verified verified;
+    };
+
+    using IncomingQueue =
+        approval::VerificationQueue<IncomingMessage, PoolHandlerReady>;
+
+    /// Claimed candidates of \arg assignment for \arg candidate_indices, or
+    /// `nullopt` if the claim is bad.
+    std::optional<AssignmentClaim> assignment_claim(
+        const BlockEntry &block_entry,
         const approval::IndirectAssignmentCertV2 &assignment,
         const scale::BitVector &candidate_indices);
+
+    /// Looks up inputs of the check of \arg message, which is done ahead on
+    /// the worker pool.
+    std::optional<SignatureCheck> prepare_signature_check(
+        const PendingMessage &message);
+    /// Queues messages of \arg peer_id for verification, penalizes the peer
+    /// for the messages dropped because of the full queue.
+    void queue_incoming(const libp2p::peer::PeerId &peer_id,
+                        std::vector<PendingMessage> messages);
+    /// Fetches session infos and builds checks of a batch of \arg messages,
+    /// called on the worker pool. Identical messages received from several
+    /// peers are checked once.
+    IncomingQueue::Checks prepare_signature_checks(
+        std::vector<IncomingMessage> &messages) const;
+    /// Imports verified \arg messages in order of their arrival.
+    void import_verified(std::vector<IncomingMessage> messages);
+
+    AssignmentCheckResult check_and_import_assignment(
+        const approval::IndirectAssignmentCertV2 &assignment,
+        const scale::BitVector &candidate_indices,
+        const Verified &verified = {});
     ApprovalCheckResult check_and_import_approval(
-        const approval::IndirectSignedApprovalVoteV2 &vote);
+        const approval::IndirectSignedApprovalVoteV2 &vote,
+        const Verified &verified = {});
     void import_and_circulate_assignment(
         const MessageSource &source,
         const approval::IndirectAssignmentCertV2 &assignment,
-        const scale::BitVector &claimed_candidate_indices);
+        const scale::BitVector &claimed_candidate_indices,
+        const Verified &verified = {});
     void import_and_circulate_approval(
         const MessageSource &source,
-        const approval::IndirectSignedApprovalVoteV2 &vote);
+        const approval::IndirectSignedApprovalVoteV2 &vote,
+        const Verified &verified = {});
 
     // Returns the claimed core bitfield from the assignment cert, the candidate
     // hash and a
@@ -918,6 +1016,7 @@ namespace kagome::parachain {
     std::shared_ptr<PoolHandler> main_pool_handler_;
     LazySPtr<dispute::DisputeCoordinator> dispute_coordinator_;
     std::shared_ptr<authority_discovery::Query> query_audi_;
+    std::shared_ptr<network::ReputationRepository> reputation_repository_;
 
     std::shared_ptr<libp2p::basic::Scheduler> scheduler_;
 
@@ -925,6 +1024,8 @@ namespace kagome::parachain {
         Hash,
         std::vector<std::pair<libp2p::peer::PeerId, PendingMessage>>>
         pending_known_;
+    /// Messages from peers, waiting for verification.
+    std::shared_ptr<IncomingQueue> incoming_;
     std::unordered_map<libp2p::peer::PeerId, network::View> peer_views_;
     std::map<primitives::BlockNumber, std::unordered_set<primitives::BlockHash>>
         blocks_by_number_;
@@ -944,6 +1045,8 @@ namespace kagome::parachain {
 
     metrics::RegistryPtr metrics_registry_;
     metrics::Counter *metric_no_shows_total_;
+    metrics::Histogram *metric_incoming_queue_size_;
+    metrics::Histogram *metric_incoming_verification_time_;
   };
 
 }  // namespace kagome::parachain
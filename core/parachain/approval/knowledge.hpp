@@ -6,7 +6,12 @@
 
 #pragma once
 
+#include <limits>
+#include <optional>
 #include <tuple>
+#include <vector>
+
+#include <boost/assert.hpp>
 
 #include "common/visitor.hpp"
 #include "consensus/timeline/types.hpp"
@@ -41,47 +46,101 @@ namespace kagome::parachain::approval {
     }
   };
 
+  /// Index of a message subject in `MessageSubjects` of its block
+  using MessageSubjectIndex = uint32_t;
+
+  /**
+   * Dense table of message subjects of one block.
+   * A subject is hashed once, when its message arrives, and the knowledge of
+   * the node and of every peer refers to it by index.
+   */
+  struct MessageSubjects {
+    /// Index of subjects which are not in the table
+    static constexpr MessageSubjectIndex kUnknown =
+        std::numeric_limits<MessageSubjectIndex>::max();
+
+    MessageSubjectIndex find(const MessageSubject &subject) const {
+      auto it = indices.find(subject);
+      return it != indices.end() ? it->second : kUnknown;
+    }
+
+    /// Adds subject to the table, if it's not there yet
+    MessageSubjectIndex intern(const MessageSubject &subject) {
+      return indices
+          .emplace(subject, static_cast<MessageSubjectIndex>(indices.size()))
+          .first->second;
+    }
+
+    size_t size() const {
+      return indices.size();
+    }
+
+    std::unordered_map<MessageSubject, MessageSubjectIndex, MessageSubjectHash>
+        indices{};
+  };
+
   struct Knowledge {
-    // When there is no entry, this means the message is unknown
-    // When there is an entry with `MessageKind::Assignment`, the assignment is
-    // known. When there is an entry with `MessageKind::Approval`, the
-    // assignment and approval are known.
-    std::unordered_map<MessageSubject, MessageKind, MessageSubjectHash>
-        known_messages{};
-
-    bool can_send(const MessageSubject &message,
-      const MessageKind &kind) const {
-        auto it = known_messages.find(message);
-        if (it == known_messages.end()) {
-          return MessageKind::Assignment == kind;
-        }
-
-        return (kind == MessageKind::Approval && it->second == MessageKind::Assignment);
+    // When the subject is unknown, so is the message.
+    // When the subject is known, the assignment is known, and the approval is
+    // known when the second bit of the subject is set too.
+    bool can_send(MessageSubjectIndex subject, MessageKind kind) const {
+      auto known = get(subject);
+      if (not known) {
+        return MessageKind::Assignment == kind;
+      }
+      return kind == MessageKind::Approval
+          && *known == MessageKind::Assignment;
     }
 
-    bool contains(const MessageSubject &message,
-                  const MessageKind &kind) const {
-      auto it = known_messages.find(message);
-      if (it == known_messages.end()) {
+    bool contains(MessageSubjectIndex subject, MessageKind kind) const {
+      auto known = get(subject);
+      if (not known) {
         return false;
       }
       if (MessageKind::Assignment == kind) {
         return true;
       }
-      return MessageKind::Approval == it->second;
+      return MessageKind::Approval == *known;
     }
 
-    bool insert(const MessageSubject &message, const MessageKind &kind) {
-      const auto &[it, inserted] = known_messages.emplace(message, kind);
-      if (inserted) {
-        return true;
+    /// Subject must be interned
+    bool insert(MessageSubjectIndex subject, MessageKind kind) {
+      BOOST_ASSERT(subject != MessageSubjects::kUnknown);
+      auto known = get(subject);
+      if (known
+          and (*known == MessageKind::Approval
+               or kind == MessageKind::Assignment)) {
+        return false;
       }
-      if (MessageKind::Assignment == it->second
-          && MessageKind::Approval == kind) {
-        it->second = MessageKind::Approval;
-        return true;
+      auto [word, shift] = position(subject);
+      if (word >= bits.size()) {
+        bits.resize(word + 1);
+      }
+      bits[word] |= uint64_t{1} << shift;
+      if (kind == MessageKind::Approval) {
+        bits[word] |= uint64_t{2} << shift;
+      }
+      return true;
+    }
+
+    /// Two bits per subject, known and approval known
+    std::vector<uint64_t> bits{};
+
+   private:
+    static std::pair<size_t, size_t> position(MessageSubjectIndex subject) {
+      return {subject / 32, subject % 32 * 2};
+    }
+
+    std::optional<MessageKind> get(MessageSubjectIndex subject) const {
+      auto [word, shift] = position(subject);
+      if (subject == MessageSubjects::kUnknown or word >= bits.size()) {
+        return std::nullopt;
+      }
+      auto known = (bits[word] >> shift) & 3;
+      if (known == 0) {
+        return std::nullopt;
       }
-      return false;
+      return known == 1 ? MessageKind::Assignment : MessageKind::Approval;
     }
   };
 
@@ -91,9 +150,8 @@ namespace kagome::parachain::approval {
     /// The knowledge we've received from the peer.
     Knowledge received{};
 
-    bool contains(const MessageSubject &message,
-                  const MessageKind &kind) const {
-      return sent.contains(message, kind) || received.contains(message, kind);
+    bool contains(MessageSubjectIndex subject, MessageKind kind) const {
+      return sent.contains(subject, kind) || received.contains(subject, kind);
     }
 
     // Generate the knowledge keys for querying if an approval is known by peer.
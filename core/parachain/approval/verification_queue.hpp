@@ -0,0 +1,167 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include "utils/parallel_for.hpp"
+#include "utils/pool_handler.hpp"
+
+namespace kagome::parachain::approval {
+
+  /**
+   * Bounded queue of messages from peers, which are verified in batches.
+   * Messages are queued and imported on the owner thread. Checks of a batch
+   * are prepared by a single task on the pool and then run in chunks across
+   * the pool. Only one batch is verified at a time, and its messages are
+   * imported in order of their arrival.
+   */
+  template <typename Item, typename OwnerHandler = PoolHandler>
+  class VerificationQueue
+      : public std::enable_shared_from_this<
+            VerificationQueue<Item, OwnerHandler>> {
+   public:
+    /// Checks of a batch. Each of them may run on any thread of the pool and
+    /// writes its result to the items it is done for.
+    using Checks = std::vector<std::function<void()>>;
+    /// Prepares checks of the batch \arg items, called on the pool.
+    using Prepare = std::function<Checks(std::vector<Item> &items)>;
+    /// Imports the verified batch \arg items on the owner thread, \arg
+    /// verification_time is the time since the batch was taken from queue.
+    using Import = std::function<void(
+        std::vector<Item> items,
+        std::chrono::steady_clock::duration verification_time)>;
+
+    struct Config {
+      /// Items beyond it are dropped.
+      size_t capacity;
+      size_t max_batch;
+      /// Limits the number of pool tasks checking one batch.
+      size_t max_chunks;
+    };
+
+    VerificationQueue(Config config,
+                      std::shared_ptr<OwnerHandler> owner,
+                      std::shared_ptr<PoolHandler> pool,
+                      Prepare prepare,
+                      Import import)
+        : config_{config},
+          owner_{std::move(owner)},
+          pool_{std::move(pool)},
+          prepare_{std::move(prepare)},
+          import_{std::move(import)} {
+      BOOST_ASSERT(config_.max_batch > 0);
+      BOOST_ASSERT(config_.max_chunks > 0);
+      BOOST_ASSERT(owner_);
+      BOOST_ASSERT(pool_);
+    }
+
+    bool full() const {
+      return queue_.size() >= config_.capacity;
+    }
+
+    /// Queues \arg item, called on the owner thread.
+    /// @return false if queue is full and the item is dropped
+    bool push(Item item) {
+      if (full()) {
+        return false;
+      }
+      queue_.emplace_back(std::move(item));
+      return true;
+    }
+
+    /// Starts verification of the next batch, unless one is being verified.
+    /// Called on the owner thread.
+    void verify() {
+      if (verifying_ or queue_.empty()) {
+        return;
+      }
+      verifying_ = true;
+      auto batch = std::make_shared<Batch>();
+      const auto size = std::min(queue_.size(), config_.max_batch);
+      batch->items.assign(
+          std::make_move_iterator(queue_.begin()),
+          std::make_move_iterator(queue_.begin() + ptrdiff_t(size)));
+      queue_.erase(queue_.begin(), queue_.begin() + ptrdiff_t(size));
+      batch->started = std::chrono::steady_clock::now();
+      pool_->execute([weak{this->weak_from_this()}, batch] {
+        if (auto self = weak.lock()) {
+          self->check(batch);
+        }
+      });
+    }
+
+    /// Number of queued items, not including the batch being verified.
+    size_t size() const {
+      return queue_.size();
+    }
+
+   private:
+    struct Batch {
+      std::vector<Item> items;
+      Checks checks;
+      std::chrono::steady_clock::time_point started;
+    };
+
+    void check(const std::shared_ptr<Batch> &batch) {
+      try {
+        batch->checks = prepare_(batch->items);
+      } catch (...) {
+        // batch is imported even if preparation throws
+        finish(batch);
+        throw;
+      }
+      const auto chunks = std::min(batch->checks.size(), config_.max_chunks);
+      auto weak = this->weak_from_this();
+      parallelForAsync(
+          *pool_,
+          chunks,
+          [weak, batch, chunks](size_t chunk) {
+            if (weak.expired()) {
+              return;
+            }
+            const auto begin = batch->checks.size() * chunk / chunks;
+            const auto end = batch->checks.size() * (chunk + 1) / chunks;
+            for (auto i = begin; i < end; ++i) {
+              batch->checks[i]();
+            }
+          },
+          [weak, batch] {
+            if (auto self = weak.lock()) {
+              self->finish(batch);
+            }
+          });
+    }
+
+    void finish(const std::shared_ptr<Batch> &batch) {
+      const auto verification_time =
+          std::chrono::steady_clock::now() - batch->started;
+      post(*owner_,
+           [weak{this->weak_from_this()}, batch, verification_time] {
+             if (auto self = weak.lock()) {
+               self->verifying_ = false;
+               self->import_(std::move(batch->items), verification_time);
+               self->verify();
+             }
+           });
+    }
+
+    Config config_;
+    std::shared_ptr<OwnerHandler> owner_;
+    std::shared_ptr<PoolHandler> pool_;
+    Prepare prepare_;
+    Import import_;
+    std::deque<Item> queue_;
+    bool verifying_ = false;
+  };
+
+}  // namespace kagome::parachain::approval
@@ -6,10 +6,13 @@
 
 #pragma once
 
+#include <mutex>
+
 #include <ec-cpp/ec-cpp.hpp>
 
 #include "parachain/availability/erasure_coding_error.hpp"
 #include "runtime/runtime_api/parachain_host_types.hpp"
+#include "utils/lru.hpp"
 
 #define OUTCOME_UNIQUE QTILS_UNIQUE_NAME(outcome)
 
@@ -25,6 +28,87 @@
 #define EC_CPP_TRY(out, expr) _EC_CPP_TRY_OUT(OUTCOME_UNIQUE, out, expr)
 
 namespace kagome::parachain {
+  using ErasureEncoder = std::remove_cvref_t<decltype(ec_cpp::resultGetValue(
+      ec_cpp::create(size_t{})))>;
+
+  /**
+   * Encoders of recently used validator counts.
+   * Creating an encoder builds tables for the validator count, which costs
+   * about as much as coding a small PoV, and the count changes once a session
+   * at most.
+   * An encoder is leased to one caller at a time, so concurrent coding doesn't
+   * depend on the encoder being thread-safe.
+   */
+  class ErasureEncoders {
+   public:
+    class Lease {
+     public:
+      Lease(size_t validators, std::unique_ptr<ErasureEncoder> encoder)
+          : validators_{validators}, encoder_{std::move(encoder)} {}
+      Lease(Lease &&) = default;
+      Lease &operator=(Lease &&) = delete;
+      Lease(const Lease &) = delete;
+      Lease &operator=(const Lease &) = delete;
+
+      ~Lease() {
+        if (encoder_) {
+          instance().put(validators_, std::move(encoder_));
+        }
+      }
+
+      ErasureEncoder &operator*() const {
+        return *encoder_;
+      }
+      ErasureEncoder *operator->() const {
+        return encoder_.get();
+      }
+
+     private:
+      size_t validators_;
+      std::unique_ptr<ErasureEncoder> encoder_;
+    };
+
+    static ErasureEncoders &instance() {
+      static ErasureEncoders encoders;
+      return encoders;
+    }
+
+    outcome::result<Lease> get(size_t validators) {
+      {
+        std::unique_lock lock{mutex_};
+        auto free = free_.get(validators);
+        if (free and not free->get().empty()) {
+          auto encoder = std::move(free->get().back());
+          free->get().pop_back();
+          return Lease{validators, std::move(encoder)};
+        }
+      }
+      EC_CPP_TRY(encoder, ec_cpp::create(validators));
+      return Lease{validators,
+                   std::make_unique<ErasureEncoder>(std::move(encoder))};
+    }
+
+   private:
+    // session changes and concurrent candidates
+    static constexpr size_t kMaxValidatorCounts = 4;
+    static constexpr size_t kMaxPerValidatorCount = 16;
+
+    using Encoders = std::vector<std::unique_ptr<ErasureEncoder>>;
+
+    void put(size_t validators, std::unique_ptr<ErasureEncoder> encoder) {
+      std::unique_lock lock{mutex_};
+      // the least recently used validator count is dropped, others are kept
+      auto free = free_.get(validators);
+      auto &encoders = free ? free->get() : free_.put(validators, {});
+      if (encoders.size() < kMaxPerValidatorCount) {
+        encoders.emplace_back(std::move(encoder));
+      }
+    }
+
+    std::mutex mutex_;
+    Lru<size_t, Encoders> free_{kMaxValidatorCounts};
+  };
+
   inline outcome::result<size_t> minChunks(size_t validators) {
     EC_CPP_TRY(min, ec_cpp::getRecoveryThreshold(validators));
     return min;
@@ -34,10 +118,10 @@ namespace kagome::parachain {
       size_t validators, const runtime::AvailableData &data) {
     OUTCOME_TRY(message, scale::encode(data));
 
-    EC_CPP_TRY(encoder, ec_cpp::create(validators));
-    EC_CPP_TRY(
-        shards,
-        encoder.encode(ec_cpp::Slice<uint8_t>(message.data(), message.size())));
+    OUTCOME_TRY(encoder, ErasureEncoders::instance().get(validators));
+    EC_CPP_TRY(shards,
+               encoder->encode(
+                   ec_cpp::Slice<uint8_t>(message.data(), message.size())));
     BOOST_ASSERT(shards.size() == validators);
 
     std::vector<network::ErasureChunk> chunks;
@@ -52,8 +136,8 @@ namespace kagome::parachain {
 
   inline outcome::result<runtime::AvailableData> fromChunks(
       size_t validators, const std::vector<network::ErasureChunk> &chunks) {
-    EC_CPP_TRY(encoder, ec_cpp::create(validators));
-    std::vector<decltype(encoder)::Shard> _chunks;
+    OUTCOME_TRY(encoder, ErasureEncoders::instance().get(validators));
+    std::vector<ErasureEncoder::Shard> _chunks;
     _chunks.resize(validators);
     for (size_t i = 0; i < chunks.size(); ++i) {
       const auto &chunk = chunks[i];
@@ -62,22 +146,22 @@ namespace kagome::parachain {
       }
     }
 
-    EC_CPP_TRY(data, encoder.reconstruct(_chunks));
+    EC_CPP_TRY(data, encoder->reconstruct(_chunks));
     return scale::decode<runtime::AvailableData>(data);
   }
 
   inline outcome::result<runtime::AvailableData> fromSystematicChunks(
       size_t validators, const std::vector<network::ErasureChunk> &chunks) {
-    EC_CPP_TRY(encoder, ec_cpp::create(validators));
-    std::vector<decltype(encoder)::Shard> _chunks;
-    _chunks.resize(encoder.k());
+    OUTCOME_TRY(encoder, ErasureEncoders::instance().get(validators));
+    std::vector<ErasureEncoder::Shard> _chunks;
+    _chunks.resize(encoder->k());
     for (auto &chunk : chunks) {
-      if (chunk.index < encoder.k()) {
+      if (chunk.index < encoder->k()) {
         _chunks[chunk.index] = chunk.chunk;
       }
     }
 
-    EC_CPP_TRY(data, encoder.reconstruct_from_systematic(_chunks));
+    EC_CPP_TRY(data, encoder->reconstruct_from_systematic(_chunks));
     return scale::decode<runtime::AvailableData>(data);
   }
 }  // namespace kagome::parachain
@@ -0,0 +1,62 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "parachain/availability/erasure_coder.hpp"
+
+#include <boost/asio/post.hpp>
+
+#include "parachain/availability/chunks.hpp"
+#include "parachain/availability/proof.hpp"
+#include "utils/parallel_for.hpp"
+#include "utils/thread_pool.hpp"
+
+namespace kagome::parachain {
+  // a chunk is hashed in microseconds, smaller ranges cost more to schedule
+  constexpr size_t kMinChunksPerRange = 32;
+
+  ErasureCoder::ErasureCoder(std::shared_ptr<ThreadPool> pool, size_t threads)
+      : pool_{std::move(pool)}, threads_{std::max<size_t>(1, threads)} {}
+
+  outcome::result<ErasureCoder::Chunks> ErasureCoder::encode(
+      size_t validators, const runtime::AvailableData &data) const {
+    OUTCOME_TRY(chunks, toChunks(validators, data));
+    auto root = makeTrieProof(
+        chunks, [this](size_t n, const std::function<void(size_t, size_t)> &f) {
+          forRanges(n, f);
+        });
+    return Chunks{
+        .chunks = std::move(chunks),
+        .erasure_root = root,
+    };
+  }
+
+  void ErasureCoder::encodeAsync(
+      size_t validators,
+      std::shared_ptr<const runtime::AvailableData> data,
+      EncodeCb cb) const {
+    if (not pool_) {
+      return cb(encode(validators, *data));
+    }
+    boost::asio::post(
+        *pool_->io_context(),
+        [self{shared_from_this()}, validators, data, cb{std::move(cb)}] {
+          cb(self->encode(validators, *data));
+        });
+  }
+
+  void ErasureCoder::forRanges(
+      size_t n, const std::function<void(size_t, size_t)> &f) const {
+    auto ranges = std::min(threads_, n / kMinChunksPerRange);
+    if (not pool_ or ranges < 2) {
+      f(0, n);
+      return;
+    }
+    parallelFor(*pool_->io_context(), ranges, [&](size_t i) {
+      f(n * i / ranges, n * (i + 1) / ranges);
+    });
+  }
+
+}  // namespace kagome::parachain
@@ -0,0 +1,69 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <functional>
+#include <memory>
+
+#include "network/types/collator_messages.hpp"
+#include "runtime/runtime_api/parachain_host_types.hpp"
+#include "storage/trie/types.hpp"
+
+namespace kagome {
+  class ThreadPool;
+}  // namespace kagome
+
+namespace kagome::parachain {
+
+  /**
+   * Availability coding pipeline of the backing path: erasure codes available
+   * data with a reused encoder, then hashes the chunks and collects their
+   * merkle proofs, all on the coding pool.
+   */
+  class ErasureCoder : public std::enable_shared_from_this<ErasureCoder> {
+   public:
+    struct Chunks {
+      std::vector<network::ErasureChunk> chunks;
+      storage::trie::RootHash erasure_root;
+    };
+    using EncodeCb = std::function<void(outcome::result<Chunks>)>;
+
+    /**
+     * @param pool pool to code on, null codes on the calling thread
+     * @param threads number of threads of \arg pool to split hashing of
+     * chunks between
+     */
+    ErasureCoder(std::shared_ptr<ThreadPool> pool, size_t threads);
+
+    ErasureCoder(const ErasureCoder &) = delete;
+    ErasureCoder &operator=(const ErasureCoder &) = delete;
+
+    /**
+     * Splits \arg data into a chunk per validator, each with a proof against
+     * the returned erasure root.
+     * Data is coded on the calling thread, chunks are hashed on the pool too.
+     */
+    outcome::result<Chunks> encode(size_t validators,
+                                   const runtime::AvailableData &data) const;
+
+    /**
+     * Same as `encode`, but runs on the pool, \arg cb is called on a thread
+     * of the pool (on the calling thread without pool)
+     */
+    void encodeAsync(size_t validators,
+                     std::shared_ptr<const runtime::AvailableData> data,
+                     EncodeCb cb) const;
+
+   private:
+    void forRanges(size_t n,
+                   const std::function<void(size_t, size_t)> &f) const;
+
+    std::shared_ptr<ThreadPool> pool_;
+    size_t threads_;
+  };
+
+}  // namespace kagome::parachain
@@ -6,6 +6,8 @@
 
 #pragma once
 
+#include <functional>
+
 #include <boost/assert.hpp>
 
 #include "network/types/collator_messages.hpp"
@@ -18,16 +20,42 @@ namespace kagome::parachain {
     return scale::encode(index).value();
   }
 
+  /**
+   * Calls `f(begin, end)` for subranges covering `[0, n)`, possibly in
+   * parallel, and returns when all of them are done
+   */
+  using ForRanges = std::function<void(
+      size_t n, const std::function<void(size_t, size_t)> &f)>;
+
+  inline void forRangesSerial(size_t n,
+                              const std::function<void(size_t, size_t)> &f) {
+    f(0, n);
+  }
+
+  /**
+   * Writes merkle proofs of \arg chunks and returns their erasure root.
+   * Hashing of chunks and collecting of proofs are split by \arg for_ranges.
+   */
   inline storage::trie::RootHash makeTrieProof(
-      std::vector<network::ErasureChunk> &chunks) {
+      std::vector<network::ErasureChunk> &chunks,
+      const ForRanges &for_ranges = forRangesSerial) {
     storage::trie::PolkadotCodec codec;
 
-    auto trie = storage::trie::PolkadotTrieImpl::createEmpty();
     for (size_t i = 0; i < chunks.size(); ++i) {
       if (chunks[i].index != i) {
         throw std::logic_error{"ErasureChunk.index is wrong"};
       }
-      trie->put(makeTrieProofKey(i), codec.hash256(chunks[i].chunk)).value();
+    }
+    std::vector<common::Hash256> hashes(chunks.size());
+    for_ranges(chunks.size(), [&](size_t begin, size_t end) {
+      for (size_t i = begin; i < end; ++i) {
+        hashes[i] = codec.hash256(chunks[i].chunk);
+      }
+    });
+
+    auto trie = storage::trie::PolkadotTrieImpl::createEmpty();
+    for (size_t i = 0; i < chunks.size(); ++i) {
+      trie->put(makeTrieProofKey(i), hashes[i]).value();
     }
 
     using Ptr = const storage::trie::TrieNode *;
@@ -48,23 +76,27 @@ namespace kagome::parachain {
                         store)
             .value();
 
-    for (auto &chunk : chunks) {
-      network::ChunkProof proof{root_encoded};
-      auto visit = [&](const storage::trie::BranchNode &node,
-                       uint8_t index,
-                       const storage::trie::TrieNode &child) {
-        if (auto it = db.find(&child); it != db.end()) {
-          proof.emplace_back(it->second);
-        }
-        return outcome::success();
-      };
-      trie->forNodeInPath(trie->getRoot(),
-                          storage::trie::KeyNibbles::fromByteBuffer(
-                              makeTrieProofKey(chunk.index)),
-                          visit)
-          .value();
-      chunk.proof = std::move(proof);
-    }
+    // the trie is fully in memory and is only read from here on
+    for_ranges(chunks.size(), [&](size_t begin, size_t end) {
+      for (size_t i = begin; i < end; ++i) {
+        auto &chunk = chunks[i];
+        network::ChunkProof proof{root_encoded};
+        auto visit = [&](const storage::trie::BranchNode &node,
+                         uint8_t index,
+                         const storage::trie::TrieNode &child) {
+          if (auto it = db.find(&child); it != db.end()) {
+            proof.emplace_back(it->second);
+          }
+          return outcome::success();
+        };
+        trie->forNodeInPath(trie->getRoot(),
+                            storage::trie::KeyNibbles::fromByteBuffer(
+                                makeTrieProofKey(chunk.index)),
+                            visit)
+            .value();
+        chunk.proof = std::move(proof);
+      }
+    });
 
     return codec.hash256(root_encoded);
   }
@@ -9,6 +9,7 @@
 #include "application/chain_spec.hpp"
 #include "authority_discovery/query/query.hpp"
 #include "blockchain/block_tree.hpp"
+#include "common/worker_thread_pool.hpp"
 #include "crypto/key_store/session_keys.hpp"
 #include "log/formatters/optional.hpp"
 #include "network/impl/protocols/protocol_fetch_available_data.hpp"
@@ -21,12 +22,15 @@
 #include "parachain/availability/proof.hpp"
 #include "parachain/availability/store/store.hpp"
 #include "runtime/runtime_api/parachain_host.hpp"
+#include "utils/pool_handler.hpp"
 
 namespace {
   constexpr auto fullRecoveriesStartedMetricName =
       "kagome_parachain_availability_recovery_recoveries_started";
   constexpr auto fullRecoveriesFinishedMetricName =
       "kagome_parachain_availability_recovery_recoveries_finished";
+  constexpr auto recoveryTimeMetricName =
+      "kagome_parachain_availability_recovery_time";
 
   const std::array<std::string, 4> strategy_types = {
       "full_from_backers", "systematic_chunks", "regular_chunks", "all"};
@@ -50,6 +54,19 @@ namespace kagome::parachain {
   constexpr size_t kParallelRequests = 50;
   constexpr size_t kMaxSizeOfDataToRecoverFromBackers = 4 * 1024 * 1024;
 
+  // Backers asked for full data at once, the first valid data wins
+  constexpr size_t kParallelFullDataRequests = 2;
+
+  // Requests in flight to one peer from all recoveries
+  constexpr size_t kMaxRequestsPerPeer = 4;
+  constexpr size_t kMaxRequestsPerSlowPeer = 1;
+  constexpr std::chrono::milliseconds kSlowPeerLatency{500};
+  // Latency assumed for peer, which was not asked yet
+  constexpr std::chrono::milliseconds kUnknownPeerLatency{100};
+  // Failed request counts as response that slow
+  constexpr std::chrono::seconds kFailedRequestLatency{2};
+  constexpr size_t kMaxPeerStats = 4096;
+
   RecoveryImpl::RecoveryImpl(
       std::shared_ptr<application::ChainSpec> chain_spec,
       std::shared_ptr<crypto::Hasher> hasher,
@@ -59,7 +76,8 @@ namespace kagome::parachain {
       std::shared_ptr<authority_discovery::Query> query_audi,
       std::shared_ptr<network::Router> router,
       std::shared_ptr<network::PeerManager> pm,
-      std::shared_ptr<crypto::SessionKeys> session_keys)
+      std::shared_ptr<crypto::SessionKeys> session_keys,
+      common::WorkerThreadPool &worker_thread_pool)
       : logger_{log::createLogger("Recovery", "parachain")},
         hasher_{std::move(hasher)},
         block_tree_{std::move(block_tree)},
@@ -68,7 +86,9 @@ namespace kagome::parachain {
         query_audi_{std::move(query_audi)},
         router_{std::move(router)},
         pm_{std::move(pm)},
-        session_keys_{std::move(session_keys)} {
+        session_keys_{std::move(session_keys)},
+        worker_pool_handler_{worker_thread_pool.handlerStarted()},
+        peers_{kMaxPeerStats} {
     // Register metrics
     metrics_registry_->registerCounterFamily(
         fullRecoveriesStartedMetricName, "Total number of started recoveries");
@@ -77,6 +97,9 @@ namespace kagome::parachain {
     metrics_registry_->registerCounterFamily(
         fullRecoveriesFinishedMetricName,
         "Total number of recoveries that finished");
+    metrics_registry_->registerHistogramFamily(
+        recoveryTimeMetricName,
+        "Time taken to successfully recover available data, by strategy");
 
     BOOST_ASSERT(chain_spec != nullptr);
     for (auto &strategy : strategy_types) {
@@ -89,6 +112,11 @@ namespace kagome::parachain {
              {"strategy_type", std::string(strategy)},
              {"chain", chain_spec->chainType()}});
       }
+      recovery_time_[strategy] = metrics_registry_->registerHistogramMetric(
+          recoveryTimeMetricName,
+          {0.01, 0.025, 0.05, 0.1, 0.25, 0.5, 1, 2.5, 5, 10, 30},
+          {{"strategy_type", std::string(strategy)},
+           {"chain", chain_spec->chainType()}});
     }
 
     BOOST_ASSERT(pm_);
@@ -158,6 +186,7 @@ namespace kagome::parachain {
     };
 
     Active active;
+    active.started = Clock::now();
     active.erasure_encoding_root = receipt.descriptor.erasure_encoding_root;
     active.chunks_total = session->validators.size();
     active.chunks_required = _min.value();
@@ -236,6 +265,7 @@ namespace kagome::parachain {
     // Fill request order by validators of group
     active.order = std::move(active.validators_of_group);
     std::shuffle(active.order.begin(), active.order.end(), random_);
+    sort_by_latency(active);
 
     SL_TRACE(logger_,
              "Candidate {}. "
@@ -273,41 +303,41 @@ namespace kagome::parachain {
     }
     auto &active = it->second;
 
-    // Is it possible to full recover from bakers
-    auto is_possible_to_recovery_from_bakers = not active.order.empty();
+    SL_TRACE(logger_,
+             "Candidate {}. "
+             "Remain {} validators to recover from bakers, {} asked",
+             candidate_hash,
+             active.order.size(),
+             active.data_active);
 
-    if (is_possible_to_recovery_from_bakers) {
-      SL_TRACE(logger_,
-               "Candidate {}. "
-               "Remain {} validators to recover from bakers. "
-               "Trying to ask next one",
-               candidate_hash,
-               active.order.size());
-
-      // Send requests
-      while (not active.order.empty()) {
-        auto validator_index = active.order.back();
-        auto peer = query_audi_->get(active.discovery_keys[validator_index]);
-        active.order.pop_back();
-        if (peer.has_value()) {
-          SL_TRACE(logger_,
-                   "Candidate {}. "
-                   "Asking validator #{} aka peer {}",
-                   candidate_hash,
-                   validator_index,
-                   peer->id);
-          send_fetch_available_data_request(
-              peer->id,
-              candidate_hash,
-              &RecoveryImpl::full_from_bakers_recovery);
-          return;
-        }
+    // Send requests, several bakers race to respond first
+    while (not active.order.empty()
+           and active.data_active < kParallelFullDataRequests) {
+      auto validator_index = active.order.back();
+      auto peer = query_audi_->get(active.discovery_keys[validator_index]);
+      active.order.pop_back();
+      if (peer.has_value()) {
         SL_TRACE(logger_,
                  "Candidate {}. "
-                 "PeerId of validator #{} is not discovered. Skipping... ",
+                 "Asking validator #{} aka peer {}",
                  candidate_hash,
-                 validator_index);
+                 validator_index,
+                 peer->id);
+        ++active.data_active;
+        send_fetch_available_data_request(
+            peer->id, candidate_hash, &RecoveryImpl::full_from_bakers_recovery);
+        continue;
       }
+      SL_TRACE(logger_,
+               "Candidate {}. "
+               "PeerId of validator #{} is not discovered. Skipping... ",
+               candidate_hash,
+               validator_index);
+    }
+
+    // Wait for responses of asked bakers
+    if (active.data_active != 0) {
+      return;
     }
     lock.unlock();
 
@@ -372,6 +402,7 @@ namespace kagome::parachain {
       active.order.emplace_back(validator_index);
     }
     std::ranges::shuffle(active.order, random_);
+    sort_by_latency(active);
     active.queried.clear();
     active.chunks_active = 0;
 
@@ -433,6 +464,11 @@ namespace kagome::parachain {
     }
     auto &active = it->second;
 
+    // Responses are kept until decoding is finished, in case it fails
+    if (active.decoding) {
+      return;
+    }
+
     if (active.systematic_chunk_failed) {
       lock.unlock();
       return regular_chunks_recovery(candidate_hash);
@@ -464,47 +500,7 @@ namespace kagome::parachain {
                candidate_hash,
                systematic_chunk_count,
                active.chunks_required);
-
-      auto data_res = fromSystematicChunks(active.chunks_total, active.chunks);
-      [[unlikely]] if (data_res.has_error()) {
-        active.systematic_chunk_failed = true;
-        SL_DEBUG(logger_,
-                 "Systematic data recovery error "
-                 "(candidate={}, erasure_root={}): {}",
-                 candidate_hash,
-                 active.erasure_encoding_root,
-                 data_res.error());
-        incFullRecoveriesFinished("systematic_chunks", "invalid");
-      } else {
-        auto &data = data_res.value();
-        auto res = check(active, data);
-        [[unlikely]] if (res.has_error()) {
-          active.systematic_chunk_failed = true;
-          SL_DEBUG(logger_,
-                   "Systematic data recovery error "
-                   "(candidate={}, erasure_root={}): {}",
-                   candidate_hash,
-                   active.erasure_encoding_root,
-                   res.error());
-          incFullRecoveriesFinished("systematic_chunks", "invalid");
-        } else {
-          SL_TRACE(logger_,
-                   "Data recovery from systematic chunks complete. "
-                   "(candidate={}, erasure_root={})",
-                   candidate_hash,
-                   active.erasure_encoding_root);
-          incFullRecoveriesFinished("systematic_chunks", "success");
-          return done(lock, it, data);
-        }
-      }
-      lock.unlock();
-
-      SL_TRACE(logger_,
-               "Candidate {}. "
-               "Systematic chunk recovery has failed. "
-               "Trying to do regular chunks recovery",
-               candidate_hash);
-      return regular_chunks_recovery_prepare(candidate_hash);
+      return decode(candidate_hash, active, true);
     }
 
     // Is it possible to collect all systematic chunks?
@@ -535,36 +531,10 @@ namespace kagome::parachain {
     }
 
     // Send requests
-    auto max = std::min(kParallelRequests,
-                        active.chunks_required - systematic_chunk_count);
-    while (not active.order.empty() and active.chunks_active < max) {
-      auto validator_index = active.order.back();
-      active.order.pop_back();
-      auto peer = query_audi_->get(active.discovery_keys[validator_index]);
-      if (peer.has_value()) {
-        ++active.chunks_active;
-        SL_TRACE(logger_,
-                 "Candidate {}. "
-                 "Systematic recovery progress. "
-                 "Asking validator #{} aka peer {}",
-                 candidate_hash,
-                 validator_index,
-                 peer->id);
-        active.queried.emplace(validator_index);
-        send_fetch_chunk_request(
-            peer->id,
-            candidate_hash,
-            active.val2chunk(validator_index),  // chunk_index
-            &RecoveryImpl::systematic_chunks_recovery);
-      } else {
-        SL_TRACE(logger_,
-                 "Candidate {}. "
-                 "Systematic recovery progress. "
-                 "PeerId of validator #{} is not discovered. Skipping... ",
-                 candidate_hash,
-                 validator_index);
-      }
-    }
+    send_chunk_requests(candidate_hash,
+                        active,
+                        desired_chunk_requests(active, systematic_chunk_count),
+                        &RecoveryImpl::systematic_chunks_recovery);
 
     // No active request anymore for systematic chunks recovery
     if (active.chunks_active == 0) {
@@ -626,40 +596,7 @@ namespace kagome::parachain {
                candidate_hash,
                active.chunks.size(),
                active.chunks_required);
-
-      auto data_res = fromChunks(active.chunks_total, active.chunks);
-      [[unlikely]] if (data_res.has_error()) {
-        active.systematic_chunk_failed = true;
-        SL_DEBUG(logger_,
-                 "Data recovery error "
-                 "(candidate={}, erasure_root={}): {}",
-                 candidate_hash,
-                 active.erasure_encoding_root,
-                 data_res.error());
-        incFullRecoveriesFinished("regular_chunks", "invalid");
-      } else {
-        auto &data = data_res.value();
-        auto res = check(active, data);
-        [[unlikely]] if (res.has_error()) {
-          active.systematic_chunk_failed = true;
-          SL_DEBUG(logger_,
-                   "Data recovery error "
-                   "(candidate={}, erasure_root={}): {}",
-                   candidate_hash,
-                   active.erasure_encoding_root,
-                   res.error());
-          incFullRecoveriesFinished("regular_chunks", "invalid");
-          data_res = res.as_failure();
-        } else {
-          SL_TRACE(logger_,
-                   "Data recovery from chunks complete. "
-                   "(candidate={}, erasure_root={})",
-                   candidate_hash,
-                   active.erasure_encoding_root);
-          incFullRecoveriesFinished("regular_chunks", "success");
-        }
-      }
-      return done(lock, it, data_res);
+      return decode(candidate_hash, active, false);
     }
 
     // Refill request order by remaining validators
@@ -699,6 +636,7 @@ namespace kagome::parachain {
       active.order.emplace_back(validator_index);
     }
     std::shuffle(active.order.begin(), active.order.end(), random_);
+    sort_by_latency(active);
     SL_TRACE(logger_,
              "Candidate {}. "
              "Regular recovery preparation. "
@@ -738,6 +676,11 @@ namespace kagome::parachain {
     }
     auto &active = it->second;
 
+    // Responses are kept until decoding is finished
+    if (active.decoding) {
+      return;
+    }
+
     // If existing chunks are already enough for regular chunk recovery
     if (active.chunks.size() >= active.chunks_required) {
       SL_TRACE(logger_,
@@ -747,38 +690,7 @@ namespace kagome::parachain {
                candidate_hash,
                active.chunks.size(),
                active.chunks_required);
-
-      auto data_res = fromChunks(active.chunks_total, active.chunks);
-      [[unlikely]] if (data_res.has_error()) {
-        SL_DEBUG(logger_,
-                 "Data recovery error "
-                 "(candidate={}, erasure_root={}): {}",
-                 candidate_hash,
-                 active.erasure_encoding_root,
-                 data_res.error());
-        incFullRecoveriesFinished("regular_chunks", "invalid");
-      } else {
-        auto &data = data_res.value();
-        auto res = check(active, data);
-        [[unlikely]] if (res.has_error()) {
-          SL_DEBUG(logger_,
-                   "Data recovery error "
-                   "(candidate={}, erasure_root={}): {}",
-                   candidate_hash,
-                   active.erasure_encoding_root,
-                   res.error());
-          incFullRecoveriesFinished("regular_chunks", "invalid");
-          data_res = res.as_failure();
-        } else {
-          SL_TRACE(logger_,
-                   "Data recovery from chunks complete. "
-                   "(candidate={}, erasure_root={})",
-                   candidate_hash,
-                   active.erasure_encoding_root);
-          incFullRecoveriesFinished("regular_chunks", "success");
-        }
-      }
-      return done(lock, it, data_res);
+      return decode(candidate_hash, active, false);
     }
 
     // Is it possible to collect enough chunks for recovery?
@@ -801,35 +713,10 @@ namespace kagome::parachain {
     }
 
     // Send requests
-    auto max = std::min(kParallelRequests,
-                        active.chunks_required - active.chunks.size());
-    while (not active.order.empty() and active.chunks_active < max) {
-      auto validator_index = active.order.back();
-      active.order.pop_back();
-      auto peer = query_audi_->get(active.discovery_keys[validator_index]);
-      if (peer.has_value()) {
-        ++active.chunks_active;
-        SL_TRACE(logger_,
-                 "Candidate {}. "
-                 "Regular recovery progress. "
-                 "Asking validator #{} aka peer {}",
-                 candidate_hash,
-                 validator_index,
-                 peer->id);
-        active.queried.emplace(validator_index);
-        send_fetch_chunk_request(peer->id,
-                                 candidate_hash,
-                                 active.val2chunk(validator_index),
-                                 &RecoveryImpl::regular_chunks_recovery);
-      } else {
-        SL_TRACE(logger_,
-                 "Candidate {}. "
-                 "Regular recovery progress. "
-                 "PeerId of validator #{} is not discovered. Skipping... ",
-                 candidate_hash,
-                 validator_index);
-      }
-    }
+    send_chunk_requests(candidate_hash,
+                        active,
+                        desired_chunk_requests(active, active.chunks.size()),
+                        &RecoveryImpl::regular_chunks_recovery);
 
     // No active request anymore for regular chunks recovery
     if (active.chunks_active == 0) {
@@ -847,6 +734,84 @@ namespace kagome::parachain {
     }
   }
 
+  void RecoveryImpl::sort_by_latency(Active &active) {
+    auto latency = [&](ValidatorIndex validator_index) {
+      std::chrono::microseconds latency = kUnknownPeerLatency;
+      auto peer = query_audi_->get(active.discovery_keys[validator_index]);
+      if (peer.has_value()) {
+        if (auto stats = peers_.get(peer->id);
+            stats.has_value() and stats->get().latency.count() != 0) {
+          latency = stats->get().latency;
+        }
+      }
+      return latency;
+    };
+    std::vector<std::pair<std::chrono::microseconds, ValidatorIndex>> sorted;
+    sorted.reserve(active.order.size());
+    for (auto validator_index : active.order) {
+      sorted.emplace_back(latency(validator_index), validator_index);
+    }
+    // stable, so that peers of equal latency keep their random order
+    std::ranges::stable_sort(
+        sorted, std::greater{}, [](const auto &p) { return p.first; });
+    for (size_t i = 0; i < sorted.size(); ++i) {
+      active.order[i] = sorted[i].second;
+    }
+  }
+
+  size_t RecoveryImpl::desired_chunk_requests(const Active &active,
+                                              size_t collected) {
+    auto missing = active.chunks_required - collected;
+    auto expected_failures = active.chunks_responded == 0
+                               ? 0
+                               : missing * active.chunks_failed
+                                     / active.chunks_responded;
+    return std::min(kParallelRequests, missing + expected_failures);
+  }
+
+  void RecoveryImpl::send_chunk_requests(const CandidateHash &candidate_hash,
+                                         Active &active,
+                                         size_t max,
+                                         SelfCb next_iteration) {
+    std::vector<ValidatorIndex> postponed;
+    while (not active.order.empty() and active.chunks_active < max) {
+      auto validator_index = active.order.back();
+      active.order.pop_back();
+      auto peer = query_audi_->get(active.discovery_keys[validator_index]);
+      if (not peer.has_value()) {
+        SL_TRACE(logger_,
+                 "Candidate {}. "
+                 "PeerId of validator #{} is not discovered. Skipping... ",
+                 candidate_hash,
+                 validator_index);
+        continue;
+      }
+      auto &stats = peer_stats(peer->id);
+      auto max_requests = stats.latency > kSlowPeerLatency
+                            ? kMaxRequestsPerSlowPeer
+                            : kMaxRequestsPerPeer;
+      if (stats.requests_active >= max_requests and active.chunks_active != 0) {
+        postponed.emplace_back(validator_index);
+        continue;
+      }
+      ++active.chunks_active;
+      SL_TRACE(logger_,
+               "Candidate {}. "
+               "Asking validator #{} aka peer {} for chunk",
+               candidate_hash,
+               validator_index,
+               peer->id);
+      active.queried.emplace(validator_index);
+      send_fetch_chunk_request(peer->id,
+                               candidate_hash,
+                               active.val2chunk(validator_index),
+                               next_iteration);
+    }
+    // Busy peers are asked after the rest
+    active.order.insert(
+        active.order.begin(), postponed.rbegin(), postponed.rend());
+  }
+
   // Fetch available data protocol communication
   void RecoveryImpl::send_fetch_available_data_request(
       const libp2p::PeerId &peer_id,
@@ -858,14 +823,20 @@ namespace kagome::parachain {
              candidate_hash,
              peer_id);
 
+    ++peer_stats(peer_id).requests_active;
     router_->getFetchAvailableDataProtocol()->doRequest(
         peer_id,
         candidate_hash,
-        [weak{weak_from_this()}, candidate_hash, peer_id, next_iteration](
+        [weak{weak_from_this()},
+         candidate_hash,
+         peer_id,
+         sent{Clock::now()},
+         next_iteration](
             outcome::result<network::FetchAvailableDataResponse> response_res) {
           if (auto self = weak.lock()) {
             self->handle_fetch_available_data_response(peer_id,
                                                        candidate_hash,
+                                                       sent,
                                                        std::move(response_res),
                                                        next_iteration);
           }
@@ -875,10 +846,16 @@ namespace kagome::parachain {
   void RecoveryImpl::handle_fetch_available_data_response(
       const libp2p::PeerId &peer_id,
       const CandidateHash &candidate_hash,
+      Clock::time_point sent,
       outcome::result<network::FetchAvailableDataResponse> response_res,
       SelfCb next_iteration) {
     Lock lock{mutex_};
 
+    auto data = response_res.has_value()
+                  ? boost::get<AvailableData>(&response_res.value())
+                  : nullptr;
+    on_peer_response(peer_id, sent, data != nullptr);
+
     auto it = active_.find(candidate_hash);
     if (it == active_.end()) {
       return;
@@ -886,33 +863,41 @@ namespace kagome::parachain {
 
     auto &active = it->second;
 
+    if (data != nullptr) {
+      SL_TRACE(logger_,
+               "Candidate {}. "
+               "Peer {} returns data, checking it",
+               candidate_hash,
+               peer_id);
+      // Re-encoding is heavy, so data is checked on worker
+      worker_pool_handler_->execute(
+          [weak{weak_from_this()},
+           peer_id,
+           candidate_hash,
+           chunks_total{active.chunks_total},
+           erasure_encoding_root{active.erasure_encoding_root},
+           data{std::move(*data)},
+           next_iteration]() mutable {
+            if (auto self = weak.lock()) {
+              outcome::result<AvailableData> data_res = std::move(data);
+              auto res =
+                  check(chunks_total, erasure_encoding_root, data_res.value());
+              if (res.has_error()) {
+                data_res = res.as_failure();
+              }
+              self->handle_checked_available_data(
+                  peer_id, candidate_hash, std::move(data_res), next_iteration);
+            }
+          });
+      return;
+    }
+
     if (response_res.has_value()) {
-      if (auto data = boost::get<AvailableData>(&response_res.value())) {
-        auto res = check(active, *data);
-        [[unlikely]] if (res.has_error()) {
-          SL_TRACE(logger_,
-                   "Candidate {}. "
-                   "Peer {} returns INVALID data: {}",
-                   candidate_hash,
-                   peer_id,
-                   res.error());
-          incFullRecoveriesFinished("full_from_backers", "invalid");
-        } else {
-          SL_TRACE(logger_,
-                   "Candidate {}. "
-                   "Peer {} returns valid data",
-                   candidate_hash,
-                   peer_id);
-          incFullRecoveriesFinished("full_from_backers", "success");
-          return done(lock, it, std::move(*data));
-        }
-      } else {
-        SL_TRACE(logger_,
-                 "Candidate {}. "
-                 "Peer {} returns Empty for available data request",
-                 candidate_hash,
-                 peer_id);
-      }
+      SL_TRACE(logger_,
+               "Candidate {}. "
+               "Peer {} returns Empty for available data request",
+               candidate_hash,
+               peer_id);
     } else {
       SL_TRACE(logger_,
                "Candidate {}. "
@@ -922,11 +907,50 @@ namespace kagome::parachain {
                response_res.error());
     }
 
+    --active.data_active;
     lock.unlock();
 
     (this->*next_iteration)(candidate_hash);
   }
 
+  void RecoveryImpl::handle_checked_available_data(
+      const libp2p::PeerId &peer_id,
+      const CandidateHash &candidate_hash,
+      outcome::result<AvailableData> data_res,
+      SelfCb next_iteration) {
+    Lock lock{mutex_};
+
+    auto it = active_.find(candidate_hash);
+    if (it == active_.end()) {
+      return;
+    }
+    auto &active = it->second;
+
+    [[unlikely]] if (data_res.has_error()) {
+      SL_TRACE(logger_,
+               "Candidate {}. "
+               "Peer {} returns INVALID data: {}",
+               candidate_hash,
+               peer_id,
+               data_res.error());
+      incFullRecoveriesFinished("full_from_backers", "invalid");
+      --active.data_active;
+      lock.unlock();
+      return (this->*next_iteration)(candidate_hash);
+    }
+
+    SL_TRACE(logger_,
+             "Candidate {}. "
+             "Peer {} returns valid data",
+             candidate_hash,
+             peer_id);
+    incFullRecoveriesFinished("full_from_backers", "success");
+    recovery_time_.at("full_from_backers")
+        ->observe(std::chrono::duration<double>(Clock::now() - active.started)
+                      .count());
+    done(lock, it, std::move(data_res));
+  }
+
   void RecoveryImpl::send_fetch_chunk_request(
       const libp2p::PeerId &peer_id,
       const CandidateHash &candidate_hash,
@@ -942,16 +966,23 @@ namespace kagome::parachain {
              chunk_index,
              peer_id);
 
+    ++peer_stats(peer_id).requests_active;
+    auto sent = Clock::now();
     switch (req_chunk_version) {
       case network::ReqChunkVersion::V2: {
         router_->getFetchChunkProtocol()->doRequest(
             peer_id,
             {candidate_hash, chunk_index},
-            [weak{weak_from_this()}, candidate_hash, peer_id, next_iteration](
+            [weak{weak_from_this()},
+             candidate_hash,
+             peer_id,
+             sent,
+             next_iteration](
                 outcome::result<network::FetchChunkResponse> response_res) {
               if (auto self = weak.lock()) {
                 self->handle_fetch_chunk_response(peer_id,
                                                   candidate_hash,
+                                                  sent,
                                                   std::move(response_res),
                                                   next_iteration);
               }
@@ -981,11 +1012,13 @@ namespace kagome::parachain {
                       });
                   self->handle_fetch_chunk_response(peer_id,
                                                     candidate_hash,
+                                                    sent,
                                                     std::move(response),
                                                     next_iteration);
                 } else {
                   self->handle_fetch_chunk_response(peer_id,
                                                     candidate_hash,
+                                                    sent,
                                                     response_res.as_failure(),
                                                     next_iteration);
                 }
@@ -1000,17 +1033,21 @@ namespace kagome::parachain {
   void RecoveryImpl::handle_fetch_chunk_response(
       const libp2p::PeerId &peer_id,
       const CandidateHash &candidate_hash,
+      Clock::time_point sent,
       outcome::result<network::FetchChunkResponse> response_res,
       SelfCb next_iteration) {
     Lock lock{mutex_};
 
     auto it = active_.find(candidate_hash);
     if (it == active_.end()) {
+      on_peer_response(peer_id, sent, response_res.has_value());
       return;
     }
     auto &active = it->second;
 
     --active.chunks_active;
+    ++active.chunks_responded;
+    auto chunks_collected = active.chunks.size();
 
     if (response_res.has_value()) {
       if (auto chunk = boost::get<network::Chunk>(&response_res.value())) {
@@ -1053,16 +1090,129 @@ namespace kagome::parachain {
                response_res.error());
     }
 
+    auto success = active.chunks.size() != chunks_collected;
+    if (not success) {
+      ++active.chunks_failed;
+    }
+    on_peer_response(peer_id, sent, success);
+
     lock.unlock();
 
     (this->*next_iteration)(candidate_hash);
   }
 
-  outcome::result<void> RecoveryImpl::check(const Active &active,
-                                            const AvailableData &data) {
-    OUTCOME_TRY(chunks, toChunks(active.chunks_total, data));
+  RecoveryImpl::PeerStats &RecoveryImpl::peer_stats(
+      const libp2p::PeerId &peer_id) {
+    if (auto stats = peers_.get(peer_id)) {
+      return stats->get();
+    }
+    return peers_.put(peer_id, {});
+  }
+
+  void RecoveryImpl::on_peer_response(const libp2p::PeerId &peer_id,
+                                      Clock::time_point sent,
+                                      bool success) {
+    auto latency = std::chrono::duration_cast<std::chrono::microseconds>(
+        Clock::now() - sent);
+    if (not success) {
+      latency = std::max<std::chrono::microseconds>(latency,
+                                                    kFailedRequestLatency);
+    }
+    auto &stats = peer_stats(peer_id);
+    if (stats.requests_active != 0) {
+      --stats.requests_active;
+    }
+    stats.latency = stats.latency.count() == 0
+                      ? latency
+                      : (stats.latency * 7 + latency) / 8;
+  }
+
+  void RecoveryImpl::decode(const CandidateHash &candidate_hash,
+                            Active &active,
+                            bool systematic) {
+    active.decoding = true;
+    worker_pool_handler_->execute(
+        [weak{weak_from_this()},
+         candidate_hash,
+         systematic,
+         chunks_total{active.chunks_total},
+         erasure_encoding_root{active.erasure_encoding_root},
+         chunks{active.chunks}] {
+          auto self = weak.lock();
+          if (not self) {
+            return;
+          }
+          auto data_res = systematic
+                            ? fromSystematicChunks(chunks_total, chunks)
+                            : fromChunks(chunks_total, chunks);
+          if (data_res.has_value()) {
+            auto res =
+                check(chunks_total, erasure_encoding_root, data_res.value());
+            if (res.has_error()) {
+              data_res = res.as_failure();
+            }
+          }
+          self->handle_decoded(candidate_hash, systematic, std::move(data_res));
+        });
+  }
+
+  void RecoveryImpl::handle_decoded(const CandidateHash &candidate_hash,
+                                    bool systematic,
+                                    outcome::result<AvailableData> data_res) {
+    Lock lock{mutex_};
+
+    auto it = active_.find(candidate_hash);
+    if (it == active_.end()) {
+      return;
+    }
+    auto &active = it->second;
+    active.decoding = false;
+
+    const char *strategy =
+        systematic ? "systematic_chunks" : "regular_chunks";
+
+    [[unlikely]] if (data_res.has_error()) {
+      SL_DEBUG(logger_,
+               "Data recovery from {} error "
+               "(candidate={}, erasure_root={}): {}",
+               strategy,
+               candidate_hash,
+               active.erasure_encoding_root,
+               data_res.error());
+      incFullRecoveriesFinished(strategy, "invalid");
+      if (not systematic) {
+        return done(lock, it, data_res);
+      }
+      active.systematic_chunk_failed = true;
+      lock.unlock();
+
+      SL_TRACE(logger_,
+               "Candidate {}. "
+               "Systematic chunk recovery has failed. "
+               "Trying to do regular chunks recovery",
+               candidate_hash);
+      return regular_chunks_recovery_prepare(candidate_hash);
+    }
+
+    SL_TRACE(logger_,
+             "Data recovery from {} complete. "
+             "(candidate={}, erasure_root={})",
+             strategy,
+             candidate_hash,
+             active.erasure_encoding_root);
+    incFullRecoveriesFinished(strategy, "success");
+    recovery_time_.at(strategy)->observe(
+        std::chrono::duration<double>(Clock::now() - active.started).count());
+    done(lock, it, std::move(data_res));
+  }
+
+  outcome::result<void> RecoveryImpl::check(
+      ChunkIndex chunks_total,
+      const storage::trie::RootHash &erasure_encoding_root,
+      const AvailableData &data) {
+    OUTCOME_TRY(chunks, toChunks(chunks_total, data));
     auto root = makeTrieProof(chunks);
-    if (root != active.erasure_encoding_root) {
+    if (root != erasure_encoding_root) {
       return ErasureCodingRootError::MISMATCH;
     }
     return outcome::success();
@@ -1075,6 +1225,11 @@ namespace kagome::parachain {
     if (result_op.has_value()) {
       auto &result = result_op.value();
       cached_.emplace(it->first, result);
+      if (result.has_value()) {
+        recovery_time_.at("all")->observe(
+            std::chrono::duration<double>(Clock::now() - it->second.started)
+                .count());
+      }
     }
 
     auto node = active_.extract(it);
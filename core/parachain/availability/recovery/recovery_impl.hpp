@@ -8,6 +8,7 @@
 
 #include "parachain/availability/recovery/recovery.hpp"
 
+#include <chrono>
 #include <mutex>
 #include <random>
 #include <set>
@@ -15,6 +16,7 @@
 
 #include "log/logger.hpp"
 #include "metrics/metrics.hpp"
+#include "utils/lru.hpp"
 
 namespace kagome::application {
   class ChainSpec;
@@ -24,10 +26,18 @@ namespace kagome::authority_discovery {
   class Query;
 }
 
+namespace kagome {
+  class PoolHandler;
+}
+
 namespace kagome::blockchain {
   class BlockTree;
 }
 
+namespace kagome::common {
+  class WorkerThreadPool;
+}
+
 namespace kagome::crypto {
   class Hasher;
   class SessionKeys;
@@ -58,7 +68,8 @@ namespace kagome::parachain {
                  std::shared_ptr<authority_discovery::Query> query_audi,
                  std::shared_ptr<network::Router> router,
                  std::shared_ptr<network::PeerManager> pm,
-                 std::shared_ptr<crypto::SessionKeys> session_keys);
+                 std::shared_ptr<crypto::SessionKeys> session_keys,
+                 common::WorkerThreadPool &worker_thread_pool);
 
     void recover(const HashedCandidateReceipt &hashed_receipt,
                  SessionIndex session_index,
@@ -70,8 +81,10 @@ namespace kagome::parachain {
 
    private:
     using SelfCb = void (RecoveryImpl::*)(const CandidateHash &);
+    using Clock = std::chrono::steady_clock;
 
     struct Active {
+      Clock::time_point started;
       storage::trie::RootHash erasure_encoding_root;
       ChunkIndex chunks_total = 0;
       ChunkIndex chunks_required = 0;
@@ -84,6 +97,20 @@ namespace kagome::parachain {
       std::vector<network::ErasureChunk> chunks;
       std::function<CoreIndex(ValidatorIndex)> val2chunk;
       size_t chunks_active = 0;
+      // responses to chunk requests, and ones without valid chunk among them
+      size_t chunks_responded = 0;
+      size_t chunks_failed = 0;
+      // requests for full data, including received data being checked
+      size_t data_active = 0;
+      // collected chunks are being decoded on worker
+      bool decoding = false;
+    };
+
+    /// Responsiveness of peer, shared by all recoveries
+    struct PeerStats {
+      // moving average of response time, failures count as slow responses
+      std::chrono::microseconds latency{};
+      size_t requests_active = 0;
     };
     using ActiveMap = std::unordered_map<CandidateHash, Active>;
     using Lock = std::unique_lock<std::mutex>;
@@ -101,6 +128,23 @@ namespace kagome::parachain {
     void regular_chunks_recovery_prepare(const CandidateHash &candidate_hash);
     void regular_chunks_recovery(const CandidateHash &candidate_hash);
 
+    /// Orders validators, so that ones with the fastest peers are asked
+    /// first. Order is consumed from the back.
+    void sort_by_latency(Active &active);
+
+    /// Number of chunk requests to keep in flight: missing chunks, and as
+    /// many more as are expected to fail judging by responses so far
+    static size_t desired_chunk_requests(const Active &active,
+                                         size_t collected);
+
+    /// Sends chunk requests to validators from order, until `max` requests
+    /// are in flight. Validators whose peer is busy with requests of other
+    /// recoveries are postponed, unless there would be no request at all
+    void send_chunk_requests(const CandidateHash &candidate_hash,
+                             Active &active,
+                             size_t max,
+                             SelfCb next_iteration);
+
     // Fetch available data protocol communication
     void send_fetch_available_data_request(const libp2p::PeerId &peer_id,
                                            const CandidateHash &candidate_hash,
@@ -108,8 +152,14 @@ namespace kagome::parachain {
     void handle_fetch_available_data_response(
         const libp2p::PeerId &peer_id,
         const CandidateHash &candidate_hash,
+        Clock::time_point sent,
         outcome::result<network::FetchAvailableDataResponse> response_res,
         SelfCb next_iteration);
+    void handle_checked_available_data(
+        const libp2p::PeerId &peer_id,
+        const CandidateHash &candidate_hash,
+        outcome::result<AvailableData> data_res,
+        SelfCb next_iteration);
 
     // Fetch chunk protocol communication
     void send_fetch_chunk_request(const libp2p::PeerId &peer_id,
@@ -119,11 +169,28 @@ namespace kagome::parachain {
     void handle_fetch_chunk_response(
         const libp2p::PeerId &peer_id,
         const CandidateHash &candidate_hash,
+        Clock::time_point sent,
         outcome::result<network::FetchChunkResponse> response_res,
         SelfCb next_iteration);
 
-    outcome::result<void> check(const Active &active,
-                                const AvailableData &data);
+    PeerStats &peer_stats(const libp2p::PeerId &peer_id);
+    /// Updates stats of peer with response to request sent at `sent`
+    void on_peer_response(const libp2p::PeerId &peer_id,
+                          Clock::time_point sent,
+                          bool success);
+
+    /// Decodes collected chunks on worker
+    void decode(const CandidateHash &candidate_hash,
+                Active &active,
+                bool systematic);
+    void handle_decoded(const CandidateHash &candidate_hash,
+                        bool systematic,
+                        outcome::result<AvailableData> data_res);
+
+    static outcome::result<void> check(
+        ChunkIndex chunks_total,
+        const storage::trie::RootHash &erasure_encoding_root,
+        const AvailableData &data);
     void done(Lock &lock,
               ActiveMap::iterator it,
               const std::optional<outcome::result<AvailableData>> &result);
@@ -137,11 +204,13 @@ namespace kagome::parachain {
     std::shared_ptr<network::Router> router_;
     std::shared_ptr<network::PeerManager> pm_;
     std::shared_ptr<crypto::SessionKeys> session_keys_;
+    std::shared_ptr<PoolHandler> worker_pool_handler_;
 
     std::mutex mutex_;
     std::default_random_engine random_;
     std::unordered_map<CandidateHash, outcome::result<AvailableData>> cached_;
     ActiveMap active_;
+    Lru<libp2p::PeerId, PeerStats> peers_;
 
     // metrics
     metrics::RegistryPtr metrics_registry_ = metrics::createRegistry();
@@ -149,5 +218,6 @@ namespace kagome::parachain {
     std::unordered_map<std::string,
                        std::unordered_map<std::string, metrics::Counter *>>
         full_recoveries_finished_;
+    std::unordered_map<std::string, metrics::Histogram *> recovery_time_;
   };
 }  // namespace kagome::parachain
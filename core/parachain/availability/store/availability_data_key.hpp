@@ -0,0 +1,72 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <optional>
+
+#include <boost/endian/conversion.hpp>
+
+#include "parachain/types.hpp"
+#include "primitives/common.hpp"
+
+namespace kagome {
+  /**
+   * Keys of `kAvailabilityData` space.
+   * Available data of candidate is stored by `'d' ++ candidate_hash`.
+   * Pruning index entries are stored by `'p' ++ be64(time) ++ candidate_hash`,
+   * so that they are ordered by time of storing.
+   * Candidate record, the time of its pruning index entry and bytes it takes
+   * on disk, is stored by `'c' ++ candidate_hash`, so that the index entry is
+   * written once per candidate.
+   */
+  struct AvailabilityDataKey {
+    static constexpr uint8_t kDataPrefix = 'd';
+    static constexpr uint8_t kPrunePrefix = 'p';
+    static constexpr uint8_t kCandidatePrefix = 'c';
+    static constexpr size_t kCandidateHashSize =
+        sizeof(parachain::CandidateHash);
+    using DataKey = common::Blob<1 + kCandidateHashSize>;
+    using PruneKey = common::Blob<1 + sizeof(uint64_t) + kCandidateHashSize>;
+
+    static DataKey data(const parachain::CandidateHash &candidate_hash) {
+      DataKey key;
+      key[0] = kDataPrefix;
+      std::copy_n(candidate_hash.data(), kCandidateHashSize, key.data() + 1);
+      return key;
+    }
+
+    static DataKey candidate(const parachain::CandidateHash &candidate_hash) {
+      auto key = data(candidate_hash);
+      key[0] = kCandidatePrefix;
+      return key;
+    }
+
+    static PruneKey prune(uint64_t time,
+                          const parachain::CandidateHash &candidate_hash) {
+      PruneKey key;
+      key[0] = kPrunePrefix;
+      boost::endian::store_big_u64(key.data() + 1, time);
+      std::copy_n(candidate_hash.data(),
+                  kCandidateHashSize,
+                  key.data() + 1 + sizeof(uint64_t));
+      return key;
+    }
+
+    static std::optional<std::pair<uint64_t, parachain::CandidateHash>>
+    decodePrune(common::BufferView key) {
+      if (key.size() != PruneKey::size() or key[0] != kPrunePrefix) {
+        return std::nullopt;
+      }
+      std::pair<uint64_t, parachain::CandidateHash> entry;
+      entry.first = boost::endian::load_big_u64(key.data() + 1);
+      std::copy_n(key.data() + 1 + sizeof(uint64_t),
+                  kCandidateHashSize,
+                  entry.second.data());
+      return entry;
+    }
+  };
+}  // namespace kagome
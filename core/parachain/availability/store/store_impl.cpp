@@ -5,25 +5,87 @@
  */
 
 #include "parachain/availability/store/store_impl.hpp"
+#include "availability_data_key.hpp"
 #include "candidate_chunk_key.hpp"
+#include "metrics/histogram_timer.hpp"
 
 constexpr uint64_t KEEP_CANDIDATES_TIMEOUT = 1 * 60;
 
 namespace kagome::parachain {
+  namespace {
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+    metrics::GaugeHelper metric_memory_bytes{
+        "kagome_parachain_availability_store_memory_bytes",
+        "Size of chunks and PoVs kept in memory by availability store",
+    };
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+    metrics::GaugeHelper metric_disk_bytes{
+        "kagome_parachain_availability_store_disk_bytes",
+        "Size of chunks and available data stored on disk by availability "
+        "store",
+    };
+
+    // Candidates kept in memory over this size are read from disk
+    constexpr size_t kMaxMemoryBytes = 256 << 20;
+    // Covers availability and dispute windows
+    constexpr std::chrono::hours kKeepOnDiskFor{25};
+    constexpr std::chrono::minutes kDiskPruneInterval{1};
+
+    // time of pruning index entry of candidate and bytes it takes on disk
+    using CandidateRecord = std::tuple<uint64_t, uint64_t>;
+
+    size_t chunkBytes(const network::ErasureChunk &chunk) {
+      auto bytes = chunk.chunk.size();
+      for (auto &node : chunk.proof) {
+        bytes += node.size();
+      }
+      return bytes;
+    }
+  }  // namespace
+
   AvailabilityStoreImpl::AvailabilityStoreImpl(
       std::shared_ptr<application::AppStateManager> app_state_manager,
       clock::SteadyClock &steady_clock,
+      clock::SystemClock &system_clock,
       std::shared_ptr<storage::SpacedStorage> storage,
       primitives::events::ChainSubscriptionEnginePtr chain_sub_engine)
       : steady_clock_{steady_clock},
+        system_clock_{system_clock},
         storage_{std::move(storage)},
         chain_sub_{std::move(chain_sub_engine)} {
     BOOST_ASSERT(storage_ != nullptr);
+    chunk_space_ = storage_->getSpace(storage::Space::kAvaliabilityStorage);
+    data_space_ = storage_->getSpace(storage::Space::kAvailabilityData);
 
     app_state_manager->takeControl(*this);
   }
 
   bool AvailabilityStoreImpl::start() {
+    if (data_space_ != nullptr) {
+      // sizes of stored candidates are kept by their records
+      size_t disk_bytes = 0;
+      auto cursor = data_space_->cursor();
+      std::ignore =
+          cursor->seek(AvailabilityDataKey::candidate(CandidateHash{}));
+      while (cursor->isValid()) {
+        auto key = cursor->key();
+        auto value = cursor->value();
+        if (not key or not value or key->empty()
+            or (*key)[0] != AvailabilityDataKey::kCandidatePrefix) {
+          break;
+        }
+        if (auto record = scale::decode<CandidateRecord>(value.value())) {
+          disk_bytes += std::get<1>(record.value());
+        }
+        if (not cursor->next()) {
+          break;
+        }
+      }
+      disk_bytes_ = disk_bytes;
+      metric_disk_bytes->set(disk_bytes);
+      prune_disk();
+    }
+
     chain_sub_.onDeactivate(
         [weak{weak_from_this()}](
             const primitives::events::RemoveAfterFinalizationParams &params) {
@@ -55,37 +117,47 @@ namespace kagome::parachain {
     if (has_chunk) {
       return true;
     }
-    const auto space = storage_->getSpace(storage::Space::kAvaliabilityStorage);
-    if (not space) {
+    if (not chunk_space_) {
       SL_CRITICAL(logger,
                   "Failed to get AvaliabilityStorage space in hasChunk");
       return false;
     }
     auto chunk_from_db =
-        space->get(CandidateChunkKey::encode(candidate_hash, index));
+        chunk_space_->get(CandidateChunkKey::encode(candidate_hash, index));
     return chunk_from_db.has_value();
   }
 
   bool AvailabilityStoreImpl::hasPov(
       const CandidateHash &candidate_hash) const {
-    return state_.sharedAccess([&](const auto &state) {
+    const auto has_pov = state_.sharedAccess([&](const auto &state) {
       auto it = state.per_candidate_.find(candidate_hash);
       if (it == state.per_candidate_.end()) {
         return false;
       }
       return it->second.pov.has_value();
     });
+    if (has_pov or not data_space_) {
+      return has_pov;
+    }
+    // PoV and validation data are stored on disk together
+    auto res = data_space_->contains(AvailabilityDataKey::data(candidate_hash));
+    return res.has_value() and res.value();
   }
 
   bool AvailabilityStoreImpl::hasData(
       const CandidateHash &candidate_hash) const {
-    return state_.sharedAccess([&](const auto &state) {
+    const auto has_data = state_.sharedAccess([&](const auto &state) {
       auto it = state.per_candidate_.find(candidate_hash);
       if (it == state.per_candidate_.end()) {
         return false;
       }
       return it->second.data.has_value();
     });
+    if (has_data or not data_space_) {
+      return has_data;
+    }
+    auto res = data_space_->contains(AvailabilityDataKey::data(candidate_hash));
+    return res.has_value() and res.value();
   }
 
   std::optional<AvailabilityStore::ErasureChunk>
@@ -107,13 +179,12 @@ namespace kagome::parachain {
     if (chunk) {
       return chunk;
     }
-    auto space = storage_->getSpace(storage::Space::kAvaliabilityStorage);
-    if (not space) {
+    if (not chunk_space_) {
       SL_ERROR(logger, "Failed to get space for candidate {}", candidate_hash);
       return std::nullopt;
     }
     auto chunk_from_db =
-        space->get(CandidateChunkKey::encode(candidate_hash, index));
+        chunk_space_->get(CandidateChunkKey::encode(candidate_hash, index));
     if (not chunk_from_db) {
       return std::nullopt;
     }
@@ -132,7 +203,7 @@ namespace kagome::parachain {
 
   std::optional<AvailabilityStore::ParachainBlock>
   AvailabilityStoreImpl::getPov(const CandidateHash &candidate_hash) const {
-    return state_.sharedAccess(
+    auto pov = state_.sharedAccess(
         [&](const auto &state)
             -> std::optional<AvailabilityStore::ParachainBlock> {
           auto it = state.per_candidate_.find(candidate_hash);
@@ -141,12 +212,19 @@ namespace kagome::parachain {
           }
           return it->second.pov;
         });
+    if (pov) {
+      return pov;
+    }
+    if (auto data = loadData(candidate_hash)) {
+      return std::move(data->pov);
+    }
+    return std::nullopt;
   }
 
   std::optional<AvailabilityStore::AvailableData>
   AvailabilityStoreImpl::getPovAndData(
       const CandidateHash &candidate_hash) const {
-    return state_.sharedAccess(
+    auto data = state_.sharedAccess(
         [&](const auto &state)
             -> std::optional<AvailabilityStore::AvailableData> {
           auto it = state.per_candidate_.find(candidate_hash);
@@ -158,6 +236,39 @@ namespace kagome::parachain {
           }
           return AvailableData{*it->second.pov, *it->second.data};
         });
+    if (data) {
+      return data;
+    }
+    return loadData(candidate_hash);
+  }
+
+  std::optional<AvailabilityStore::AvailableData>
+  AvailabilityStoreImpl::loadData(const CandidateHash &candidate_hash) const {
+    if (not data_space_) {
+      return std::nullopt;
+    }
+    auto data_from_db =
+        data_space_->tryGet(AvailabilityDataKey::data(candidate_hash));
+    if (not data_from_db) {
+      SL_ERROR(logger,
+               "Failed to read available data of candidate {} error {}",
+               candidate_hash,
+               data_from_db.error());
+      return std::nullopt;
+    }
+    if (not data_from_db.value()) {
+      return std::nullopt;
+    }
+    auto decoded_data =
+        scale::decode<AvailableData>(data_from_db.value().value());
+    if (not decoded_data) {
+      SL_ERROR(logger,
+               "Failed to decode available data of candidate {} error {}",
+               candidate_hash,
+               decoded_data.error());
+      return std::nullopt;
+    }
+    return std::move(decoded_data.value());
   }
 
   std::vector<AvailabilityStore::ErasureChunk> AvailabilityStoreImpl::getChunks(
@@ -175,13 +286,12 @@ namespace kagome::parachain {
     if (not chunks.empty()) {
       return chunks;
     }
-    auto space = storage_->getSpace(storage::Space::kAvaliabilityStorage);
-    if (not space) {
+    if (not chunk_space_) {
       SL_CRITICAL(logger,
                   "Failed to get AvaliabilityStorage space in getChunks");
       return chunks;
     }
-    auto cursor = space->cursor();
+    auto cursor = chunk_space_->cursor();
     if (not cursor) {
       SL_ERROR(logger, "Failed to get cursor for AvaliabilityStorage");
       return chunks;
@@ -238,20 +348,27 @@ namespace kagome::parachain {
       SL_TRACE(logger,
                "[Availability store statistics]:"
                "\n\t-> state.candidates={}"
-               "\n\t-> state.per_candidate={}",
+               "\n\t-> state.per_candidate={}"
+               "\n\t-> state.memory_bytes={}"
+               "\n\t-> disk_bytes={}",
                state.candidates_.size(),
-               state.per_candidate_.size());
+               state.per_candidate_.size(),
+               state.memory_bytes,
+               disk_bytes_.load());
     });
   }
 
   void AvailabilityStoreImpl::prune_candidates_no_lock(State &state) {
     const auto now = steady_clock_.nowUint64();
     while (!state.candidates_living_keeper_.empty()
-           && state.candidates_living_keeper_[0].first + KEEP_CANDIDATES_TIMEOUT
-                  < now) {
+           && (state.candidates_living_keeper_[0].first
+                       + KEEP_CANDIDATES_TIMEOUT
+                   < now
+               || state.memory_bytes > kMaxMemoryBytes)) {
       remove_no_lock(state, state.candidates_living_keeper_[0].second);
       state.candidates_living_keeper_.pop_front();
     }
+    metric_memory_bytes->set(state.memory_bytes);
   }
 
   void AvailabilityStoreImpl::storeData(const network::RelayHash &relay_parent,
@@ -261,46 +378,30 @@ namespace kagome::parachain {
                                         const PersistedValidationData &data) {
     SL_TRACE(logger, "Attempt to store all chunks of {}", candidate_hash);
 
+    persist(candidate_hash, chunks, AvailableData{pov, data});
+
     state_.exclusiveAccess([&](auto &state) {
-      prune_candidates_no_lock(state);
       state.candidates_[relay_parent].insert(candidate_hash);
       auto &candidate_data = state.per_candidate_[candidate_hash];
       for (auto &&chunk : std::move(chunks)) {
-        auto encoded_chunk = scale::encode(chunk);
-        const auto chunk_index = chunk.index;
-        candidate_data.chunks[chunk.index] = std::move(chunk);
-        if (not encoded_chunk) {
-          SL_ERROR(logger,
-                   "Failed to encode chunk, error: {}",
-                   encoded_chunk.error());
-          continue;
-        }
-        auto space = storage_->getSpace(storage::Space::kAvaliabilityStorage);
-        if (not space) {
-          SL_ERROR(logger, "Failed to get space");
-          continue;
-        }
-        if (auto res = space->put(
-                CandidateChunkKey::encode(candidate_hash, chunk_index),
-                std::move(encoded_chunk.value()));
-            not res) {
-          SL_ERROR(logger,
-                   "Failed to put chunk candidate {} index {} error {}",
-                   candidate_hash,
-                   chunk_index,
-                   res.error());
-        } else {
-          SL_TRACE(logger,
-                   "Chunk {}:{} is saved by storeData()",
-                   candidate_hash,
-                   chunk.index);
-        }
+        auto &stored = candidate_data.chunks[chunk.index];
+        candidate_data.bytes -= chunkBytes(stored);
+        state.memory_bytes -= chunkBytes(stored);
+        candidate_data.bytes += chunkBytes(chunk);
+        state.memory_bytes += chunkBytes(chunk);
+        stored = std::move(chunk);
+      }
+      if (not candidate_data.pov) {
+        candidate_data.bytes += pov.payload.size();
+        state.memory_bytes += pov.payload.size();
       }
       candidate_data.pov = pov;
       candidate_data.data = data;
       state.candidates_living_keeper_.emplace_back(steady_clock_.nowUint64(),
                                                    relay_parent);
+      prune_candidates_no_lock(state);
     });
+    prune_disk();
   }
 
   void AvailabilityStoreImpl::putChunk(const network::RelayHash &relay_parent,
@@ -308,43 +409,204 @@ namespace kagome::parachain {
                                        ErasureChunk &&chunk) {
     SL_TRACE(logger, "Attempt to put chunk {}:{}", candidate_hash, chunk.index);
 
-    auto encoded_chunk = scale::encode(chunk);
+    persist(candidate_hash, {&chunk, 1}, std::nullopt);
+
     const auto chunk_index = chunk.index;
     state_.exclusiveAccess([&](auto &state) {
-      prune_candidates_no_lock(state);
       state.candidates_[relay_parent].insert(candidate_hash);
-      state.per_candidate_[candidate_hash].chunks[chunk.index] =
-          std::move(chunk);
+      auto &candidate_data = state.per_candidate_[candidate_hash];
+      auto &stored = candidate_data.chunks[chunk_index];
+      candidate_data.bytes -= chunkBytes(stored);
+      state.memory_bytes -= chunkBytes(stored);
+      candidate_data.bytes += chunkBytes(chunk);
+      state.memory_bytes += chunkBytes(chunk);
+      stored = std::move(chunk);
       state.candidates_living_keeper_.emplace_back(steady_clock_.nowUint64(),
                                                    relay_parent);
+      prune_candidates_no_lock(state);
     });
-    if (not encoded_chunk) {
-      SL_ERROR(
-          logger, "Failed to encode chunk, error: {}", encoded_chunk.error());
+    prune_disk();
+
+    SL_TRACE(logger,
+             "Chunk {}:{} is saved by putChunk()",
+             candidate_hash,
+             chunk_index);
+  }
+
+  void AvailabilityStoreImpl::persist(
+      const CandidateHash &candidate_hash,
+      std::span<const ErasureChunk> chunks,
+      const std::optional<AvailableData> &data) {
+    if (not chunk_space_ or not data_space_) {
+      SL_ERROR(logger, "Failed to get AvaliabilityStorage space");
       return;
     }
+    uint64_t bytes = 0;
+    auto chunk_batch = chunk_space_->batch();
+    for (auto &chunk : chunks) {
+      auto encoded_chunk = scale::encode(chunk);
+      if (not encoded_chunk) {
+        SL_ERROR(logger,
+                 "Failed to encode chunk, error: {}",
+                 encoded_chunk.error());
+        continue;
+      }
+      bytes += encoded_chunk.value().size();
+      std::ignore = chunk_batch->put(
+          CandidateChunkKey::encode(candidate_hash, chunk.index),
+          std::move(encoded_chunk.value()));
+    }
+    std::optional<common::Buffer> encoded_data;
+    if (data) {
+      auto encoded = scale::encode(*data);
+      if (not encoded) {
+        SL_ERROR(logger,
+                 "Failed to encode available data of candidate {}, error: {}",
+                 candidate_hash,
+                 encoded.error());
+      } else {
+        bytes += encoded.value().size();
+        encoded_data.emplace(std::move(encoded.value()));
+      }
+    }
 
-    auto space = storage_->getSpace(storage::Space::kAvaliabilityStorage);
-    if (not space) {
-      SL_ERROR(logger, "Failed to get AvaliabilityStorage space");
+    // index entry is written first, so that nothing is left on disk forever
+    if (not index(candidate_hash, bytes)) {
       return;
     }
+    if (encoded_data) {
+      if (auto res = data_space_->put(AvailabilityDataKey::data(candidate_hash),
+                                      std::move(*encoded_data));
+          not res) {
+        SL_ERROR(logger,
+                 "Failed to put available data of candidate {} error {}",
+                 candidate_hash,
+                 res.error());
+      }
+    }
+    if (auto res = chunk_batch->commit(); not res) {
+      SL_ERROR(logger,
+               "Failed to put chunks of candidate {} error {}",
+               candidate_hash,
+               res.error());
+    }
+    metric_disk_bytes->set(disk_bytes_ += bytes);
+  }
 
-    if (auto res =
-            space->put(CandidateChunkKey::encode(candidate_hash, chunk_index),
-                       std::move(encoded_chunk.value()));
-        not res) {
+  bool AvailabilityStoreImpl::index(const CandidateHash &candidate_hash,
+                                    uint64_t bytes) {
+    std::unique_lock lock{index_mutex_};
+    const auto record_key = AvailabilityDataKey::candidate(candidate_hash);
+    auto raw = data_space_->tryGet(record_key);
+    if (not raw) {
+      SL_ERROR(logger,
+               "Failed to read record of candidate {} error {}",
+               candidate_hash,
+               raw.error());
+      return false;
+    }
+    std::optional<CandidateRecord> record;
+    if (raw.value()) {
+      if (auto decoded = scale::decode<CandidateRecord>(raw.value().value())) {
+        record = decoded.value();
+      }
+    }
+    auto batch = data_space_->batch();
+    if (not record) {
+      record.emplace(system_clock_.nowUint64(), 0);
+      std::ignore = batch->put(
+          AvailabilityDataKey::prune(std::get<0>(*record), candidate_hash),
+          common::Buffer{});
+    }
+    std::get<1>(*record) += bytes;
+    std::ignore = batch->put(
+        record_key, common::Buffer{scale::encode(*record).value()});
+    if (auto res = batch->commit(); not res) {
       SL_ERROR(logger,
-               "Failed to put chunk candidate {} index {} error {}",
+               "Failed to put pruning index entry of candidate {} error {}",
                candidate_hash,
-               chunk_index,
                res.error());
+      return false;
     }
+    return true;
+  }
 
-    SL_TRACE(logger,
-             "Chunk {}:{} is saved by putChunk()",
-             candidate_hash,
-             chunk.index);
+  void AvailabilityStoreImpl::prune_disk() {
+    if (not chunk_space_ or not data_space_) {
+      return;
+    }
+    const auto now = system_clock_.nowUint64();
+    auto last = last_disk_prune_.load();
+    if (now < last + kDiskPruneInterval / std::chrono::seconds{1}
+        or not last_disk_prune_.compare_exchange_strong(last, now)) {
+      return;
+    }
+    const uint64_t keep_for = kKeepOnDiskFor / std::chrono::seconds{1};
+
+    auto batch = data_space_->batch();
+    auto chunk_batch = chunk_space_->batch();
+    size_t candidates = 0;
+    uint64_t bytes = 0;
+    auto cursor = data_space_->cursor();
+    std::ignore = cursor->seek(AvailabilityDataKey::prune(0, CandidateHash{}));
+    while (cursor->isValid()) {
+      auto key = cursor->key();
+      auto entry = key ? AvailabilityDataKey::decodePrune(*key) : std::nullopt;
+      if (not entry or entry->first + keep_for > now) {
+        break;
+      }
+      auto &candidate_hash = entry->second;
+      auto chunk_cursor = chunk_space_->cursor();
+      const auto seek_key = CandidateChunkKey::encode_hash(candidate_hash);
+      std::ignore = chunk_cursor->seek(seek_key);
+      while (chunk_cursor->isValid()) {
+        auto chunk_key = chunk_cursor->key();
+        if (not chunk_key or not common::startsWith(*chunk_key, seek_key)) {
+          break;
+        }
+        std::ignore = chunk_batch->remove(*chunk_key);
+        if (not chunk_cursor->next()) {
+          break;
+        }
+      }
+      std::ignore = batch->remove(AvailabilityDataKey::data(candidate_hash));
+      const auto record_key = AvailabilityDataKey::candidate(candidate_hash);
+      if (auto raw = data_space_->tryGet(record_key); raw and raw.value()) {
+        if (auto record =
+                scale::decode<CandidateRecord>(raw.value().value())) {
+          bytes += std::get<1>(record.value());
+        }
+      }
+      std::ignore = batch->remove(record_key);
+      std::ignore = batch->remove(*key);
+      ++candidates;
+      if (not cursor->next()) {
+        break;
+      }
+    }
+    if (candidates == 0) {
+      return;
+    }
+
+    // index entries are removed last, so that interrupted pruning is repeated
+    if (auto res = chunk_batch->commit(); not res) {
+      SL_ERROR(logger, "Failed to prune chunks, error: {}", res.error());
+      return;
+    }
+    if (auto res = batch->commit(); not res) {
+      SL_ERROR(
+          logger, "Failed to prune available data, error: {}", res.error());
+      return;
+    }
+    auto disk_bytes = disk_bytes_.load();
+    while (not disk_bytes_.compare_exchange_weak(
+        disk_bytes, disk_bytes - std::min<uint64_t>(disk_bytes, bytes))) {
+    }
+    metric_disk_bytes->set(disk_bytes_.load());
+    SL_DEBUG(logger,
+             "Pruned {} expired candidates ({} bytes) from disk",
+             candidates,
+             bytes);
   }
 
   void AvailabilityStoreImpl::remove_no_lock(
@@ -352,14 +614,20 @@ namespace kagome::parachain {
     if (auto it = state.candidates_.find(relay_parent);
         it != state.candidates_.end()) {
       for (const auto &l : it->second) {
-        state.per_candidate_.erase(l);
+        if (auto it2 = state.per_candidate_.find(l);
+            it2 != state.per_candidate_.end()) {
+          state.memory_bytes -= it2->second.bytes;
+          state.per_candidate_.erase(it2);
+        }
       }
       state.candidates_.erase(it);
     }
   }
 
   void AvailabilityStoreImpl::remove(const network::RelayHash &relay_parent) {
-    state_.exclusiveAccess(
-        [&](auto &state) { remove_no_lock(state, relay_parent); });
+    state_.exclusiveAccess([&](auto &state) {
+      remove_no_lock(state, relay_parent);
+      metric_memory_bytes->set(state.memory_bytes);
+    });
   }
 }  // namespace kagome::parachain
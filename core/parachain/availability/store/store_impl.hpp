@@ -8,6 +8,9 @@
 
 #include "parachain/availability/store/store.hpp"
 
+#include <atomic>
+#include <mutex>
+#include <span>
 #include <unordered_map>
 #include <unordered_set>
 #include "application/app_state_manager.hpp"
@@ -24,6 +27,7 @@ namespace kagome::parachain {
     AvailabilityStoreImpl(
         std::shared_ptr<application::AppStateManager> app_state_manager,
         clock::SteadyClock &steady_clock,
+        clock::SystemClock &system_clock,
         std::shared_ptr<storage::SpacedStorage> storage,
         primitives::events::ChainSubscriptionEnginePtr chain_sub_engine);
     ~AvailabilityStoreImpl() override = default;
@@ -58,6 +62,8 @@ namespace kagome::parachain {
       std::unordered_map<ValidatorIndex, ErasureChunk> chunks{};
       std::optional<ParachainBlock> pov{};
       std::optional<PersistedValidationData> data{};
+      // memory taken by chunks and PoV
+      size_t bytes = 0;
     };
 
     struct State {
@@ -66,15 +72,41 @@ namespace kagome::parachain {
           candidates_{};
       std::deque<std::pair<uint64_t, network::RelayHash>>
           candidates_living_keeper_;
+      size_t memory_bytes = 0;
     };
 
+    /// Drops candidates kept in memory for too long or over memory limit,
+    /// they are still read from disk
     void prune_candidates_no_lock(State &state);
     void remove_no_lock(State &state, const network::RelayHash &relay_parent);
 
+    /// Writes chunks and available data of candidate to disk, with entry of
+    /// pruning index, which removes them `kKeepOnDiskFor` after the first
+    /// write of candidate
+    void persist(const CandidateHash &candidate_hash,
+                 std::span<const ErasureChunk> chunks,
+                 const std::optional<AvailableData> &data);
+    /// Writes pruning index entry of candidate, unless it's already written,
+    /// and adds \arg bytes to its record
+    bool index(const CandidateHash &candidate_hash, uint64_t bytes);
+    std::optional<AvailableData> loadData(
+        const CandidateHash &candidate_hash) const;
+    /// Removes candidates, whose pruning index entries expired, from disk.
+    /// Runs at most once per `kDiskPruneInterval`
+    void prune_disk();
+
     log::Logger logger = log::createLogger("AvailabilityStore", "parachain");
     clock::SteadyClock &steady_clock_;
+    clock::SystemClock &system_clock_;
     std::shared_ptr<storage::SpacedStorage> storage_;
+    std::shared_ptr<storage::BufferStorage> chunk_space_;
+    std::shared_ptr<storage::BufferStorage> data_space_;
     primitives::events::ChainSub chain_sub_;
     SafeObject<State> state_{};
+    std::atomic<uint64_t> last_disk_prune_ = 0;
+    // serializes updates of candidate records
+    std::mutex index_mutex_;
+    // bytes written to disk and not pruned yet
+    std::atomic<size_t> disk_bytes_ = 0;
   };
 }  // namespace kagome::parachain
@@ -96,6 +96,7 @@ namespace kagome::parachain {
         bind_null<offchain::OffchainPersistentStorage>(),
         bind_null<offchain::OffchainWorkerPool>(),
         bind_null<api::StateApi>(),
+        bind_null<common::WorkerThreadPool>(),
         di::bind<runtime::CoreApiFactory>.to<runtime::CoreApiFactoryImpl>(),
 
         // bound by lambda because direct binding is failing: ctor gives
@@ -114,7 +115,8 @@ namespace kagome::parachain {
               injector.template create<std::shared_ptr<crypto::KeyStore>>(),
               injector.template create<std::shared_ptr<offchain::OffchainPersistentStorage>>(),
               injector.template create<std::shared_ptr<offchain::OffchainWorkerPool>>(),
-              injector.template create<LazySPtr<api::StateApi>>()
+              injector.template create<LazySPtr<api::StateApi>>(),
+              injector.template create<std::shared_ptr<common::WorkerThreadPool>>()
           );
         }),
 
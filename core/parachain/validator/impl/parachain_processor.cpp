@@ -26,8 +26,7 @@
 #include "network/impl/protocols/protocol_req_pov.hpp"
 #include "network/peer_manager.hpp"
 #include "network/router.hpp"
-#include "parachain/availability/chunks.hpp"
-#include "parachain/availability/proof.hpp"
+#include "parachain/availability/erasure_coder.hpp"
 #include "parachain/candidate_descriptor_v2.hpp"
 #include "parachain/candidate_view.hpp"
 #include "parachain/peer_relay_parent_knowledge.hpp"
@@ -221,6 +220,7 @@ namespace kagome::parachain {
       std::shared_ptr<parachain::BackingStore> backing_store,
       std::shared_ptr<parachain::Pvf> pvf,
       std::shared_ptr<parachain::AvailabilityStore> av_store,
+      std::shared_ptr<parachain::ErasureCoder> erasure_coder,
       std::shared_ptr<runtime::ParachainHost> parachain_host,
       std::shared_ptr<parachain::IValidatorSignerFactory> signer_factory,
       const application::AppConfiguration &app_config,
@@ -240,6 +240,7 @@ namespace kagome::parachain {
         hasher_(std::move(hasher)),
         peer_view_(std::move(peer_view)),
         pvf_(std::move(pvf)),
+        erasure_coder_(std::move(erasure_coder)),
         signer_factory_(std::move(signer_factory)),
         bitfield_signer_(std::move(bitfield_signer)),
         pvf_precheck_(std::move(pvf_precheck)),
@@ -266,6 +267,7 @@ namespace kagome::parachain {
     BOOST_ASSERT(bitfield_store_);
     BOOST_ASSERT(backing_store_);
     BOOST_ASSERT(pvf_);
+    BOOST_ASSERT(erasure_coder_);
     BOOST_ASSERT(parachain_host_);
     BOOST_ASSERT(signer_factory_);
     BOOST_ASSERT(sync_state_observable_);
@@ -2423,19 +2425,12 @@ namespace kagome::parachain {
     notifySeconded(validation_result.relay_parent, stmt);
   }
 
-  outcome::result<std::vector<network::ErasureChunk>>
-  ParachainProcessorImpl::validateErasureCoding(
-      const runtime::AvailableData &validating_data, size_t n_validators) {
-    return toChunks(n_validators, validating_data);
-  }
-
   void ParachainProcessorImpl::notifyAvailableData(
       std::vector<network::ErasureChunk> &&chunks,
       const primitives::BlockHash &relay_parent,
       const network::CandidateHash &candidate_hash,
       const network::ParachainBlock &pov,
       const runtime::PersistedValidationData &data) {
-    makeTrieProof(chunks);
     /// TODO(iceseer): remove copy
 
     av_store_->storeData(
@@ -2541,38 +2536,69 @@ namespace kagome::parachain {
     }
 
     const auto &[comms, data] = validation_result.value();
-    runtime::AvailableData available_data{
-        .pov = pov,
-        .validation_data = data,
-    };
+    auto available_data = std::make_shared<const runtime::AvailableData>(
+        runtime::AvailableData{
+            .pov = pov,
+            .validation_data = data,
+        });
 
-    auto chunks_res = validateErasureCoding(available_data, n_validators);
+    // coding takes as long as validation of a small candidate, so it runs on
+    // the coding pool
+    erasure_coder_->encodeAsync(
+        n_validators,
+        available_data,
+        [weak_self{weak_from_this()},
+         kMode,
+         candidate,
+         pvd,
+         relay_parent,
+         candidate_hash,
+         commitments{std::make_shared<network::CandidateCommitments>(comms)},
+         available_data](outcome::result<ErasureCoder::Chunks> r) mutable {
+          TRY_GET_OR_RET(self, weak_self.lock());
+          self->on_erasure_coded(kMode,
+                                 candidate,
+                                 pvd,
+                                 relay_parent,
+                                 candidate_hash,
+                                 commitments,
+                                 available_data,
+                                 std::move(r));
+        });
+  }
+
+  void ParachainProcessorImpl::on_erasure_coded(
+      ValidationTaskType kMode,
+      const network::CandidateReceipt &candidate,
+      const runtime::PersistedValidationData &pvd,
+      const primitives::BlockHash &relay_parent,
+      const Hash &candidate_hash,
+      const std::shared_ptr<network::CandidateCommitments> &commitments,
+      const std::shared_ptr<const runtime::AvailableData> &available_data,
+      outcome::result<ErasureCoder::Chunks> chunks_res) {
     if (chunks_res.has_error()) {
       SL_WARN(logger_,
               "Erasure coding validation failed. (error={})",
               chunks_res.error());
       return;
     }
-    auto &chunks = chunks_res.value();
 
-    notifyAvailableData(std::move(chunks),
+    notifyAvailableData(std::move(chunks_res.value().chunks),
                         relay_parent,
                         candidate_hash,
-                        available_data.pov,
-                        available_data.validation_data);
+                        available_data->pov,
+                        available_data->validation_data);
 
-    makeAvailable(
-        kMode,
-        candidate_hash,
-        ValidateAndSecondResult{
-            .result = outcome::success(),
-            .relay_parent = relay_parent,
-            .commitments =
-                std::make_shared<network::CandidateCommitments>(comms),
-            .candidate = candidate,
-            .pov = std::move(available_data.pov),
-            .pvd = pvd,
-        });
+    makeAvailable(kMode,
+                  candidate_hash,
+                  ValidateAndSecondResult{
+                      .result = outcome::success(),
+                      .relay_parent = relay_parent,
+                      .commitments = commitments,
+                      .candidate = candidate,
+                      .pov = available_data->pov,
+                      .pvd = pvd,
+                  });
   }
 
   void ParachainProcessorImpl::onAttestComplete(
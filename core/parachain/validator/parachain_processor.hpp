@@ -29,6 +29,7 @@
 #include "network/types/collator_messages_vstaging.hpp"
 #include "outcome/outcome.hpp"
 #include "parachain/availability/bitfield/signer.hpp"
+#include "parachain/availability/erasure_coder.hpp"
 #include "parachain/backing/cluster.hpp"
 #include "parachain/backing/store.hpp"
 #include "parachain/parachain_inherent_data.hpp"
@@ -215,6 +216,7 @@ namespace kagome::parachain {
         std::shared_ptr<parachain::BackingStore> backing_store,
         std::shared_ptr<parachain::Pvf> pvf,
         std::shared_ptr<parachain::AvailabilityStore> av_store,
+        std::shared_ptr<parachain::ErasureCoder> erasure_coder,
         std::shared_ptr<runtime::ParachainHost> parachain_host,
         std::shared_ptr<parachain::IValidatorSignerFactory> signer_factory,
         const application::AppConfiguration &app_config,
@@ -342,6 +344,20 @@ namespace kagome::parachain {
         const Hash &candidate_hash,
         const outcome::result<Pvf::Result> &validation_result);
 
+    /**
+     * Stores chunks of a validated candidate, coded on the coding pool, and
+     * makes the candidate available
+     */
+    virtual void on_erasure_coded(
+        ValidationTaskType kMode,
+        const network::CandidateReceipt &candidate,
+        const runtime::PersistedValidationData &pvd,
+        const primitives::BlockHash &relay_parent,
+        const Hash &candidate_hash,
+        const std::shared_ptr<network::CandidateCommitments> &commitments,
+        const std::shared_ptr<const runtime::AvailableData> &available_data,
+        outcome::result<ErasureCoder::Chunks> chunks_res);
+
     outcome::result<BlockNumber> get_block_number_under_construction(
         const RelayHash &relay_parent) const;
     bool bitfields_indicate_availability(
@@ -468,22 +484,6 @@ namespace kagome::parachain {
      * Validation.
      */
 
-    /**
-     * @brief Validates the erasure coding of the provided data.
-     *
-     * This function takes the available data from a runtime and the number of
-     * validators, and validates the erasure coding of the data.
-     *
-     * @param validating_data The available data from a runtime that needs to be
-     * validated.
-     * @param n_validators The number of validators that will be used for the
-     * validation process.
-     * @return Returns a vector of erasure chunks if the validation is
-     * successful, otherwise returns an error.
-     */
-    outcome::result<std::vector<network::ErasureChunk>> validateErasureCoding(
-        const runtime::AvailableData &validating_data, size_t n_validators);
-
     /**
      * @brief Processes a bitfield distribution message.
      *
@@ -833,6 +833,7 @@ namespace kagome::parachain {
     network::IPeerView::MyViewSubscriberPtr my_view_sub_;
 
     std::shared_ptr<parachain::Pvf> pvf_;
+    std::shared_ptr<parachain::ErasureCoder> erasure_coder_;
     std::shared_ptr<parachain::IValidatorSignerFactory> signer_factory_;
     std::shared_ptr<parachain::IBitfieldSigner> bitfield_signer_;
     std::shared_ptr<parachain::IPvfPrecheck> pvf_precheck_;
@@ -898,6 +899,7 @@ namespace kagome::parachain {
         std::shared_ptr<parachain::BackingStore> backing_store,
         std::shared_ptr<parachain::Pvf> pvf,
         std::shared_ptr<parachain::AvailabilityStore> av_store,
+        std::shared_ptr<parachain::ErasureCoder> erasure_coder,
         std::shared_ptr<runtime::ParachainHost> parachain_host,
         std::shared_ptr<parachain::IValidatorSignerFactory> signer_factory,
         const application::AppConfiguration &app_config,
@@ -922,6 +924,7 @@ namespace kagome::parachain {
                                  std::move(backing_store),
                                  std::move(pvf),
                                  std::move(av_store),
+                                 std::move(erasure_coder),
                                  std::move(parachain_host),
                                  std::move(signer_factory),
                                  app_config,
@@ -1040,6 +1043,27 @@ namespace kagome::parachain {
                     validation_result);
     }
 
+    void on_erasure_coded(
+        ValidationTaskType kMode,
+        const network::CandidateReceipt &candidate,
+        const runtime::PersistedValidationData &pvd,
+        const primitives::BlockHash &relay_parent,
+        const Hash &candidate_hash,
+        const std::shared_ptr<network::CandidateCommitments> &commitments,
+        const std::shared_ptr<const runtime::AvailableData> &available_data,
+        outcome::result<ErasureCoder::Chunks> chunks_res) override {
+      REINVOKE_ONCE(*main_pool_handler_,
+                    ParachainProcessorImpl::on_erasure_coded,
+                    kMode,
+                    candidate,
+                    pvd,
+                    relay_parent,
+                    candidate_hash,
+                    commitments,
+                    available_data,
+                    std::move(chunks_res));
+    }
+
     void handle_advertisement(const RelayHash &relay_parent,
                               const libp2p::peer::PeerId &peer_id,
                               std::optional<std::pair<CandidateHash, Hash>>
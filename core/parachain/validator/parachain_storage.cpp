@@ -24,10 +24,11 @@ namespace kagome::parachain {
       const network::FetchChunkRequest &request) {
     if (auto chunk =
             av_store_->getChunk(request.candidate, request.chunk_index)) {
+      // chunk is moved into response instead of being copied again
       return network::Chunk{
-          .data = chunk->chunk,
+          .data = std::move(chunk->chunk),
           .chunk_index = request.chunk_index,
-          .proof = chunk->proof,
+          .proof = std::move(chunk->proof),
       };
     }
     return network::Empty{};
@@ -42,8 +43,8 @@ namespace kagome::parachain {
       // https://github.com/paritytech/polkadot-sdk/blob/d2fd53645654d3b8e12cbf735b67b93078d70113/polkadot/node/core/av-store/src/lib.rs#L1345
       if (chunk->index == request.chunk_index) {
         return network::ChunkObsolete{
-            .data = chunk->chunk,
-            .proof = chunk->proof,
+            .data = std::move(chunk->chunk),
+            .proof = std::move(chunk->proof),
         };
       }
     }
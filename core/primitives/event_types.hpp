@@ -44,6 +44,8 @@ namespace kagome::primitives::events {
     kNewRuntime = 5,
     kDeactivateAfterFinalization = 6,  // TODO(kamilsa): #2369 might not be
                                        // triggered on every leaf deactivated
+    /// all storage changes of block were notified, with hash of block
+    kStorageChangesNotified = 7,
   };
 
   enum struct PeerEventType : uint8_t {
@@ -6,6 +6,8 @@
 
 #include "runtime/common/memory_allocator.hpp"
 
+#include <bit>
+
 #include <boost/endian/conversion.hpp>
 
 #include "runtime/memory.hpp"
@@ -31,10 +33,34 @@ namespace kagome::runtime {
         memory.view(ptr, sizeof(uint64_t)).value().data(), v);
   }
 
+  double MemoryAllocatorStats::fragmentation() const {
+    if (peak_heap_bytes == 0) {
+      return 0;
+    }
+    return 1 - static_cast<double>(peak_live_bytes) / peak_heap_bytes;
+  }
+
+  void MemoryAllocatorStats::onAllocate(WasmSize size,
+                                        WasmSize chunk_size,
+                                        size_t heap_bytes) {
+    ++allocations;
+    live_bytes += chunk_size;
+    peak_live_bytes = std::max(peak_live_bytes, live_bytes);
+    peak_heap_bytes = std::max(peak_heap_bytes, heap_bytes);
+    size_t order = std::bit_width(std::max<WasmSize>(size, 8) - 1) - 3;
+    ++allocations_per_order.at(std::min(order, kOrders - 1));
+  }
+
+  void MemoryAllocatorStats::onDeallocate(WasmSize chunk_size) {
+    ++deallocations;
+    live_bytes -= chunk_size;
+  }
+
   MemoryAllocatorImpl::MemoryAllocatorImpl(std::shared_ptr<MemoryHandle> memory,
                                            const MemoryConfig &config)
       : memory_{std::move(memory)},
-        offset_{roundUpAlign(config.heap_base)},
+        heap_base_{roundUpAlign(config.heap_base)},
+        offset_{heap_base_},
         max_memory_pages_num_{memory_->pagesMax().value_or(kMaxPages)} {
     BOOST_ASSERT(max_memory_pages_num_ > 0);
   }
@@ -47,6 +73,7 @@ namespace kagome::runtime {
     if (size > kMaxAllocate) {
       throw std::runtime_error{"RequestedAllocationTooLarge"};
     }
+    auto requested = size;
     size = std::max(size, kMinAllocate);
     size = math::nextHighPowerOf2(size);
     uint32_t order = std::countr_zero(size) - std::countr_zero(kMinAllocate);
@@ -74,6 +101,7 @@ namespace kagome::runtime {
       offset_ = next_offset;
     }
     write_u64(*memory_, head_ptr, kOccupied | order);
+    stats_.onAllocate(requested, size, offset_ - heap_base_);
     poisoned_ = false;
     return head_ptr + sizeof(Header);
   }
@@ -92,6 +120,7 @@ namespace kagome::runtime {
     auto prev = list.value_or(kNil);
     list = head_ptr;
     write_u64(*memory_, head_ptr, prev);
+    stats_.onDeallocate(kMinAllocate << order);
     poisoned_ = false;
   }
 
@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include <array>
 #include <optional>
 
 #include "common/literals.hpp"
@@ -35,12 +36,42 @@ namespace kagome::runtime {
     return math::roundUp<kAlignment>(t);
   }
 
+  /**
+   * Allocation statistics of one runtime call, used for profiling
+   */
+  struct MemoryAllocatorStats {
+    // https://github.com/paritytech/polkadot-sdk/blob/polkadot-v1.7.0/substrate/client/allocator/src/freeing_bump.rs#L105
+    static constexpr size_t kOrders = 23;
+
+    size_t allocations = 0;
+    size_t deallocations = 0;
+    // bytes of allocated chunks, without headers
+    size_t live_bytes = 0;
+    size_t peak_live_bytes = 0;
+    // bytes between heap base and the highest end of the bump region
+    size_t peak_heap_bytes = 0;
+    // by power of two order of requested size, starting from 8 bytes
+    std::array<uint32_t, kOrders> allocations_per_order{};
+
+    /**
+     * Share of the heap which was not occupied by chunks at the peak
+     */
+    double fragmentation() const;
+
+    void onAllocate(WasmSize size, WasmSize chunk_size, size_t heap_bytes);
+    void onDeallocate(WasmSize chunk_size);
+  };
+
   class MemoryAllocator {
    public:
     virtual ~MemoryAllocator() = default;
 
     virtual WasmPointer allocate(WasmSize size) = 0;
     virtual void deallocate(WasmPointer ptr) = 0;
+
+    virtual const MemoryAllocatorStats *stats() const {
+      return nullptr;
+    }
   };
 
   /**
@@ -55,6 +86,10 @@ namespace kagome::runtime {
     WasmPointer allocate(WasmSize size) override;
     void deallocate(WasmPointer ptr) override;
 
+    const MemoryAllocatorStats *stats() const override {
+      return &stats_;
+    }
+
     /*
       Following methods are needed mostly for testing purposes.
     */
@@ -64,8 +99,7 @@ namespace kagome::runtime {
    private:
     using Header = uint64_t;
 
-    // https://github.com/paritytech/polkadot-sdk/blob/polkadot-v1.7.0/substrate/client/allocator/src/freeing_bump.rs#L105
-    static constexpr size_t kOrders = 23;
+    static constexpr size_t kOrders = MemoryAllocatorStats::kOrders;
     // https://github.com/paritytech/polkadot-sdk/blob/polkadot-v1.7.0/substrate/client/allocator/src/freeing_bump.rs#L106
     static constexpr WasmSize kMinAllocate = 8;
     static constexpr size_t kMaxAllocate = kMinAllocate << (kOrders - 1);
@@ -81,10 +115,12 @@ namespace kagome::runtime {
 
     std::array<std::optional<uint32_t>, kOrders> free_lists_;
 
+    uint32_t heap_base_;
     // Offset on the tail of the last allocated MemoryImpl chunk
     uint32_t offset_;
     uint32_t max_memory_pages_num_;
     bool poisoned_ = false;
+    MemoryAllocatorStats stats_;
   };
 
 }  // namespace kagome::runtime
@@ -0,0 +1,48 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "runtime/common/memory_snapshot.hpp"
+
+#include <algorithm>
+
+#include "runtime/module_instance.hpp"
+
+namespace kagome::runtime {
+  MemorySnapshot::MemorySnapshot()
+      : log_{log::createLogger("MemorySnapshot", "runtime")} {}
+
+  void MemorySnapshot::build(const ModuleInstance &instance) {
+    size_t size = 0;
+    instance.forDataSegment([&](ModuleInstance::SegmentOffset offset,
+                                ModuleInstance::SegmentData segment) {
+      data_end_ = std::max(data_end_, offset + segment.size());
+      size += segment.size();
+      if (not segments_.empty()) {
+        auto &last = segments_.back();
+        if (last.offset + last.data.size() == offset) {
+          last.data.put(segment);
+          return;
+        }
+      }
+      segments_.emplace_back(Segment{offset, common::Buffer{segment}});
+    });
+    SL_DEBUG(log_,
+             "Memory snapshot of {} data segments, {} bytes",
+             segments_.size(),
+             size);
+  }
+
+  outcome::result<void> MemorySnapshot::restore(const ModuleInstance &instance,
+                                                const Memory &memory) {
+    std::call_once(built_, [&] { build(instance); });
+    // memory stays mapped by the backend, only segments are written
+    for (auto &segment : segments_) {
+      OUTCOME_TRY(view, memory.view(segment.offset, segment.data.size()));
+      std::ranges::copy(segment.data, view.begin());
+    }
+    return outcome::success();
+  }
+}  // namespace kagome::runtime
@@ -0,0 +1,62 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <mutex>
+#include <vector>
+
+#include "common/buffer.hpp"
+#include "log/logger.hpp"
+#include "runtime/memory.hpp"
+
+namespace kagome::runtime {
+  class ModuleInstance;
+
+  /**
+   * Data segments of a module, collected once per module.
+   * Memory owned by the backend is reused between calls, so resetting it only
+   * writes data segments over the previous call's data, as applying them one
+   * by one does. Segments are collected by the first instance being reset,
+   * adjacent ones are merged, and later resets copy just them without asking
+   * the backend for every segment.
+   */
+  class MemorySnapshot {
+   public:
+    MemorySnapshot();
+
+    MemorySnapshot(const MemorySnapshot &) = delete;
+    MemorySnapshot &operator=(const MemorySnapshot &) = delete;
+
+    /**
+     * Writes data segments of \arg instance into \arg memory, collecting
+     * them on the first call.
+     * Memory between and past the segments is left as it is.
+     */
+    outcome::result<void> restore(const ModuleInstance &instance,
+                                  const Memory &memory);
+
+    /**
+     * End of the last data segment, 0 until segments are collected
+     */
+    size_t dataEnd() const {
+      return data_end_;
+    }
+
+   private:
+    struct Segment {
+      size_t offset;
+      common::Buffer data;
+    };
+
+    void build(const ModuleInstance &instance);
+
+    std::once_flag built_;
+    std::vector<Segment> segments_;
+    size_t data_end_ = 0;
+    log::Logger log_;
+  };
+}  // namespace kagome::runtime
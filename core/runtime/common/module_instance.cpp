@@ -6,10 +6,16 @@
 
 #include "runtime/module_instance.hpp"
 
+#include <atomic>
 #include <cstring>
 
+#include <fmt/ranges.h>
+
 #include "common/int_serialization.hpp"
+#include "metrics/histogram_timer.hpp"
+#include "runtime/common/memory_snapshot.hpp"
 #include "runtime/memory_provider.hpp"
+#include "runtime/module.hpp"
 #include "runtime/trie_storage_provider.hpp"
 
 OUTCOME_CPP_DEFINE_CATEGORY(kagome::runtime, ModuleInstance::Error, e) {
@@ -28,6 +34,64 @@ OUTCOME_CPP_DEFINE_CATEGORY(kagome::runtime, ModuleInstance::Error, e) {
 }
 
 namespace kagome::runtime {
+  namespace {
+    // memory is reset before every runtime call, so only a sample of calls is
+    // reported to keep the reset cheap
+    constexpr size_t kAllocatorStatsSampling = 64;
+
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+    metrics::HistogramHelper metric_heap_peak{
+        "kagome_runtime_heap_peak_bytes",
+        "Peak size of allocated runtime heap chunks during a call",
+        metrics::exponentialBuckets(1 << 10, 4, 12),
+    };
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+    metrics::HistogramHelper metric_heap_used{
+        "kagome_runtime_heap_used_bytes",
+        "Runtime heap used by a call, including free chunks and headers",
+        metrics::exponentialBuckets(1 << 10, 4, 12),
+    };
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+    metrics::HistogramHelper metric_heap_allocations{
+        "kagome_runtime_heap_allocations",
+        "Number of runtime heap allocations during a call",
+        metrics::exponentialBuckets(1, 4, 12),
+    };
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+    metrics::HistogramHelper metric_heap_fragmentation{
+        "kagome_runtime_heap_fragmentation",
+        "Share of the runtime heap used by a call which was not occupied by "
+        "allocated chunks at the peak",
+        {0.1, 0.2, 0.3, 0.4, 0.5, 0.6, 0.7, 0.8, 0.9},
+    };
+
+    void reportAllocatorStats(const log::Logger &log, const Memory &memory) {
+      // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+      static std::atomic_size_t calls = 0;
+      if (calls.fetch_add(1, std::memory_order_relaxed)
+              % kAllocatorStatsSampling
+          != 0) {
+        return;
+      }
+      auto stats = memory.allocatorStats();
+      if (stats == nullptr or stats->allocations == 0) {
+        return;
+      }
+      metric_heap_peak.observe(stats->peak_live_bytes);
+      metric_heap_used.observe(stats->peak_heap_bytes);
+      metric_heap_allocations.observe(stats->allocations);
+      metric_heap_fragmentation.observe(stats->fragmentation());
+      SL_DEBUG(log,
+               "Heap allocations: {}, deallocations: {}, peak: {} of {} bytes, "
+               "per order: [{}]",
+               stats->allocations,
+               stats->deallocations,
+               stats->peak_live_bytes,
+               stats->peak_heap_bytes,
+               fmt::join(stats->allocations_per_order, ", "));
+    }
+  }  // namespace
+
   outcome::result<void> ModuleInstance::resetMemory() {
     static auto log = log::createLogger("RuntimeEnvironmentFactory", "runtime");
 
@@ -38,32 +102,46 @@ namespace kagome::runtime {
       return ModuleInstance::Error::ABSENT_HEAP_BASE;
     }
     uint32_t heap_base = boost::get<int32_t>(*opt_heap_base);
+    auto module = getModule();
     auto &memory_provider = getEnvironment().memory_provider;
-    OUTCOME_TRY(const_cast<MemoryProvider &>(*memory_provider)
-                    .resetMemory(MemoryConfig{heap_base}));
+    // memory is reset before every call, so it holds the previous one's stats
+    if (auto prev_memory = memory_provider->getCurrentMemory()) {
+      reportAllocatorStats(log, prev_memory->get());
+    }
+    MemoryConfig config{heap_base};
+    OUTCOME_TRY(
+        const_cast<MemoryProvider &>(*memory_provider).resetMemory(config));
     auto &memory = memory_provider->getCurrentMemory()->get();
 
+    auto snapshot = module ? module->memorySnapshot() : nullptr;
     size_t max_data_segment_end = 0;
     size_t segments_num = 0;
-    forDataSegment([&](ModuleInstance::SegmentOffset offset,
-                       ModuleInstance::SegmentData segment) {
-      max_data_segment_end =
-          std::max(max_data_segment_end, offset + segment.size());
-      segments_num++;
-      SL_TRACE(log,
-               "Data segment {} at offset {}",
-               common::BufferView{segment},
-               offset);
-    });
+    if (snapshot) {
+      OUTCOME_TRY(snapshot->restore(*this, memory));
+      max_data_segment_end = snapshot->dataEnd();
+    } else {
+      forDataSegment([&](ModuleInstance::SegmentOffset offset,
+                         ModuleInstance::SegmentData segment) {
+        max_data_segment_end =
+            std::max(max_data_segment_end, offset + segment.size());
+        segments_num++;
+        SL_TRACE(log,
+                 "Data segment {} at offset {}",
+                 common::BufferView{segment},
+                 offset);
+      });
+    }
     if (static_cast<size_t>(heap_base) < max_data_segment_end) {
       SL_WARN(
           log,
           "__heap_base too low, allocations will overwrite wasm data segments");
     }
 
-    forDataSegment([&](auto offset, auto segment) {
-      memory.storeBuffer(offset, segment);
-    });
+    if (not snapshot) {
+      forDataSegment([&](auto offset, auto segment) {
+        memory.storeBuffer(offset, segment);
+      });
+    }
 
     return outcome::success();
   }
@@ -29,10 +29,12 @@
     REGISTER_HOST_METHOD(int32_t, ext_allocator_malloc_version_1, int32_t) \
     REGISTER_HOST_METHOD(int32_t, ext_crypto_ed25519_generate_version_1, int32_t, int64_t) \
     REGISTER_HOST_METHOD(int32_t, ext_crypto_ed25519_verify_version_1, int32_t, int64_t, int32_t) \
+    REGISTER_HOST_METHOD(int32_t, ext_crypto_ed25519_batch_verify_version_1, int32_t, int64_t, int32_t) \
     REGISTER_HOST_METHOD(int32_t, ext_crypto_finish_batch_verify_version_1) \
     REGISTER_HOST_METHOD(int32_t, ext_crypto_sr25519_generate_version_1, int32_t, int64_t) \
     REGISTER_HOST_METHOD(int32_t, ext_crypto_sr25519_verify_version_1, int32_t, int64_t, int32_t) \
     REGISTER_HOST_METHOD(int32_t, ext_crypto_sr25519_verify_version_2, int32_t, int64_t, int32_t) \
+    REGISTER_HOST_METHOD(int32_t, ext_crypto_sr25519_batch_verify_version_1, int32_t, int64_t, int32_t) \
     REGISTER_HOST_METHOD(int64_t, ext_crypto_ecdsa_public_keys_version_1, int32_t) \
     REGISTER_HOST_METHOD(int64_t, ext_crypto_ecdsa_sign_version_1, int32_t, int32_t, int64_t) \
     REGISTER_HOST_METHOD(int64_t, ext_crypto_ecdsa_sign_prehashed_version_1, int32_t, int32_t, int32_t) \
@@ -40,6 +42,7 @@
     REGISTER_HOST_METHOD(int32_t, ext_crypto_ecdsa_verify_version_1, int32_t, int64_t, int32_t) \
     REGISTER_HOST_METHOD(int32_t, ext_crypto_ecdsa_verify_prehashed_version_1, int32_t, int32_t, int32_t) \
     REGISTER_HOST_METHOD(int32_t, ext_crypto_ecdsa_verify_version_2, int32_t, int64_t, int32_t) \
+    REGISTER_HOST_METHOD(int32_t, ext_crypto_ecdsa_batch_verify_version_1, int32_t, int64_t, int32_t) \
     REGISTER_HOST_METHOD(int32_t, ext_default_child_storage_exists_version_1, int64_t, int64_t) \
     REGISTER_HOST_METHOD(int32_t, ext_hashing_blake2_128_version_1, int64_t) \
     REGISTER_HOST_METHOD(int32_t, ext_hashing_blake2_256_version_1, int64_t) \
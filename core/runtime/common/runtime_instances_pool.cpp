@@ -8,6 +8,7 @@
 
 #include "application/app_configuration.hpp"
 #include "common/monadic_utils.hpp"
+#include "metrics/histogram_timer.hpp"
 #include "runtime/common/uncompress_code_if_needed.hpp"
 #include "runtime/instance_environment.hpp"
 #include "runtime/module.hpp"
@@ -16,6 +17,34 @@
 #include "runtime/wabt/instrument.hpp"
 
 namespace kagome::runtime {
+  namespace {
+    constexpr auto kIdleInstancesMetric = "kagome_runtime_idle_instances";
+    constexpr auto kCreatedInstancesMetric =
+        "kagome_runtime_created_instances";
+
+    metrics::Registry &poolMetrics() {
+      static auto registry = [] {
+        auto registry = metrics::createRegistry();
+        registry->registerGaugeFamily(
+            kIdleInstancesMetric,
+            "Number of runtime instances waiting in the pool per code hash");
+        registry->registerCounterFamily(
+            kCreatedInstancesMetric,
+            "Number of runtime instances created per code hash");
+        return registry;
+      }();
+      return *registry;
+    }
+
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+    metrics::HistogramHelper metric_borrow_time{
+        "kagome_runtime_instance_borrow_time",
+        "Time to get a runtime instance from the pool, including its creation "
+        "and module compilation if needed, in seconds",
+        metrics::exponentialBuckets(1e-6, 4, 12),
+    };
+  }  // namespace
+
   /**
    * @brief Wrapper type over sptr<ModuleInstance>. Allows to return instance
    * back to the ModuleInstancePool upon destruction of
@@ -23,22 +52,16 @@ namespace kagome::runtime {
    */
   class BorrowedInstance final : public ModuleInstance {
    public:
-    BorrowedInstance(std::weak_ptr<RuntimeInstancesPoolImpl> pool,
-                     const common::Hash256 &hash,
-                     RuntimeContext::ContextParams config,
-                     std::shared_ptr<ModuleInstance> instance)
-        : pool_{std::move(pool)},
-          hash_{hash},
-          config_{std::move(config)},
-          instance_{std::move(instance)} {}
+    BorrowedInstance(
+        std::shared_ptr<RuntimeInstancesPoolImpl::InstancePool> pool,
+        std::shared_ptr<ModuleInstance> instance)
+        : pool_{std::move(pool)}, instance_{std::move(instance)} {}
     BorrowedInstance(const BorrowedInstance &) = delete;
     BorrowedInstance(BorrowedInstance &&) = delete;
     BorrowedInstance &operator=(const BorrowedInstance &) = delete;
     BorrowedInstance &operator=(BorrowedInstance &&) = delete;
     ~BorrowedInstance() override {
-      if (auto pool = pool_.lock()) {
-        pool->release(hash_, config_, std::move(instance_));
-      }
+      pool_->release(std::move(instance_));
     }
 
     common::Hash256 getCodeHash() const override {
@@ -78,12 +101,50 @@ namespace kagome::runtime {
     }
 
    private:
-    std::weak_ptr<RuntimeInstancesPoolImpl> pool_;
-    common::Hash256 hash_;
-    RuntimeContext::ContextParams config_;
+    std::shared_ptr<RuntimeInstancesPoolImpl::InstancePool> pool_;
     std::shared_ptr<ModuleInstance> instance_;
   };
 
+  RuntimeInstancesPoolImpl::InstancePool::InstancePool(
+      std::shared_ptr<const Module> module, const CodeHash &code_hash)
+      : module_{std::move(module)} {
+    // a queue for the same code may be created again after eviction, metrics
+    // with the same labels are shared then
+    std::map<std::string, std::string> labels{{"code_hash", code_hash.toHex()}};
+    metric_idle_instances_ =
+        poolMetrics().registerGaugeMetric(kIdleInstancesMetric, labels);
+    metric_created_instances_ =
+        poolMetrics().registerCounterMetric(kCreatedInstancesMetric, labels);
+  }
+
+  RuntimeInstancesPoolImpl::InstancePool::~InstancePool() {
+    metric_idle_instances_->dec(instances_.size());
+  }
+
+  outcome::result<std::shared_ptr<ModuleInstance>>
+  RuntimeInstancesPoolImpl::InstancePool::instantiate() {
+    {
+      std::lock_guard lock{instances_mtx_};
+      if (not instances_.empty()) {
+        auto instance = std::move(instances_.back());
+        instances_.pop_back();
+        metric_idle_instances_->dec();
+        return instance;
+      }
+    }
+    metric_created_instances_->inc();
+    return module_->instantiate();
+  }
+
+  void RuntimeInstancesPoolImpl::InstancePool::release(
+      std::shared_ptr<ModuleInstance> &&instance) {
+    {
+      std::lock_guard lock{instances_mtx_};
+      instances_.emplace_back(std::move(instance));
+    }
+    metric_idle_instances_->inc();
+  }
+
   RuntimeInstancesPoolImpl::RuntimeInstancesPoolImpl(
       const application::AppConfiguration &app_config,
       std::shared_ptr<ModuleFactory> module_factory,
@@ -92,8 +153,9 @@ namespace kagome::runtime {
       : cache_dir_{app_config.runtimeCacheDirPath()},
         module_factory_{std::move(module_factory)},
         instrument_{std::move(instrument)},
-        pools_{capacity} {
+        capacity_{capacity} {
     BOOST_ASSERT(module_factory_);
+    BOOST_ASSERT(capacity_ > 0);
   }
 
   outcome::result<std::shared_ptr<ModuleInstance>>
@@ -101,12 +163,14 @@ namespace kagome::runtime {
       const CodeHash &code_hash,
       const GetCode &get_code,
       const RuntimeContext::ContextParams &config) {
-    std::unique_lock lock{pools_mtx_};
-    OUTCOME_TRY(module, getPool(lock, code_hash, get_code, config));
-    OUTCOME_TRY(instance, module.get().instantiate(lock));
-    BOOST_ASSERT(shared_from_this());
-    return std::make_shared<BorrowedInstance>(
-        weak_from_this(), code_hash, config, std::move(instance));
+    auto begin = std::chrono::steady_clock::now();
+    OUTCOME_TRY(pool, getPool(code_hash, get_code, config));
+    OUTCOME_TRY(instance, pool->instantiate());
+    metric_borrow_time.observe(
+        std::chrono::duration<double>(std::chrono::steady_clock::now() - begin)
+            .count());
+    return std::make_shared<BorrowedInstance>(std::move(pool),
+                                              std::move(instance));
   }
 
   std::filesystem::path RuntimeInstancesPoolImpl::getCachePath(
@@ -146,44 +210,61 @@ namespace kagome::runtime {
       const CodeHash &code_hash,
       const GetCode &get_code,
       const RuntimeContext::ContextParams &config) {
-    std::unique_lock lock{pools_mtx_};
-    OUTCOME_TRY(getPool(lock, code_hash, get_code, config));
+    OUTCOME_TRY(getPool(code_hash, get_code, config));
     return outcome::success();
   }
 
   std::optional<std::shared_ptr<const Module>>
   RuntimeInstancesPoolImpl::getModule(
       const CodeHash &code_hash, const RuntimeContext::ContextParams &config) {
-    std::unique_lock lock{pools_mtx_};
-    Key key{code_hash, config};
-    auto pool_opt = pools_.get(key);
-    if (!pool_opt) {
+    auto pool = findPool(Key{code_hash, config});
+    if (pool == nullptr) {
       return std::nullopt;
     }
-    return pool_opt->get().module;
+    return pool->module();
   }
 
-  outcome::result<
-      std::reference_wrapper<RuntimeInstancesPoolImpl::InstancePool>>
+  std::shared_ptr<RuntimeInstancesPoolImpl::InstancePool>
+  RuntimeInstancesPoolImpl::findPool(const Key &key) {
+    std::shared_lock lock{pools_mtx_};
+    auto it = pools_.find(key);
+    if (it == pools_.end()) {
+      return nullptr;
+    }
+    it->second->last_used = ++use_counter_;
+    return it->second;
+  }
+
+  outcome::result<std::shared_ptr<RuntimeInstancesPoolImpl::InstancePool>>
   RuntimeInstancesPoolImpl::getPool(
-      std::unique_lock<std::mutex> &lock,
       const CodeHash &code_hash,
       const GetCode &get_code,
       const RuntimeContext::ContextParams &config) {
     Key key{code_hash, config};
-    auto pool_opt = pools_.get(key);
-
-    if (!pool_opt) {
-      lock.unlock();
-      OUTCOME_TRY(module, tryCompileModule(code_hash, get_code, config));
-      lock.lock();
-      pool_opt = pools_.get(key);
-      if (!pool_opt) {
-        pool_opt = std::ref(pools_.put(key, InstancePool{.module = module}));
+    if (auto pool = findPool(key)) {
+      return pool;
+    }
+    OUTCOME_TRY(module, tryCompileModule(code_hash, get_code, config));
+    std::unique_lock lock{pools_mtx_};
+    auto &pool = pools_[key];
+    if (pool == nullptr) {
+      if (pools_.size() > capacity_) {
+        // evict the least recently used module, its borrowed instances keep
+        // their queue until they are released
+        auto lru = pools_.end();
+        for (auto it = pools_.begin(); it != pools_.end(); ++it) {
+          if (it->second != nullptr
+              and (lru == pools_.end()
+                   or it->second->last_used < lru->second->last_used)) {
+            lru = it;
+          }
+        }
+        pools_.erase(lru);
       }
+      pool = std::make_shared<InstancePool>(module, code_hash);
     }
-    BOOST_ASSERT(pool_opt);
-    return pool_opt.value();
+    pool->last_used = ++use_counter_;
+    return pool;
   }
 
   RuntimeInstancesPoolImpl::CompilationResult
@@ -226,29 +307,4 @@ namespace kagome::runtime {
     return res;
   }
 
-  void RuntimeInstancesPoolImpl::release(
-      const CodeHash &code_hash,
-      const RuntimeContext::ContextParams &config,
-      std::shared_ptr<ModuleInstance> &&instance) {
-    std::unique_lock guard{pools_mtx_};
-    Key key{code_hash, config};
-    auto entry = pools_.get(key);
-    if (not entry) {
-      entry = pools_.put(key, {.module = instance->getModule()});
-    }
-    entry->get().instances.emplace_back(std::move(instance));
-  }
-
-  outcome::result<std::shared_ptr<ModuleInstance>>
-  RuntimeInstancesPoolImpl::InstancePool::instantiate(
-      std::unique_lock<std::mutex> &lock) {
-    if (instances.empty()) {
-      auto copy = module;
-      lock.unlock();
-      return copy->instantiate();
-    }
-    auto instance = std::move(instances.back());
-    instances.pop_back();
-    return instance;
-  }
 }  // namespace kagome::runtime
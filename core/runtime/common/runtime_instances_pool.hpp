@@ -10,13 +10,15 @@
 #include "runtime/runtime_instances_pool.hpp"
 
 #include <boost/di.hpp>
+#include <atomic>
 #include <future>
 #include <mutex>
 #include <shared_mutex>
 #include <unordered_set>
 
+#include "common/spin_lock.hpp"
+#include "metrics/metrics.hpp"
 #include "runtime/module_factory.hpp"
-#include "utils/lru.hpp"
 
 namespace kagome::application {
   class AppConfiguration;
@@ -27,6 +29,10 @@ namespace kagome::runtime {
 
   /**
    * @brief Pool of runtime instances - per state. Encapsulates modules cache.
+   * Instances are kept in a separate queue per code hash. Looking a queue up
+   * only takes a shared lock, and borrowed instances return to their queue
+   * directly, so concurrent runtime calls don't wait for each other unless a
+   * module has to be compiled.
    */
   class RuntimeInstancesPoolImpl final
       : public RuntimeInstancesPool,
@@ -43,17 +49,6 @@ namespace kagome::runtime {
         const GetCode &get_code,
         const RuntimeContext::ContextParams &config) override;
 
-    /**
-     * @brief Releases the module instance (returns it to the pool)
-     *
-     * @param state - the merkle trie root of the state containing the runtime
-     * module code we are releasing an instance of.
-     * @param instance - instance to be released.
-     */
-    void release(const CodeHash &code_hash,
-                 const RuntimeContext::ContextParams &config,
-                 std::shared_ptr<ModuleInstance> &&instance);
-
     std::filesystem::path getCachePath(
         const CodeHash &code_hash,
         const RuntimeContext::ContextParams &config) const;
@@ -66,22 +61,51 @@ namespace kagome::runtime {
     std::optional<std::shared_ptr<const Module>> getModule(
         const CodeHash &code_hash, const RuntimeContext::ContextParams &config);
 
+    /**
+     * Idle instances of one module. Borrowed instances keep their queue alive
+     * and return to it on release, even if it has been evicted meanwhile.
+     */
+    class InstancePool {
+     public:
+      InstancePool(std::shared_ptr<const Module> module,
+                   const CodeHash &code_hash);
+      InstancePool(const InstancePool &) = delete;
+      InstancePool &operator=(const InstancePool &) = delete;
+      ~InstancePool();
+
+      const std::shared_ptr<const Module> &module() const {
+        return module_;
+      }
+
+      /**
+       * Takes an idle instance or creates a new one
+       */
+      outcome::result<std::shared_ptr<ModuleInstance>> instantiate();
+
+      void release(std::shared_ptr<ModuleInstance> &&instance);
+
+      // value of RuntimeInstancesPoolImpl::use_counter_ at the last use
+      std::atomic_uint64_t last_used = 0;
+
+     private:
+      std::shared_ptr<const Module> module_;
+      // held for a push or a pop only
+      common::spin_lock instances_mtx_;
+      std::vector<std::shared_ptr<ModuleInstance>> instances_;
+      metrics::Gauge *metric_idle_instances_;
+      metrics::Counter *metric_created_instances_;
+    };
+
    private:
     using Key = std::tuple<common::Hash256, RuntimeContext::ContextParams>;
-    struct InstancePool {
-      std::shared_ptr<const Module> module;
-      std::vector<std::shared_ptr<ModuleInstance>> instances;
 
-      outcome::result<std::shared_ptr<ModuleInstance>> instantiate(
-          std::unique_lock<std::mutex> &lock);
-    };
-
-    outcome::result<std::reference_wrapper<InstancePool>> getPool(
-        std::unique_lock<std::mutex> &lock,
+    outcome::result<std::shared_ptr<InstancePool>> getPool(
         const CodeHash &code_hash,
         const GetCode &get_code,
         const RuntimeContext::ContextParams &config);
 
+    std::shared_ptr<InstancePool> findPool(const Key &key);
+
     using CompilationResult = CompilationOutcome<std::shared_ptr<const Module>>;
     CompilationResult tryCompileModule(
         const CodeHash &code_hash,
@@ -92,8 +116,12 @@ namespace kagome::runtime {
     std::shared_ptr<ModuleFactory> module_factory_;
     std::shared_ptr<WasmInstrumenter> instrument_;
 
-    std::mutex pools_mtx_;
-    Lru<Key, InstancePool> pools_;
+    // exclusive lock is taken only to add a compiled module
+    std::shared_mutex pools_mtx_;
+    std::unordered_map<Key, std::shared_ptr<InstancePool>> pools_;
+    // number of modules to keep, least recently used ones are evicted
+    size_t capacity_;
+    std::atomic_uint64_t use_counter_ = 0;
 
     mutable std::mutex compiling_modules_mtx_;
     std::unordered_map<Key, std::shared_future<CompilationResult>>
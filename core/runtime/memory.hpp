@@ -128,6 +128,10 @@ namespace kagome::runtime {
       return handle_;
     }
 
+    const MemoryAllocatorStats *allocatorStats() const {
+      return allocator_->stats();
+    }
+
    private:
     std::shared_ptr<MemoryHandle> handle_;
     std::unique_ptr<MemoryAllocator> allocator_;
@@ -14,6 +14,7 @@
 namespace kagome::runtime {
 
   class ModuleInstance;
+  class MemorySnapshot;
 
   /**
    * A WebAssembly code module.
@@ -27,5 +28,13 @@ namespace kagome::runtime {
 
     virtual outcome::result<std::shared_ptr<ModuleInstance>> instantiate()
         const = 0;
+
+    /**
+     * Initial memory image shared by the instances of the module, which they
+     * copy instead of applying the data segments on reset, null if disabled
+     */
+    virtual std::shared_ptr<MemorySnapshot> memorySnapshot() const {
+      return nullptr;
+    }
   };
 }  // namespace kagome::runtime
@@ -16,6 +16,7 @@
 #include "log/formatters/filepath.hpp"
 #include "log/formatters/optional.hpp"
 #include "log/trace_macros.hpp"
+#include "runtime/common/memory_snapshot.hpp"
 #include "runtime/common/trie_storage_provider_impl.hpp"
 #include "runtime/memory_provider.hpp"
 #include "runtime/module.hpp"
@@ -293,12 +294,14 @@ namespace kagome::runtime::wasm_edge {
                         std::shared_ptr<ExecutorContext> executor,
                         std::shared_ptr<InstanceEnvironmentFactory> env_factory,
                         const WasmEdge_MemoryTypeContext *memory_type,
-                        common::Hash256 code_hash)
+                        common::Hash256 code_hash,
+                        std::shared_ptr<MemorySnapshot> memory_snapshot)
         : env_factory_{std::move(env_factory)},
           executor_{std::move(executor)},
           memory_type_{memory_type},
           module_{std::move(module)},
-          code_hash_{code_hash} {
+          code_hash_{code_hash},
+          memory_snapshot_{std::move(memory_snapshot)} {
       BOOST_ASSERT(module_ != nullptr);
       BOOST_ASSERT(executor_ != nullptr);
       BOOST_ASSERT(env_factory_ != nullptr);
@@ -362,6 +365,10 @@ namespace kagome::runtime::wasm_edge {
                                                   code_hash_);
     }
 
+    std::shared_ptr<MemorySnapshot> memorySnapshot() const override {
+      return memory_snapshot_;
+    }
+
    private:
     std::shared_ptr<InstanceEnvironmentFactory> env_factory_;
     std::shared_ptr<ExecutorContext> executor_;
@@ -371,6 +378,7 @@ namespace kagome::runtime::wasm_edge {
 
     // NOLINTNEXTLINE(cppcoreguidelines-avoid-const-or-ref-data-members)
     const common::Hash256 code_hash_;
+    std::shared_ptr<MemorySnapshot> memory_snapshot_;
 
     friend class ModuleInstanceImpl;
   };
@@ -499,7 +507,10 @@ namespace kagome::runtime::wasm_edge {
                                         std::move(executor),
                                         std::move(env_factory),
                                         import_memory_type,
-                                        code_hash);
+                                        code_hash,
+                                        config_.memory_snapshot
+                                            ? std::make_shared<MemorySnapshot>()
+                                            : nullptr);
   }
 
 }  // namespace kagome::runtime::wasm_edge
@@ -41,9 +41,12 @@ namespace kagome::runtime::wasm_edge {
       Compiled,
     };
     struct Config {
-      Config(ExecType exec) : exec{exec} {}
+      Config(ExecType exec, bool memory_snapshot = false)
+          : exec{exec}, memory_snapshot{memory_snapshot} {}
 
       ExecType exec;
+      // reset instance memory from an image of the initial memory
+      bool memory_snapshot;
     };
 
     explicit ModuleFactoryImpl(
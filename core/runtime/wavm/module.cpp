@@ -11,6 +11,7 @@
 #include <WAVM/WASM/WASM.h>
 #include <boost/assert.hpp>
 
+#include "runtime/common/memory_snapshot.hpp"
 #include "runtime/wavm/compartment_wrapper.hpp"
 #include "runtime/wavm/instance_environment_factory.hpp"
 #include "runtime/wavm/intrinsics/intrinsic_functions.hpp"
@@ -56,7 +57,10 @@ namespace kagome::runtime::wavm {
                                         std::move(intrinsic_module),
                                         std::move(env_factory),
                                         std::move(module),
-                                        code_hash);
+                                        code_hash,
+                                        module_params.memory_snapshot
+                                            ? std::make_shared<MemorySnapshot>()
+                                            : nullptr);
   }
 
   ModuleImpl::ModuleImpl(
@@ -64,12 +68,14 @@ namespace kagome::runtime::wavm {
       std::shared_ptr<const IntrinsicModule> intrinsic_module,
       std::shared_ptr<const InstanceEnvironmentFactory> env_factory,
       std::shared_ptr<WAVM::Runtime::Module> module,
-      const common::Hash256 &code_hash)
+      const common::Hash256 &code_hash,
+      std::shared_ptr<MemorySnapshot> memory_snapshot)
       : env_factory_{std::move(env_factory)},
         compartment_{std::move(compartment)},
         intrinsic_module_{std::move(intrinsic_module)},
         module_{std::move(module)},
         code_hash_(code_hash),
+        memory_snapshot_{std::move(memory_snapshot)},
         logger_{log::createLogger("WAVM Module", "wavm")} {
     BOOST_ASSERT(compartment_);
     BOOST_ASSERT(env_factory_);
@@ -124,6 +130,10 @@ namespace kagome::runtime::wavm {
     return instance;
   }
 
+  std::shared_ptr<MemorySnapshot> ModuleImpl::memorySnapshot() const {
+    return memory_snapshot_;
+  }
+
   WAVM::Runtime::ImportBindings ModuleImpl::link(
       IntrinsicResolver &resolver) const {
 #if defined(__GNUC__) and not defined(__clang__)
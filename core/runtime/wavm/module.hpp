@@ -43,11 +43,14 @@ namespace kagome::runtime::wavm {
     outcome::result<std::shared_ptr<ModuleInstance>> instantiate()
         const override;
 
+    std::shared_ptr<MemorySnapshot> memorySnapshot() const override;
+
     ModuleImpl(std::shared_ptr<CompartmentWrapper> compartment,
                std::shared_ptr<const IntrinsicModule> intrinsic_module,
                std::shared_ptr<const InstanceEnvironmentFactory> env_factory,
                std::shared_ptr<WAVM::Runtime::Module> module,
-               const common::Hash256 &code_hash);
+               const common::Hash256 &code_hash,
+               std::shared_ptr<MemorySnapshot> memory_snapshot);
 
    private:
     WAVM::Runtime::ImportBindings link(IntrinsicResolver &resolver) const;
@@ -57,6 +60,7 @@ namespace kagome::runtime::wavm {
     std::shared_ptr<const IntrinsicModule> intrinsic_module_;
     std::shared_ptr<WAVM::Runtime::Module> module_;
     const common::Hash256 code_hash_;
+    std::shared_ptr<MemorySnapshot> memory_snapshot_;
     log::Logger logger_;
 
     friend class ModuleInstanceImpl;
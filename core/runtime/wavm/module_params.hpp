@@ -11,12 +11,14 @@
 namespace kagome::runtime::wavm {
 
   /**
-   * @brief Global parameters for module instantiation. Currently contains only
-   * memory type that may be changed on new runtime compilation.
+   * @brief Global parameters for module instantiation. Contains memory type
+   * that may be changed on new runtime compilation.
    *
    */
   struct ModuleParams {
     WAVM::IR::MemoryType intrinsicMemoryType{
         false, WAVM::IR::IndexType::i32, {21, UINT64_MAX}};
+    // reset instance memory from an image of the initial memory
+    bool memory_snapshot = false;
   };
 }  // namespace kagome::runtime::wavm
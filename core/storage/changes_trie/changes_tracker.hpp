@@ -33,6 +33,11 @@ namespace kagome::storage::changes_trie {
      * Supposed to be called when an entry is removed from the tracked storage
      */
     virtual void onRemove(const common::BufferView &key) = 0;
+
+    /**
+     * Supposed to be called when an entry is read from the tracked storage
+     */
+    virtual void onRead(const common::BufferView &key) {}
   };
 
 }  // namespace kagome::storage::changes_trie
@@ -27,6 +27,8 @@ namespace kagome::storage::changes_trie {
       }
       storage_sub_engine->notify(pair.first, pair.second, hash);
     }
+    chain_sub_engine->notify(
+        primitives::events::ChainEventType::kStorageChangesNotified, hash);
   }
 
   void StorageChangesTrackerImpl::onPut(const common::BufferView &key,
@@ -52,4 +54,10 @@ namespace kagome::storage::changes_trie {
       }
     }
   }
+
+  void StorageChangesTrackerImpl::onRead(const common::BufferView &key) {
+    if (record_reads_) {
+      read_keys_.emplace(key);
+    }
+  }
 }  // namespace kagome::storage::changes_trie
@@ -9,6 +9,7 @@
 #include "storage/changes_trie/changes_tracker.hpp"
 
 #include <set>
+#include <unordered_set>
 
 #include "log/logger.hpp"
 #include "primitives/event_types.hpp"
@@ -27,11 +28,28 @@ namespace kagome::storage::changes_trie {
                const common::BufferView &value,
                bool new_entry) override;
     void onRemove(const common::BufferView &key) override;
+    void onRead(const common::BufferView &key) override;
+
+    /**
+     * Starts collecting keys read from the storage
+     */
+    void recordReads() {
+      record_reads_ = true;
+    }
+
+    /**
+     * Keys read since `recordReads`
+     */
+    std::unordered_set<common::Buffer> takeReadKeys() {
+      return std::move(read_keys_);
+    }
 
    private:
     std::set<common::Buffer> new_entries_;  // entries that do not yet exist in
                                             // the underlying storage
     std::map<common::Buffer, std::optional<common::Buffer>> actual_val_;
+    bool record_reads_ = false;
+    std::unordered_set<common::Buffer> read_keys_;
 
     log::Logger logger_ =
         log::createLogger("Storage Changes Tracker", "changes_trie");
@@ -42,6 +42,9 @@ namespace kagome::storage {
 
   inline const common::Buffer kWarpSyncOp = ":kagome:WarpSync:op"_buf;
 
+  inline const common::Buffer kStateSyncStartsKey =
+      ":kagome:StateSync:starts"_buf;
+
   inline const common::Buffer kFirstBlockSlot = ":kagome:first_block_slot"_buf;
 
   inline const common::Buffer kBabeConfigRepositoryImplIndexerPrefix =
@@ -22,7 +22,8 @@ namespace kagome::storage {
                                      "dispute_data",
                                      "beefy_justification",
                                      "avaliability_storage",
-                                     "audi_peers"};
+                                     "audi_peers",
+                                     "availability_data"};
   static_assert(kNames.size() == Space::kTotal - 1);
 
   std::string spaceName(Space space) {
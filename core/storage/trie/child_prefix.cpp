@@ -28,11 +28,11 @@ namespace kagome::storage::trie {
     }
   }
 
-  void ChildPrefix::match(common::BufferView nibbles) {
+  void ChildPrefix::match(const NibblesView &nibbles) {
     if (done()) {
       return;
     }
-    for (auto &nibble : nibbles) {
+    for (auto nibble : nibbles) {
       match(nibble);
       if (done()) {
         return;
@@ -6,9 +6,11 @@
 
 #pragma once
 
-#include "common/buffer_view.hpp"
+#include <cstdint>
 
 namespace kagome::storage::trie {
+  class NibblesView;
+
   /**
    * ":child_storage:" prefix matcher
    */
@@ -17,7 +19,7 @@ namespace kagome::storage::trie {
     ChildPrefix(bool v);
 
     void match(uint8_t nibble);
-    void match(common::BufferView nibbles);
+    void match(const NibblesView &nibbles);
 
     operator bool() const;
 
@@ -47,17 +47,42 @@ namespace kagome::storage::trie {
       StateVersion version) {
     OUTCOME_TRY(commitChildren(version));
     OUTCOME_TRY(root_and_batch, serializer_->storeTrie(*trie_, version));
-    auto &[root, batch] = root_and_batch;
+    auto &root = root_and_batch.first;
     KAGOME_PROFILE_START(pruner_add_state);
-    OUTCOME_TRY(state_pruner_->addNewState(*trie_, version));
+    // pruner checks whether new nodes are stored, so it runs before commit
+    OUTCOME_TRY(batch,
+                state_pruner_->addNewState(
+                    *trie_, version, std::move(root_and_batch.second)));
     KAGOME_PROFILE_END(pruner_add_state);
-    // batch must not be committed before pruner addNewState or pruner breaks
-    // probably should enforce this more strictly in the API
     OUTCOME_TRY(batch->commit());
     SL_TRACE_FUNC_CALL(logger_, root);
     return root;
   }
 
+  outcome::result<BufferOrView> PersistentTrieBatchImpl::get(
+      const BufferView &key) const {
+    if (changes_.has_value()) {
+      changes_.value()->onRead(key);
+    }
+    return TrieBatchBase::get(key);
+  }
+
+  outcome::result<std::optional<BufferOrView>> PersistentTrieBatchImpl::tryGet(
+      const BufferView &key) const {
+    if (changes_.has_value()) {
+      changes_.value()->onRead(key);
+    }
+    return TrieBatchBase::tryGet(key);
+  }
+
+  outcome::result<bool> PersistentTrieBatchImpl::contains(
+      const BufferView &key) const {
+    if (changes_.has_value()) {
+      changes_.value()->onRead(key);
+    }
+    return TrieBatchBase::contains(key);
+  }
+
   outcome::result<std::tuple<bool, uint32_t>>
   PersistentTrieBatchImpl::clearPrefix(const BufferView &prefix,
                                        std::optional<uint64_t> limit) {
@@ -39,6 +39,11 @@ namespace kagome::storage::trie {
 
     outcome::result<RootHash> commit(StateVersion version) override;
 
+    outcome::result<BufferOrView> get(const BufferView &key) const override;
+    outcome::result<std::optional<BufferOrView>> tryGet(
+        const BufferView &key) const override;
+    outcome::result<bool> contains(const BufferView &key) const override;
+
     outcome::result<std::tuple<bool, uint32_t>> clearPrefix(
         const BufferView &prefix,
         std::optional<uint64_t> limit = std::nullopt) override;
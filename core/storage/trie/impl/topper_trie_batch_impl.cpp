@@ -51,6 +51,7 @@ namespace kagome::storage::trie {
 
   outcome::result<std::optional<BufferOrView>> TopperTrieBatchImpl::tryGet(
       const BufferView &key) const {
+    OUTCOME_TRY(materialize(key));
     if (auto it = cache_.find(key); it != cache_.end()) {
       if (it->second.has_value()) {
         return BufferView{it->second.value()};
@@ -64,6 +65,10 @@ namespace kagome::storage::trie {
   }
 
   std::unique_ptr<PolkadotTrieCursor> TopperTrieBatchImpl::trieCursor() {
+    // cursor iterates over values of cache only
+    if (not materializeAll()) {
+      return nullptr;
+    }
     if (auto p = parent_.lock(); p != nullptr) {
       return std::make_unique<TopperTrieCursor>(shared_from_this(),
                                                 p->trieCursor());
@@ -73,6 +78,9 @@ namespace kagome::storage::trie {
 
   outcome::result<bool> TopperTrieBatchImpl::contains(
       const BufferView &key) const {
+    if (appended_.contains(key)) {
+      return true;
+    }
     if (auto it = cache_.find(key); it != cache_.end()) {
       return it->second.has_value();
     }
@@ -84,11 +92,13 @@ namespace kagome::storage::trie {
 
   outcome::result<void> TopperTrieBatchImpl::put(const BufferView &key,
                                                  BufferOrView &&value) {
+    appended_.erase(key);
     cache_.insert_or_assign(Buffer{key}, std::move(value).intoBuffer());
     return outcome::success();
   }
 
   outcome::result<void> TopperTrieBatchImpl::remove(const BufferView &key) {
+    appended_.erase(key);
     cache_.insert_or_assign(Buffer{key}, std::nullopt);
 
     return outcome::success();
@@ -96,6 +106,11 @@ namespace kagome::storage::trie {
 
   outcome::result<std::tuple<bool, uint32_t>> TopperTrieBatchImpl::clearPrefix(
       const BufferView &prefix, std::optional<uint64_t>) {
+    for (auto it = appended_.lower_bound(prefix);
+         it != appended_.end() && startsWith(it->first, prefix);) {
+      cache_.insert_or_assign(it->first, std::nullopt);
+      it = appended_.erase(it);
+    }
     for (auto it = cache_.lower_bound(prefix);
          it != cache_.end() && startsWith(it->first, prefix);
          ++it) {
@@ -110,6 +125,13 @@ namespace kagome::storage::trie {
 
   outcome::result<void> TopperTrieBatchImpl::writeBack() {
     if (auto p = parent_.lock()) {
+      // parent records appended items too, if it is an overlay
+      for (auto &[k, items] : appended_) {
+        for (auto &item : items) {
+          OUTCOME_TRY(p->append(k, item));
+        }
+      }
+      appended_.clear();
       return apply(*p);
     }
     return Error::PARENT_EXPIRED;
@@ -124,6 +146,56 @@ namespace kagome::storage::trie {
         OUTCOME_TRY(map.remove(k));
       }
     }
+    for (auto &[k, items] : appended_) {
+      OUTCOME_TRY(value, map.tryGet(k));
+      auto vec = value ? std::move(*value).intoBuffer() : Buffer{};
+      for (auto &item : items) {
+        OUTCOME_TRY(scale::append_or_new_vec(vec.asVector(), item));
+      }
+      OUTCOME_TRY(map.put(k, BufferView{vec}));
+      cache_.insert_or_assign(k, std::move(vec));
+    }
+    appended_.clear();
+    return outcome::success();
+  }
+
+  outcome::result<void> TopperTrieBatchImpl::append(const BufferView &key,
+                                                    BufferView item) {
+    if (auto it = cache_.find(key); it != cache_.end()) {
+      if (not it->second) {
+        it->second.emplace();
+      }
+      return scale::append_or_new_vec(it->second->asVector(), item);
+    }
+    appended_[Buffer{key}].emplace_back(item);
+    return outcome::success();
+  }
+
+  outcome::result<void> TopperTrieBatchImpl::materialize(
+      const BufferView &key) const {
+    auto it = appended_.find(key);
+    if (it == appended_.end()) {
+      return outcome::success();
+    }
+    auto p = parent_.lock();
+    if (p == nullptr) {
+      return Error::PARENT_EXPIRED;
+    }
+    OUTCOME_TRY(value, p->tryGet(key));
+    auto vec = value ? std::move(*value).intoBuffer() : Buffer{};
+    for (auto &item : it->second) {
+      OUTCOME_TRY(scale::append_or_new_vec(vec.asVector(), item));
+    }
+    cache_.insert_or_assign(it->first, std::move(vec));
+    appended_.erase(it);
+    return outcome::success();
+  }
+
+  outcome::result<void> TopperTrieBatchImpl::materializeAll() const {
+    while (not appended_.empty()) {
+      auto key = appended_.begin()->first;
+      OUTCOME_TRY(materialize(key));
+    }
     return outcome::success();
   }
 
@@ -48,10 +48,27 @@ namespace kagome::storage::trie {
     outcome::result<std::optional<std::shared_ptr<TrieBatch>>> createChildBatch(
         common::BufferView path) override;
 
+    /**
+     * Appends to vector owned by this batch in place, or records item until
+     * value is read, so that appending doesn't copy the whole vector
+     */
+    outcome::result<void> append(const BufferView &key,
+                                 BufferView item) override;
+
+    /**
+     * Applies changes to map. Recorded appends become plain values, so that
+     * batch may be applied again
+     */
     outcome::result<void> apply(storage::BufferStorage &map);
 
    private:
-    std::map<Buffer, std::optional<Buffer>> cache_;
+    /// Moves value with recorded appends applied to it to cache
+    outcome::result<void> materialize(const BufferView &key) const;
+    outcome::result<void> materializeAll() const;
+
+    mutable std::map<Buffer, std::optional<Buffer>> cache_;
+    // items appended to values of parent, which were not read yet
+    mutable std::map<Buffer, std::vector<Buffer>> appended_;
     std::weak_ptr<TrieBatch> parent_;
 
     friend class TopperTrieCursor;
@@ -99,13 +99,12 @@ namespace kagome::storage::trie {
   }
 
   outcome::result<void> PolkadotTrieCursorImpl::seekLowerBoundInternal(
-      const TrieNode &current, BufferView sought_nibbles) {
+      const TrieNode &current, NibblesView sought_nibbles) {
     BOOST_ASSERT(isValid());
-    auto [sought_nibbles_mismatch, current_mismatch] =
-        std::mismatch(sought_nibbles.begin(),
-                      sought_nibbles.end(),
-                      current.getKeyNibbles().begin(),
-                      current.getKeyNibbles().end());
+    auto common_length =
+        sought_nibbles.commonPrefixLength(current.getKeyNibbles());
+    auto sought_nibbles_mismatch = sought_nibbles.begin() + common_length;
+    auto current_mismatch = current.getKeyNibbles().begin() + common_length;
     // one nibble sequence is a prefix of the other
     bool sought_is_prefix = sought_nibbles_mismatch == sought_nibbles.end();
     bool current_is_prefix = current_mismatch == current.getKeyNibbles().end();
@@ -117,9 +116,9 @@ namespace kagome::storage::trie {
                               and *sought_nibbles_mismatch < *current_mismatch);
     SL_TRACE(log_,
              "The sought key '{}' is {} than current '{}'",
-             common::hex_lower(sought_nibbles),
+             sought_nibbles,
              sought_less_or_eq ? "less or eq" : "greater",
-             common::hex_lower(current.getKeyNibbles()));
+             current.getKeyNibbles());
     if (sought_less_or_eq) {
       if (current.isBranch()) {
         SL_TRACE(log_, "We're in a branch and search next node in subtree");
@@ -137,7 +136,7 @@ namespace kagome::storage::trie {
     bool sought_is_longer = current_is_prefix and not sought_is_prefix;
     if (sought_is_longer) {
       if (current.isBranch()) {
-        auto mismatch_pos = sought_nibbles_mismatch - sought_nibbles.begin();
+        auto mismatch_pos = common_length;
         auto &branch = current.asBranch();
         SAFE_CALL(child,
                   visitChildWithMinIdx(branch, sought_nibbles[mismatch_pos]))
@@ -313,11 +312,10 @@ namespace kagome::storage::trie {
     for (const auto &node_idx : search_state.getPath()) {
       const auto &node = node_idx.parent;
       auto idx = node_idx.child_idx;
-      std::ranges::copy(node.getKeyNibbles(),
-                        std::back_inserter<Buffer>(key_nibbles));
-      key_nibbles.putUint8(idx);
+      key_nibbles.append(node.getKeyNibbles());
+      key_nibbles.push_back(idx);
     }
-    key_nibbles.put(search_state.getCurrent().getKeyNibbles());
+    key_nibbles.append(search_state.getCurrent().getKeyNibbles());
     return key_nibbles.toByteBuffer();
   }
 
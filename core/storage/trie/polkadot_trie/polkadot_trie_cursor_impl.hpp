@@ -68,7 +68,7 @@ namespace kagome::storage::trie {
 
    private:
     outcome::result<void> seekLowerBoundInternal(const TrieNode &current,
-                                                 BufferView left_nibbles);
+                                                 NibblesView left_nibbles);
     outcome::result<bool> nextNodeWithValueInOuterTree();
     outcome::result<void> nextNodeWithValueInSubTree(
         const TrieNode &subtree_root);
@@ -100,8 +100,7 @@ namespace {
 
   uint32_t getCommonPrefixLength(const NibblesView &first,
                                  const NibblesView &second) {
-    auto &&[it, _] = std::ranges::mismatch(first, second);
-    return it - first.begin();
+    return first.commonPrefixLength(second);
   }
 
   /**
@@ -153,7 +152,8 @@ namespace {
                  "its child");
       }
       auto nibbles = parent->getKeyNibbles();
-      nibbles.putUint8(idx).put(child->getKeyNibbles());
+      nibbles.push_back(idx);
+      nibbles.append(child->getKeyNibbles());
       parent->setKeyNibbles(std::move(nibbles));
     }
     return outcome::success();
@@ -236,8 +236,7 @@ namespace {
 
     if (std::greater_equal<>()(parent->getKeyNibbles().size(), prefix.size())) {
       // if this is the node to be detached -- detach it
-      if (std::equal(
-              prefix.begin(), prefix.end(), parent->getKeyNibbles().begin())) {
+      if (parent->getKeyNibbles().view().startsWith(prefix)) {
         // remove all children one by one according to limit
         if (parent->isBranch()) {
           auto &branch = parent->asBranch();
@@ -285,7 +284,7 @@ namespace {
 
     // if parent's key is smaller, and it is not a prefix of the prefix, don't
     // change anything
-    if (not startsWith(prefix, parent->getKeyNibbles())) {
+    if (not prefix.startsWith(parent->getKeyNibbles())) {
       return outcome::success();
     }
 
@@ -428,7 +427,7 @@ namespace kagome::storage::trie {
       // if we are not replacing previous leaf, then add it as a
       // child to the new branch
       if (parent->getKeyNibbles().size() > key_nibbles.size()) {
-        parent->setKeyNibbles(parent->getKeyNibbles().subbuffer(length + 1));
+        parent->setKeyNibbles(parentKey.subspan(length + 1));
         br->setChild(parentKey[length], parent);
       }
 
@@ -445,7 +444,7 @@ namespace kagome::storage::trie {
     } else {
       // otherwise, make the leaf a child of the branch and update its
       // partial key
-      parent->setKeyNibbles(parent->getKeyNibbles().subbuffer(length + 1));
+      parent->setKeyNibbles(parentKey.subspan(length + 1));
       br->setChild(parentKey[length], parent);
       br->setChild(key_nibbles[length], node);
     }
@@ -565,7 +564,7 @@ namespace kagome::storage::trie {
         return outcome::success();
       }
       auto common_length = getCommonPrefixLength(parent->getKeyNibbles(), path);
-      auto common_nibbles = parent->getKeyNibbles().view(0, common_length);
+      auto common_nibbles = parent->getKeyNibbles().first(common_length);
       // path is even less than the parent key (path is the prefix of the
       // parent key)
       if (path == common_nibbles
@@ -6,9 +6,150 @@
 
 #include "storage/trie/polkadot_trie/trie_node.hpp"
 
+#include <cstring>
+
 #include <boost/range/algorithm.hpp>
 
 namespace kagome::storage::trie {
+  size_t NibblesView::commonPrefixLength(const NibblesView &other) const {
+    auto n = std::min(size_, other.size_);
+    size_t i = 0;
+    if (offset_ == other.offset_) {
+      if (offset_ != 0) {
+        if (n == 0 or (*this)[0] != other[0]) {
+          return 0;
+        }
+        i = 1;
+      }
+      // both are byte aligned now
+      auto *l = data_ + (offset_ + i) / 2;
+      auto *r = other.data_ + (other.offset_ + i) / 2;
+      auto bytes = (n - i) / 2;
+      size_t k = 0;
+      for (; k + sizeof(uint64_t) <= bytes; k += sizeof(uint64_t)) {
+        uint64_t lw = 0, rw = 0;
+        std::memcpy(&lw, l + k, sizeof(uint64_t));
+        std::memcpy(&rw, r + k, sizeof(uint64_t));
+        if (lw != rw) {
+          break;
+        }
+      }
+      while (k < bytes and l[k] == r[k]) {
+        ++k;
+      }
+      i += 2 * k;
+    }
+    // unaligned views, the mismatching byte or the last odd nibble
+    while (i < n and (*this)[i] == other[i]) {
+      ++i;
+    }
+    return i;
+  }
+
+  common::Buffer NibblesView::toByteBuffer() const {
+    common::Buffer res(size_ / 2 + size_ % 2, 0);
+    size_t i = 0;
+    size_t j = 0;
+    if (size_ % 2 != 0) {
+      res[0] = (*this)[0];
+      i = 1;
+      j = 1;
+    }
+    if ((offset_ + i) % 2 == 0) {
+      if (i < size_) {
+        std::memcpy(res.data() + j, data_ + (offset_ + i) / 2, (size_ - i) / 2);
+      }
+      return res;
+    }
+    for (; i < size_; i += 2, ++j) {
+      res[j] = ((*this)[i] << 4u) | (*this)[i + 1];
+    }
+    return res;
+  }
+
+  std::string NibblesView::toHex() const {
+    static constexpr std::string_view kDigits = "0123456789abcdef";
+    std::string res;
+    res.reserve(size_);
+    for (auto nibble : *this) {
+      res.push_back(kDigits[nibble]);
+    }
+    return res;
+  }
+
+  KeyNibbles::KeyNibbles(const NibblesView &nibbles)
+      : size_{static_cast<uint32_t>(nibbles.size_)},
+        offset_{static_cast<uint8_t>(nibbles.offset_)} {
+    if (size_ == 0) {
+      offset_ = 0;
+      return;
+    }
+    auto bytes = (offset_ + size_ + 1) / 2;
+    bytes_.assign(nibbles.data_, nibbles.data_ + bytes);
+    // unused halves must be zero, so equal sequences have equal bytes
+    if (offset_ != 0) {
+      bytes_.front() &= 0xfu;
+    }
+    if ((offset_ + size_) % 2 != 0) {
+      bytes_.back() &= 0xf0u;
+    }
+  }
+
+  KeyNibbles::KeyNibbles(std::initializer_list<uint8_t> nibbles) {
+    bytes_.reserve(nibbles.size() / 2 + 1);
+    for (auto nibble : nibbles) {
+      push_back(nibble);
+    }
+  }
+
+  KeyNibbles::KeyNibbles(const common::Buffer &nibbles) {
+    bytes_.reserve(nibbles.size() / 2 + 1);
+    for (auto nibble : nibbles) {
+      push_back(nibble);
+    }
+  }
+
+  void KeyNibbles::push_back(uint8_t nibble) {
+    BOOST_ASSERT(nibble <= 0xfu);
+    if ((offset_ + size_) % 2 == 0) {
+      bytes_.putUint8(nibble << 4u);
+    } else {
+      bytes_.back() |= nibble;
+    }
+    ++size_;
+  }
+
+  void KeyNibbles::append(const NibblesView &nibbles) {
+    if (nibbles.empty()) {
+      return;
+    }
+    if (empty()) {
+      *this = KeyNibbles{nibbles};
+      return;
+    }
+    if ((offset_ + size_) % 2 != nibbles.offset_) {
+      bytes_.reserve(bytes_.size() + nibbles.size() / 2 + 1);
+      for (auto nibble : nibbles) {
+        push_back(nibble);
+      }
+      return;
+    }
+    // the end of this is aligned with the start of nibbles, copy bytes
+    auto *data = nibbles.data_;
+    auto size = nibbles.size_;
+    if (nibbles.offset_ != 0) {
+      bytes_.back() |= data[0] & 0xfu;
+      ++data;
+      --size;
+      ++size_;
+    }
+    bytes_.insert(bytes_.end(), data, data + (size + 1) / 2);
+    if (size % 2 != 0) {
+      bytes_.back() &= 0xf0u;
+    }
+    size_ += size;
+  }
+
   uint16_t BranchNode::childrenBitmap() const {
     uint16_t bitmap = 0u;
     for (auto i = 0u; i < kMaxChildren; i++) {
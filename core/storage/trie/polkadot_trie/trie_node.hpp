@@ -6,8 +6,11 @@
 
 #pragma once
 
+#include <iterator>
 #include <optional>
+#include <string>
 
+#include <boost/assert.hpp>
 #include <fmt/format.h>
 
 #include "common/blob.hpp"
@@ -15,65 +18,284 @@
 
 namespace kagome::storage::trie {
 
-  using NibblesView = common::BufferView;
+  /**
+   * Non-owning view of a sequence of nibbles (halves of a byte) packed two per
+   * byte, high half first. A view may start in the middle of a byte.
+   */
+  class NibblesView {
+   public:
+    /**
+     * Random access iterator over nibbles, dereferences to a nibble value
+     */
+    class Iterator {
+     public:
+      using iterator_category = std::random_access_iterator_tag;
+      using iterator_concept = std::random_access_iterator_tag;
+      using value_type = uint8_t;
+      using difference_type = std::ptrdiff_t;
+      using reference = uint8_t;
+      using pointer = void;
+
+      Iterator() = default;
+      Iterator(const uint8_t *data, size_t pos) : data_{data}, pos_{pos} {}
+
+      uint8_t operator*() const {
+        return nibbleAt(data_, pos_);
+      }
+      uint8_t operator[](difference_type n) const {
+        return nibbleAt(data_, pos_ + n);
+      }
+
+      Iterator &operator++() {
+        ++pos_;
+        return *this;
+      }
+      Iterator operator++(int) {
+        auto it = *this;
+        ++pos_;
+        return it;
+      }
+      Iterator &operator--() {
+        --pos_;
+        return *this;
+      }
+      Iterator operator--(int) {
+        auto it = *this;
+        --pos_;
+        return it;
+      }
+      Iterator &operator+=(difference_type n) {
+        pos_ += n;
+        return *this;
+      }
+      Iterator &operator-=(difference_type n) {
+        pos_ -= n;
+        return *this;
+      }
+      friend Iterator operator+(Iterator it, difference_type n) {
+        return it += n;
+      }
+      friend Iterator operator+(difference_type n, Iterator it) {
+        return it += n;
+      }
+      friend Iterator operator-(Iterator it, difference_type n) {
+        return it -= n;
+      }
+      friend difference_type operator-(const Iterator &l, const Iterator &r) {
+        return static_cast<difference_type>(l.pos_)
+             - static_cast<difference_type>(r.pos_);
+      }
+      friend bool operator==(const Iterator &l, const Iterator &r) {
+        return l.pos_ == r.pos_;
+      }
+      friend auto operator<=>(const Iterator &l, const Iterator &r) {
+        return l.pos_ <=> r.pos_;
+      }
+
+     private:
+      const uint8_t *data_ = nullptr;
+      size_t pos_ = 0;
+    };
+
+    NibblesView() = default;
+
+    /**
+     * @param data packed nibbles
+     * @param offset index of the first nibble in \arg data
+     * @param size number of nibbles
+     */
+    NibblesView(const uint8_t *data, size_t offset, size_t size)
+        : data_{data + offset / 2}, offset_{offset % 2}, size_{size} {}
+
+    size_t size() const {
+      return size_;
+    }
+
+    bool empty() const {
+      return size_ == 0;
+    }
+
+    uint8_t operator[](size_t i) const {
+      BOOST_ASSERT(i < size_);
+      return nibbleAt(data_, offset_ + i);
+    }
+
+    Iterator begin() const {
+      return {data_, offset_};
+    }
+
+    Iterator end() const {
+      return {data_, offset_ + size_};
+    }
+
+    NibblesView subspan(size_t offset, size_t length = -1) const {
+      BOOST_ASSERT(offset <= size_);
+      return {data_, offset_ + offset, std::min(length, size_ - offset)};
+    }
+
+    NibblesView first(size_t length) const {
+      return subspan(0, length);
+    }
+
+    /**
+     * Length of the longest common prefix. Views with the same alignment are
+     * compared a machine word at a time.
+     */
+    size_t commonPrefixLength(const NibblesView &other) const;
+
+    bool startsWith(const NibblesView &prefix) const {
+      return prefix.size() <= size()
+         and commonPrefixLength(prefix) == prefix.size();
+    }
+
+    /**
+     * Def. 14 KeyEncode (inverse)
+     * Collects nibbles to bytes. If the number of nibbles is odd, the first
+     * nibble occupies the low half of the first byte, as in the partial key
+     * encoding of a trie node.
+     */
+    common::Buffer toByteBuffer() const;
+
+    /**
+     * One hex digit per nibble
+     */
+    std::string toHex() const;
+
+    friend bool operator==(const NibblesView &l, const NibblesView &r) {
+      return l.size() == r.size() and l.commonPrefixLength(r) == l.size();
+    }
+
+    static uint8_t nibbleAt(const uint8_t *data, size_t pos) {
+      auto byte = data[pos / 2];
+      return pos % 2 == 0 ? byte >> 4u : byte & 0xfu;
+    }
+
+   private:
+    friend class KeyNibbles;
+
+    const uint8_t *data_ = nullptr;
+    // 0 or 1, index of the first nibble in data_[0]
+    size_t offset_ = 0;
+    size_t size_ = 0;
+  };
+
+  /**
+   * Owning sequence of nibbles packed two per byte, half the memory of one
+   * nibble per byte. Nibbles may start in the low half of the first byte, so
+   * slices of other sequences and partial keys of odd length are copied
+   * without shifting.
+   */
+  class KeyNibbles {
+   public:
+    KeyNibbles() = default;
 
-  struct KeyNibbles : public common::Buffer {
-    using Buffer = common::Buffer;
+    KeyNibbles(const NibblesView &nibbles);
 
-    using Buffer::Buffer;
-    using Buffer::operator<=>;
+    /**
+     * @param nibbles one nibble per byte
+     */
+    KeyNibbles(std::initializer_list<uint8_t> nibbles);
 
-    KeyNibbles(common::Buffer b) : Buffer{std::move(b)} {}
+    /**
+     * @param nibbles one nibble per byte
+     */
+    KeyNibbles(const common::Buffer &nibbles);
 
     /**
      * Def. 14 KeyEncode
      * Splits a key to an array of nibbles (a nibble is a half of a byte)
      */
     static KeyNibbles fromByteBuffer(const common::BufferView &key) {
-      if (key.empty()) {
-        return {};
-      }
-      if (key.size() == 1 && key[0] == 0) {
-        return KeyNibbles{common::Buffer{0, 0}};
-      }
-
-      auto l = key.size() * 2;
-      KeyNibbles res(common::Buffer(l, 0));
-      for (size_t i = 0; i < key.size(); i++) {
-        res[2 * i] = key[i] >> 4u;
-        res[2 * i + 1] = key[i] & 0xfu;
-      }
-
+      KeyNibbles res;
+      res.bytes_ = common::Buffer{key};
+      res.size_ = static_cast<uint32_t>(key.size() * 2);
       return res;
     }
 
     /**
-     * Collects an array of nibbles to a key
+     * Takes nibbles in the partial key encoding of a trie node, the first
+     * nibble is in the low half of the first byte if \arg size is odd
      */
-    auto toByteBuffer() const {
-      Buffer res;
-      if (size() % 2 == 0) {
-        res = Buffer(size() / 2, 0);
-        for (size_t i = 0; i < size() / 2; i++) {
-          res[i] = toByte((*this)[i * 2], (*this)[i * 2 + 1]);
-        }
-      } else {
-        res = Buffer(size() / 2 + 1, 0);
-        res[0] = (*this)[0];
-        for (size_t i = 1; i < size() / 2 + 1; i++) {
-          res[i] = toByte((*this)[i * 2 - 1], (*this)[i * 2]);
-        }
+    static KeyNibbles fromPartialKey(common::Buffer bytes, size_t size) {
+      BOOST_ASSERT(bytes.size() == size / 2 + size % 2);
+      KeyNibbles res;
+      res.bytes_ = std::move(bytes);
+      res.offset_ = size % 2;
+      res.size_ = static_cast<uint32_t>(size);
+      if (res.offset_ != 0) {
+        res.bytes_[0] &= 0xfu;
       }
       return res;
     }
 
-    static uint8_t toByte(uint8_t high, uint8_t low) {
-      return (high << 4u) | (low & 0xfu);
+    NibblesView view() const {
+      return {bytes_.data(), offset_, size_};
+    }
+
+    operator NibblesView() const {
+      return view();
+    }
+
+    size_t size() const {
+      return size_;
     }
 
-    NibblesView subspan(size_t offset = 0, size_t length = -1) const {
-      return NibblesView{*this}.subspan(offset, length);
+    bool empty() const {
+      return size_ == 0;
     }
+
+    uint8_t operator[](size_t i) const {
+      return view()[i];
+    }
+
+    NibblesView::Iterator begin() const {
+      return view().begin();
+    }
+
+    NibblesView::Iterator end() const {
+      return view().end();
+    }
+
+    NibblesView subspan(size_t offset, size_t length = -1) const {
+      return view().subspan(offset, length);
+    }
+
+    NibblesView first(size_t length) const {
+      return view().first(length);
+    }
+
+    common::Buffer toByteBuffer() const {
+      return view().toByteBuffer();
+    }
+
+    std::string toHex() const {
+      return view().toHex();
+    }
+
+    void push_back(uint8_t nibble);
+
+    void append(const NibblesView &nibbles);
+
+    /**
+     * Heap memory used by the nibbles
+     */
+    size_t packedSize() const {
+      return bytes_.size();
+    }
+
+    friend bool operator==(const KeyNibbles &l, const KeyNibbles &r) {
+      return l.view() == r.view();
+    }
+
+    friend bool operator==(const KeyNibbles &l, const NibblesView &r) {
+      return l.view() == r;
+    }
+
+   private:
+    common::Buffer bytes_;
+    uint32_t size_ = 0;
+    // 0 or 1, index of the first nibble in bytes_[0]
+    uint8_t offset_ = 0;
   };
 
   using MerkleHash = common::Hash256;
@@ -397,15 +619,15 @@ namespace kagome::storage::trie {
 }  // namespace kagome::storage::trie
 
 template <>
-struct fmt::formatter<kagome::storage::trie::KeyNibbles> {
+struct fmt::formatter<kagome::storage::trie::NibblesView>
+    : fmt::formatter<std::string_view> {
   template <typename FormatContext>
-  auto format(const kagome::storage::trie::KeyNibbles &p,
+  auto format(const kagome::storage::trie::NibblesView &nibbles,
               FormatContext &ctx) const -> decltype(ctx.out()) {
-    if (p.size() % 2 != 0) {
-      fmt::format_to(ctx.out(), "{:x}", p[0]);
-    }
-    for (size_t i = p.size() % 2; i < p.size() - 1; i += 2) {
-      fmt::format_to(ctx.out(), "{:02x}", p.toByte(p[i], p[i + 1]));
-    }
+    return fmt::formatter<std::string_view>::format(nibbles.toHex(), ctx);
   }
 };
+
+template <>
+struct fmt::formatter<kagome::storage::trie::KeyNibbles>
+    : fmt::formatter<kagome::storage::trie::NibblesView> {};
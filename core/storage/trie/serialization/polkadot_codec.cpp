@@ -6,6 +6,8 @@
 
 #include "storage/trie/serialization/polkadot_codec.hpp"
 
+#include <atomic>
+
 #include "crypto/blake2/blake2b.h"
 #include "log/logger.hpp"
 #include "scale/kagome_scale.hpp"
@@ -32,6 +34,11 @@ OUTCOME_CPP_DEFINE_CATEGORY(kagome::storage::trie, PolkadotCodec::Error, e) {
 namespace kagome::storage::trie {
   constexpr size_t kMaxInlineValueSizeVersion1 = 33;
 
+  // nodes may be encoded concurrently, see TrieSerializerImpl::storeTrie
+  inline void countStat(uint64_t &stat, uint64_t n = 1) {
+    std::atomic_ref{stat}.fetch_add(n, std::memory_order_relaxed);
+  }
+
   inline common::Buffer ushortToBytes(uint16_t b) {
     common::Buffer out(2, 0);
     out[1] = (b >> 8u) & 0xffu;
@@ -93,7 +100,7 @@ namespace kagome::storage::trie {
       TraversePolicy policy,
       const ChildVisitor &child_visitor) const {
     if (node.isDummy()) {
-      ++stats_.node_cache_hits;
+      countStat(stats_.node_cache_hits);
       return node.asDummy().db_key;
     }
     // NOLINTNEXTLINE(cppcoreguidelines-pro-type-static-cast-downcast)
@@ -101,7 +108,7 @@ namespace kagome::storage::trie {
 
     if (auto cached_merkle_value = trie_node.getMerkleCache();
         cached_merkle_value.has_value()) {
-      ++stats_.node_cache_hits;
+      countStat(stats_.node_cache_hits);
       return *cached_merkle_value;
     }
     OUTCOME_TRY(enc, encodeNode(trie_node, version, policy, child_visitor));
@@ -130,8 +137,8 @@ namespace kagome::storage::trie {
       res = encodeLeaf(node.asLeaf(), version, child_visitor);
     }
     if (res) {
-      ++stats_.encoded_nodes;
-      stats_.total_encoded_nodes_size += res.value().size();
+      countStat(stats_.encoded_nodes);
+      countStat(stats_.total_encoded_nodes_size, res.value().size());
     }
     return res;
   }
@@ -229,8 +236,8 @@ namespace kagome::storage::trie {
       OUTCOME_TRY(value, scale::encode(*node.getValue().value));
       out += std::move(value);
     }
-    ++stats_.encoded_values;
-    stats_.total_encoded_values_size += out.size();
+    countStat(stats_.encoded_values);
+    countStat(stats_.total_encoded_values_size, out.size());
     return outcome::success();
   }
 
@@ -316,8 +323,8 @@ namespace kagome::storage::trie {
   outcome::result<std::shared_ptr<TrieNode>> PolkadotCodec::decodeNode(
       common::BufferView encoded_data) const {
     BufferStream stream{encoded_data};
-    stats_.total_decoded_nodes_size += encoded_data.size();
-    ++stats_.decoded_nodes;
+    countStat(stats_.total_decoded_nodes_size, encoded_data.size());
+    countStat(stats_.decoded_nodes);
     // decode the header with the node type and the partial key length
     OUTCOME_TRY(header, decodeHeader(stream));
     auto [type, pk_length] = header;
@@ -414,13 +421,8 @@ namespace kagome::storage::trie {
       }
       partial_key.putUint8(stream.next());
     }
-    // array of nibbles is much more convenient than array of bytes, though it
-    // wastes some memory
-    auto partial_key_nibbles = KeyNibbles::fromByteBuffer(partial_key);
-    if (nibbles_num % 2 == 1) {
-      partial_key_nibbles = partial_key_nibbles.subbuffer(1);
-    }
-    return partial_key_nibbles;
+    // packed nibbles use the same layout, so no conversion is needed
+    return KeyNibbles::fromPartialKey(std::move(partial_key), nibbles_num);
   }
 
   outcome::result<std::shared_ptr<TrieNode>> PolkadotCodec::decodeBranch(
@@ -0,0 +1,146 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "storage/trie/serialization/trie_node_cache.hpp"
+
+#include "metrics/histogram_timer.hpp"
+
+namespace kagome::storage::trie {
+  namespace {
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+    metrics::CounterHelper metric_trie_node_cache_hits{
+        "kagome_trie_node_cache_hits",
+        "Number of decoded trie nodes found in the cache",
+    };
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+    metrics::CounterHelper metric_trie_node_cache_misses{
+        "kagome_trie_node_cache_misses",
+        "Number of trie nodes which had to be loaded from the database and "
+        "decoded",
+    };
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+    metrics::CounterHelper metric_trie_node_cache_evictions{
+        "kagome_trie_node_cache_evictions",
+        "Number of decoded trie nodes evicted from the cache",
+    };
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+    metrics::GaugeHelper metric_trie_node_cache_size{
+        "kagome_trie_node_cache_size_bytes",
+        "Approximate memory used by the decoded trie node cache",
+    };
+
+    PolkadotTrie::NodePtr copyNode(const TrieNode &node) {
+      if (node.isBranch()) {
+        return std::make_shared<BranchNode>(node.asBranch());
+      }
+      return std::make_shared<LeafNode>(node.asLeaf());
+    }
+
+    size_t estimateSize(const TrieNode &node, size_t encoded_size) {
+      size_t size = encoded_size + node.getKeyNibbles().size();
+      if (auto &value = node.getValue().value) {
+        size += value->size();
+      }
+      if (node.isBranch()) {
+        size += sizeof(BranchNode)
+              + node.asBranch().childrenNum()
+                    * (sizeof(DummyNode) + 2 * sizeof(void *));
+      } else {
+        size += sizeof(LeafNode);
+      }
+      // list and map node overhead
+      return size + sizeof(common::Hash256) * 2 + 8 * sizeof(void *);
+    }
+  }  // namespace
+
+  TrieNodeCache::TrieNodeCache(size_t capacity_bytes)
+      : shard_capacity_{capacity_bytes / kShards} {}
+
+  TrieNodeCache::Shard &TrieNodeCache::shard(const common::Hash256 &hash) {
+    // hash is uniformly distributed already
+    return shards_[hash[0] % kShards];
+  }
+
+  PolkadotTrie::NodePtr TrieNodeCache::get(
+      const common::Hash256 &hash,
+      const std::function<void(common::BufferView)> &on_encoded) {
+    if (shard_capacity_ == 0) {
+      return nullptr;
+    }
+    auto &shard = this->shard(hash);
+    std::shared_ptr<const TrieNode> node;
+    {
+      std::unique_lock lock{shard.mutex};
+      auto it = shard.map.find(hash);
+      if (it == shard.map.end()) {
+        lock.unlock();
+        metric_trie_node_cache_misses->inc();
+        return nullptr;
+      }
+      shard.lru.splice(shard.lru.begin(), shard.lru, it->second);
+      node = it->second->node;
+      if (on_encoded) {
+        on_encoded(it->second->encoded);
+      }
+    }
+    metric_trie_node_cache_hits->inc();
+    return copyNode(*node);
+  }
+
+  void TrieNodeCache::put(const common::Hash256 &hash,
+                          const TrieNode &node,
+                          common::BufferView encoded) {
+    auto size = estimateSize(node, encoded.size());
+    if (size > shard_capacity_) {
+      return;
+    }
+    auto copy = copyNode(node);
+    auto &shard = this->shard(hash);
+    size_t evicted = 0;
+    int64_t size_diff = 0;
+    {
+      std::unique_lock lock{shard.mutex};
+      if (shard.map.contains(hash)) {
+        return;
+      }
+      shard.lru.emplace_front(Item{
+          .hash = hash,
+          .node = std::move(copy),
+          .encoded = common::Buffer{encoded},
+          .size = size,
+      });
+      shard.map.emplace(hash, shard.lru.begin());
+      shard.size += size;
+      size_diff += static_cast<int64_t>(size);
+      while (shard.size > shard_capacity_) {
+        auto &last = shard.lru.back();
+        shard.size -= last.size;
+        size_diff -= static_cast<int64_t>(last.size);
+        shard.map.erase(last.hash);
+        shard.lru.pop_back();
+        ++evicted;
+      }
+    }
+    if (evicted != 0) {
+      metric_trie_node_cache_evictions->inc(evicted);
+    }
+    if (size_diff >= 0) {
+      metric_trie_node_cache_size->inc(size_diff);
+    } else {
+      metric_trie_node_cache_size->dec(-size_diff);
+    }
+  }
+
+  size_t TrieNodeCache::sizeBytes() const {
+    size_t size = 0;
+    for (auto &shard : shards_) {
+      std::unique_lock lock{shard.mutex};
+      size += shard.size;
+    }
+    return size;
+  }
+
+}  // namespace kagome::storage::trie
@@ -0,0 +1,78 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <array>
+#include <list>
+#include <mutex>
+#include <unordered_map>
+
+#include "storage/trie/polkadot_trie/polkadot_trie.hpp"
+
+namespace kagome::storage::trie {
+
+  /**
+   * Process-wide cache of decoded trie nodes, keyed by their merkle hash.
+   * A node with a given hash never changes, so entries are never invalidated,
+   * only evicted in LRU order when the memory budget is exceeded.
+   * Encoded node is kept alongside the decoded one, so that proof recorders
+   * still see every loaded node on a cache hit.
+   * Tries modify their nodes in place, so the cache hands out copies, which
+   * share the (immutable) dummy children with the cached node.
+   */
+  class TrieNodeCache {
+   public:
+    /**
+     * @param capacity_bytes approximate memory budget, 0 disables the cache
+     */
+    explicit TrieNodeCache(size_t capacity_bytes);
+
+    TrieNodeCache(const TrieNodeCache &) = delete;
+    TrieNodeCache &operator=(const TrieNodeCache &) = delete;
+
+    /**
+     * Returns a copy of the cached node, which may be modified by the caller,
+     * and passes its encoding to \arg on_encoded while the entry is locked
+     */
+    PolkadotTrie::NodePtr get(
+        const common::Hash256 &hash,
+        const std::function<void(common::BufferView)> &on_encoded);
+
+    /**
+     * Stores a copy of a freshly decoded node
+     */
+    void put(const common::Hash256 &hash,
+             const TrieNode &node,
+             common::BufferView encoded);
+
+    size_t sizeBytes() const;
+
+   private:
+    static constexpr size_t kShards = 16;
+
+    struct Item {
+      common::Hash256 hash;
+      std::shared_ptr<const TrieNode> node;
+      common::Buffer encoded;
+      size_t size;
+    };
+
+    struct Shard {
+      mutable std::mutex mutex;
+      // most recently used first
+      std::list<Item> lru;
+      std::unordered_map<common::Hash256, std::list<Item>::iterator> map;
+      size_t size = 0;
+    };
+
+    Shard &shard(const common::Hash256 &hash);
+
+    size_t shard_capacity_;
+    std::array<Shard, kShards> shards_;
+  };
+
+}  // namespace kagome::storage::trie
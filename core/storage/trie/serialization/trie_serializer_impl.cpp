@@ -12,23 +12,106 @@
 #include "storage/trie/polkadot_trie/polkadot_trie_factory.hpp"
 #include "storage/trie/polkadot_trie/trie_node.hpp"
 #include "storage/trie/serialization/polkadot_codec.hpp"
+#include "storage/trie/serialization/trie_node_cache.hpp"
+#include "storage/trie/serialization/trie_state_overlay.hpp"
 #include "storage/trie/trie_storage_backend.hpp"
+#include "utils/parallel_for.hpp"
+#include "utils/thread_pool.hpp"
 
 namespace kagome::storage::trie {
+  // enough subtrees to keep every thread busy when their sizes differ
+  constexpr size_t kSubtreesPerThread = 4;
+
+  namespace {
+    /**
+     * Adds the stored state to the overlay once the batch is committed, so
+     * that the overlay never serves a state which is not in the database
+     */
+    class OverlayBatch final : public BufferBatch {
+     public:
+      OverlayBatch(std::unique_ptr<BufferBatch> batch,
+                   std::shared_ptr<TrieStateOverlay> overlay,
+                   const RootHash &root,
+                   TrieStateOverlay::Entries entries)
+          : batch_{std::move(batch)},
+            overlay_{std::move(overlay)},
+            root_{root},
+            entries_{std::move(entries)} {}
+
+      outcome::result<void> commit() override {
+        OUTCOME_TRY(batch_->commit());
+        if (entries_) {
+          overlay_->add(root_, std::move(*entries_));
+          entries_.reset();
+        }
+        return outcome::success();
+      }
+
+      outcome::result<void> put(const common::BufferView &key,
+                                BufferOrView &&value) override {
+        return batch_->put(key, std::move(value));
+      }
+
+      outcome::result<void> remove(const common::BufferView &key) override {
+        return batch_->remove(key);
+      }
+
+      void clear() override {
+        batch_->clear();
+        entries_.reset();
+      }
+
+     private:
+      std::unique_ptr<BufferBatch> batch_;
+      std::shared_ptr<TrieStateOverlay> overlay_;
+      RootHash root_;
+      std::optional<TrieStateOverlay::Entries> entries_;
+    };
+  }  // namespace
 
   TrieSerializerImpl::TrieSerializerImpl(
       std::shared_ptr<PolkadotTrieFactory> factory,
       std::shared_ptr<Codec> codec,
-      std::shared_ptr<TrieStorageBackend> node_backend)
+      std::shared_ptr<TrieStorageBackend> node_backend,
+      std::shared_ptr<TrieNodeCache> node_cache,
+      std::shared_ptr<ThreadPool> encode_pool,
+      size_t encode_threads,
+      std::shared_ptr<TrieStateOverlay> state_overlay)
       : trie_factory_{std::move(factory)},
         codec_{std::move(codec)},
         node_backend_{std::move(node_backend)},
+        node_cache_{std::move(node_cache)},
+        encode_pool_{std::move(encode_pool)},
+        encode_threads_{std::max<size_t>(1, encode_threads)},
+        state_overlay_{std::move(state_overlay)},
         logger_{log::createLogger("Trie Serializer", "trie")} {
     BOOST_ASSERT(trie_factory_ != nullptr);
     BOOST_ASSERT(codec_ != nullptr);
     BOOST_ASSERT(node_backend_ != nullptr);
   }
 
+  TrieSerializerImpl::~TrieSerializerImpl() = default;
+
+  Codec::ChildVisitor TrieSerializerImpl::collectTo(Entries &entries) {
+    return [&entries](Codec::Visitee visitee) -> outcome::result<void> {
+      if (auto child_data = std::get_if<Codec::ChildData>(&visitee);
+          child_data != nullptr) {
+        if (child_data->merkle_value.isHash()) {
+          entries.emplace_back(*child_data->merkle_value.asHash(),
+                               std::move(child_data->encoding));
+        }
+        return outcome::success();  // nodes which encoding is shorter
+                                    // than its hash are not stored in
+                                    // the DB separately
+      }
+      auto value_data = std::get<Codec::ValueData>(visitee);
+      // value_data.value is a reference to a buffer stored outside of
+      // this lambda, so taking its view should be okay
+      entries.emplace_back(value_data.hash, value_data.value.view());
+      return outcome::success();
+    };
+  }
+
   RootHash TrieSerializerImpl::getEmptyRootHash() const {
     return kEmptyRootHash;
   }
@@ -87,35 +170,118 @@ namespace kagome::storage::trie {
 
   outcome::result<std::pair<RootHash, std::unique_ptr<BufferBatch>>>
   TrieSerializerImpl::storeRootNode(TrieNode &node, StateVersion version) {
-    auto batch = node_backend_->batch();
+    Entries entries;
+    auto policy = Codec::TraversePolicy::IgnoreMerkleCache;
+    if (encode_pool_) {
+      OUTCOME_TRY(encoded, encodeChildrenInParallel(node, version, entries));
+      if (encoded) {
+        // merkle caches of the children have just been computed
+        policy = Codec::TraversePolicy::UncachedOnly;
+      }
+    }
     OUTCOME_TRY(
-        enc,
-        codec_->encodeNode(
-            node,
-            version,
-            Codec::TraversePolicy::IgnoreMerkleCache,
-            [&](Codec::Visitee visitee) -> outcome::result<void> {
-              if (auto child_data = std::get_if<Codec::ChildData>(&visitee);
-                  child_data != nullptr) {
-                if (child_data->merkle_value.isHash()) {
-                  return batch->put(child_data->merkle_value.asBuffer(),
-                                    std::move(child_data->encoding));
-                }
-                return outcome::success();  // nodes which encoding is shorter
-                                            // than its hash are not stored in
-                                            // the DB separately
-              }
-              auto value_data = std::get<Codec::ValueData>(visitee);
-              // value_data.value is a reference to a buffer stored outside of
-              // this lambda, so taking its view should be okay
-              return batch->put(value_data.hash, value_data.value.view());
-            }));
+        enc, codec_->encodeNode(node, version, policy, collectTo(entries)));
     auto hash = codec_->hash256(enc);
-    OUTCOME_TRY(batch->put(hash, std::move(enc)));
+    entries.emplace_back(hash, std::move(enc));
 
+    std::unique_ptr<BufferBatch> batch = node_backend_->batch();
+    if (state_overlay_) {
+      // the diff of the new state, values are views of the trie and are
+      // copied, as the batch may be committed after the trie is gone
+      TrieStateOverlay::Entries diff;
+      diff.reserve(entries.size());
+      for (auto &[key, value] : entries) {
+        diff.emplace_back(key, common::Buffer{value.view()});
+      }
+      batch = std::make_unique<OverlayBatch>(
+          std::move(batch), state_overlay_, hash, std::move(diff));
+    }
+    for (auto &[key, value] : entries) {
+      OUTCOME_TRY(batch->put(key, std::move(value)));
+    }
     return std::make_pair(hash, std::move(batch));
   }
 
+  outcome::result<bool> TrieSerializerImpl::encodeChildrenInParallel(
+      const TrieNode &root, StateVersion version, Entries &entries) const {
+    // split the trie level by level until there are enough subtrees, dummy
+    // nodes are already stored and are not descended into
+    std::vector<std::vector<const TrieNode *>> top_levels;
+    std::vector<const TrieNode *> subtrees{&root};
+    while (subtrees.size() < kSubtreesPerThread * encode_threads_) {
+      std::vector<const TrieNode *> level;
+      std::vector<const TrieNode *> next;
+      for (auto node : subtrees) {
+        if (not node->isBranch()) {
+          next.emplace_back(node);
+          continue;
+        }
+        level.emplace_back(node);
+        for (auto &child : node->asBranch().getChildren()) {
+          if (child != nullptr and not child->isDummy()) {
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-type-static-cast-downcast)
+            next.emplace_back(static_cast<const TrieNode *>(child.get()));
+          }
+        }
+      }
+      if (level.empty()) {
+        break;
+      }
+      top_levels.emplace_back(std::move(level));
+      subtrees = std::move(next);
+    }
+    if (top_levels.empty() or subtrees.size() < 2) {
+      return false;
+    }
+
+    struct Task {
+      Entries entries;
+      outcome::result<void> result = outcome::success();
+    };
+    std::vector<Task> tasks(subtrees.size());
+    // subtrees are disjoint, so each task touches its own nodes only
+    parallelFor(*encode_pool_->io_context(), subtrees.size(), [&](size_t i) {
+      tasks[i].result = encodeSubtree(*subtrees[i],
+                                      version,
+                                      Codec::TraversePolicy::IgnoreMerkleCache,
+                                      tasks[i].entries);
+    });
+
+    // collect in the order of subtrees, so the batch doesn't depend on
+    // scheduling
+    for (auto &task : tasks) {
+      OUTCOME_TRY(task.result);
+      entries.insert(entries.end(),
+                     std::make_move_iterator(task.entries.begin()),
+                     std::make_move_iterator(task.entries.end()));
+    }
+    // children of the top nodes are encoded now, the root is left to the
+    // caller
+    for (auto level = top_levels.size() - 1; level > 0; --level) {
+      for (auto node : top_levels[level]) {
+        OUTCOME_TRY(encodeSubtree(
+            *node, version, Codec::TraversePolicy::UncachedOnly, entries));
+      }
+    }
+    return true;
+  }
+
+  outcome::result<void> TrieSerializerImpl::encodeSubtree(
+      const TrieNode &node,
+      StateVersion version,
+      Codec::TraversePolicy policy,
+      Entries &entries) const {
+    OUTCOME_TRY(
+        enc, codec_->encodeNode(node, version, policy, collectTo(entries)));
+    auto merkle = codec_->merkleValue(enc);
+    // a stale cache must not be used for an inlined node by the parent
+    node.setMerkleCache(merkle.asHash());
+    if (auto hash = merkle.asHash()) {
+      entries.emplace_back(*hash, std::move(enc));
+    }
+    return outcome::success();
+  }
+
   outcome::result<PolkadotTrie::NodePtr> TrieSerializerImpl::retrieveNode(
       const DummyNode &node, const OnNodeLoaded &on_node_loaded) const {
     OUTCOME_TRY(n, retrieveNode(node.db_key, on_node_loaded));
@@ -129,7 +295,28 @@ namespace kagome::storage::trie {
     }
     BufferOrView enc;
     auto hash = db_key.asHash();
-    if (hash) {
+    if (hash and node_cache_) {
+      auto cached =
+          node_cache_->get(*hash, [&](common::BufferView encoded) {
+            if (on_node_loaded) {
+              on_node_loaded(*hash, encoded);
+            }
+          });
+      if (cached) {
+        return cached;
+      }
+    }
+    // shared with the overlay, kept alive until the node is decoded
+    std::shared_ptr<const common::Buffer> recent;
+    if (hash and state_overlay_) {
+      recent = state_overlay_->get(*hash);
+    }
+    if (recent) {
+      enc = common::BufferView{*recent};
+      if (on_node_loaded) {
+        on_node_loaded(*hash, enc);
+      }
+    } else if (hash) {
       BOOST_OUTCOME_TRY(enc, node_backend_->get(*hash));
       if (on_node_loaded) {
         on_node_loaded(*hash, enc);
@@ -142,6 +329,9 @@ namespace kagome::storage::trie {
     auto node = std::dynamic_pointer_cast<TrieNode>(n);
     if (hash) {
       node->setMerkleCache(*hash);
+      if (node_cache_) {
+        node_cache_->put(*hash, *node, enc);
+      }
     }
     return node;
   }
@@ -149,6 +339,14 @@ namespace kagome::storage::trie {
   outcome::result<std::optional<common::Buffer>>
   TrieSerializerImpl::retrieveValue(const common::Hash256 &hash,
                                     const OnNodeLoaded &on_node_loaded) const {
+    if (state_overlay_) {
+      if (auto value = state_overlay_->get(hash)) {
+        if (on_node_loaded) {
+          on_node_loaded(hash, *value);
+        }
+        return std::optional{*value};
+      }
+    }
     OUTCOME_TRY(value, node_backend_->tryGet(hash));
     return common::map_optional(std::move(value),
                                 [&](common::BufferOrView &&value) {
@@ -7,13 +7,20 @@
 #pragma once
 
 #include "storage/trie/polkadot_trie/trie_node.hpp"
+#include "storage/trie/serialization/codec.hpp"
 #include "storage/trie/serialization/trie_serializer.hpp"
 
 #include "log/logger.hpp"
 #include "storage/buffer_map_types.hpp"
+
+namespace kagome {
+  class ThreadPool;
+}  // namespace kagome
+
 namespace kagome::storage::trie {
-  class Codec;
   class PolkadotTrieFactory;
+  class TrieNodeCache;
+  class TrieStateOverlay;
   class TrieStorageBackend;
   struct BranchNode;
   struct TrieNode;
@@ -23,10 +30,23 @@ namespace kagome::storage::trie {
 
   class TrieSerializerImpl : public TrieSerializer {
    public:
-    TrieSerializerImpl(std::shared_ptr<PolkadotTrieFactory> factory,
-                       std::shared_ptr<Codec> codec,
-                       std::shared_ptr<TrieStorageBackend> node_backend);
-    ~TrieSerializerImpl() override = default;
+    /**
+     * @param node_cache shared cache of decoded nodes, may be null
+     * @param encode_pool pool to encode and hash independent subtrees on in
+     * storeTrie, null encodes the whole trie on the calling thread
+     * @param encode_threads number of threads of \arg encode_pool to split the
+     * trie for
+     * @param state_overlay overlay of recently stored states, may be null
+     */
+    TrieSerializerImpl(
+        std::shared_ptr<PolkadotTrieFactory> factory,
+        std::shared_ptr<Codec> codec,
+        std::shared_ptr<TrieStorageBackend> node_backend,
+        std::shared_ptr<TrieNodeCache> node_cache = nullptr,
+        std::shared_ptr<ThreadPool> encode_pool = nullptr,
+        size_t encode_threads = 1,
+        std::shared_ptr<TrieStateOverlay> state_overlay = nullptr);
+    ~TrieSerializerImpl() override;
 
     RootHash getEmptyRootHash() const override;
 
@@ -57,6 +77,9 @@ namespace kagome::storage::trie {
         const OnNodeLoaded &on_node_loaded) const override;
 
    private:
+    // keys and encodings of nodes and values to be written, in batch order
+    using Entries = std::vector<std::pair<common::Hash256, BufferOrView>>;
+
     /**
      * Writes a node to a persistent storage, recursively storing its
      * descendants as well. Then replaces the node children to dummy nodes to
@@ -65,9 +88,39 @@ namespace kagome::storage::trie {
     outcome::result<std::pair<RootHash, std::unique_ptr<BufferBatch>>>
     storeRootNode(TrieNode &node, StateVersion version);
 
+    /**
+     * Visitor which appends stored children and values to \arg entries
+     */
+    static Codec::ChildVisitor collectTo(Entries &entries);
+
+    /**
+     * Encodes the subtrees below the top levels of the trie on the encode
+     * pool and the calling thread, then the top levels themselves bottom up,
+     * so that every non-dummy child of \arg root has an up-to-date merkle
+     * cache. Subtrees not yet started by the pool are encoded by the calling
+     * thread, so it never waits for a busy or stopped pool.
+     * @return false if the trie is too small to split, nothing is encoded then
+     */
+    outcome::result<bool> encodeChildrenInParallel(const TrieNode &root,
+                                                   StateVersion version,
+                                                   Entries &entries) const;
+
+    /**
+     * Encodes a node, collecting it and its stored descendants and values to
+     * \arg entries, and updates the merkle cache of the node
+     */
+    outcome::result<void> encodeSubtree(const TrieNode &node,
+                                        StateVersion version,
+                                        Codec::TraversePolicy policy,
+                                        Entries &entries) const;
+
     std::shared_ptr<PolkadotTrieFactory> trie_factory_;
     std::shared_ptr<Codec> codec_;
     std::shared_ptr<TrieStorageBackend> node_backend_;
+    std::shared_ptr<TrieNodeCache> node_cache_;
+    std::shared_ptr<ThreadPool> encode_pool_;
+    size_t encode_threads_;
+    std::shared_ptr<TrieStateOverlay> state_overlay_;
     log::Logger logger_;
   };
 }  // namespace kagome::storage::trie
@@ -0,0 +1,163 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "storage/trie/serialization/trie_state_overlay.hpp"
+
+#include <algorithm>
+
+#include "metrics/histogram_timer.hpp"
+#include "primitives/block_header.hpp"
+
+namespace kagome::storage::trie {
+  namespace {
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+    metrics::CounterHelper metric_trie_state_overlay_hits{
+        "kagome_trie_state_overlay_hits",
+        "Number of trie nodes and values read from the overlay of recent "
+        "states",
+    };
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+    metrics::CounterHelper metric_trie_state_overlay_misses{
+        "kagome_trie_state_overlay_misses",
+        "Number of trie nodes and values not found in the overlay of recent "
+        "states",
+    };
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+    metrics::GaugeHelper metric_trie_state_overlay_states{
+        "kagome_trie_state_overlay_states",
+        "Number of recent states kept in the overlay",
+    };
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+    metrics::GaugeHelper metric_trie_state_overlay_size{
+        "kagome_trie_state_overlay_size_bytes",
+        "Size of nodes and values kept in the overlay of recent states",
+    };
+  }  // namespace
+
+  TrieStateOverlay::TrieStateOverlay(
+      size_t max_states,
+      size_t capacity_bytes,
+      primitives::events::ChainSubscriptionEnginePtr chain_sub_engine)
+      : max_states_{max_states},
+        capacity_bytes_{capacity_bytes},
+        logger_{log::createLogger("TrieStateOverlay", "trie")} {
+    if (chain_sub_engine != nullptr and max_states_ != 0) {
+      chain_sub_.emplace(std::move(chain_sub_engine));
+      // subscription is owned by the overlay, so it doesn't outlive it
+      chain_sub_->onFinalize([this](const primitives::BlockHeader &header) {
+        onFinalized(header.state_root);
+      });
+    }
+  }
+
+  void TrieStateOverlay::add(const RootHash &root, Entries entries) {
+    if (max_states_ == 0) {
+      return;
+    }
+    std::unique_lock lock{mutex_};
+    if (std::ranges::any_of(states_,
+                            [&](const State &s) { return s.root == root; })) {
+      return;
+    }
+    size_t new_size = 0;
+    for (auto &[hash, encoded] : entries) {
+      if (not entries_.contains(hash)) {
+        new_size += encoded.size();
+      }
+    }
+    if (new_size > capacity_bytes_) {
+      SL_DEBUG(logger_,
+               "State {} diff of {} bytes doesn't fit into the overlay",
+               root,
+               new_size);
+      return;
+    }
+    State state{.root = root, .hashes = {}};
+    state.hashes.reserve(entries.size());
+    for (auto &[hash, encoded] : entries) {
+      auto [it, inserted] = entries_.try_emplace(hash);
+      if (inserted) {
+        it->second.encoded = std::make_shared<const common::Buffer>(
+            std::move(encoded).intoBuffer());
+        size_ += it->second.encoded->size();
+      }
+      ++it->second.refs;
+      state.hashes.emplace_back(hash);
+    }
+    states_.emplace_back(std::move(state));
+    while (states_.size() > 1
+           and (states_.size() > max_states_ or size_ > capacity_bytes_)) {
+      popOldest();
+    }
+    updateMetrics();
+  }
+
+  std::shared_ptr<const common::Buffer> TrieStateOverlay::get(
+      const common::Hash256 &hash) const {
+    if (max_states_ == 0) {
+      return nullptr;
+    }
+    {
+      std::shared_lock lock{mutex_};
+      if (auto it = entries_.find(hash); it != entries_.end()) {
+        auto encoded = it->second.encoded;
+        lock.unlock();
+        metric_trie_state_overlay_hits->inc();
+        return encoded;
+      }
+    }
+    metric_trie_state_overlay_misses->inc();
+    return nullptr;
+  }
+
+  void TrieStateOverlay::onFinalized(const RootHash &root) {
+    std::unique_lock lock{mutex_};
+    auto it = std::ranges::find_if(
+        states_, [&](const State &s) { return s.root == root; });
+    if (it == states_.end()) {
+      return;
+    }
+    // ancestors of the finalized state and forks committed before it
+    auto dropped = std::distance(states_.begin(), it);
+    for (; dropped != 0; --dropped) {
+      popOldest();
+    }
+    updateMetrics();
+  }
+
+  bool TrieStateOverlay::contains(const RootHash &root) const {
+    std::shared_lock lock{mutex_};
+    return std::ranges::any_of(states_,
+                               [&](const State &s) { return s.root == root; });
+  }
+
+  size_t TrieStateOverlay::statesNum() const {
+    std::shared_lock lock{mutex_};
+    return states_.size();
+  }
+
+  size_t TrieStateOverlay::sizeBytes() const {
+    std::shared_lock lock{mutex_};
+    return size_;
+  }
+
+  void TrieStateOverlay::popOldest() {
+    for (auto &hash : states_.front().hashes) {
+      auto it = entries_.find(hash);
+      if (--it->second.refs == 0) {
+        size_ -= it->second.encoded->size();
+        entries_.erase(it);
+      }
+    }
+    states_.pop_front();
+  }
+
+  void TrieStateOverlay::updateMetrics() {
+    metric_trie_state_overlay_states->set(states_.size());
+    metric_trie_state_overlay_size->set(size_);
+  }
+
+}  // namespace kagome::storage::trie
@@ -0,0 +1,104 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <deque>
+#include <memory>
+#include <shared_mutex>
+#include <unordered_map>
+
+#include "common/buffer.hpp"
+#include "common/buffer_or_view.hpp"
+#include "log/logger.hpp"
+#include "primitives/event_types.hpp"
+#include "storage/trie/types.hpp"
+
+namespace kagome::storage::trie {
+
+  /**
+   * In-memory overlay of recently committed, not yet finalized, states.
+   * Keeps the nodes and values written by the commit of each state, i.e. the
+   * diff of the state to its parent, keyed by the state root, so that reads
+   * of recent states (the blocks just executed) don't go to the database.
+   * Nodes are content addressed, so a node written by an older state which is
+   * still in the overlay serves reads of its descendants as well.
+   * States are evicted oldest first when the overlay is over its bounds, and
+   * on finalization, when everything committed before the finalized state is
+   * dropped.
+   */
+  class TrieStateOverlay {
+   public:
+    using Entries =
+        std::vector<std::pair<common::Hash256, common::BufferOrView>>;
+
+    /**
+     * @param max_states number of states to keep, 0 disables the overlay
+     * @param capacity_bytes limit of the size of nodes and values kept
+     * @param chain_sub_engine finalization events to evict states on, may be
+     * null
+     */
+    TrieStateOverlay(
+        size_t max_states,
+        size_t capacity_bytes,
+        primitives::events::ChainSubscriptionEnginePtr chain_sub_engine =
+            nullptr);
+
+    TrieStateOverlay(const TrieStateOverlay &) = delete;
+    TrieStateOverlay &operator=(const TrieStateOverlay &) = delete;
+
+    /**
+     * Adds the nodes and values written by the commit of state \arg root,
+     * must be called after the commit succeeded
+     */
+    void add(const RootHash &root, Entries entries);
+
+    /**
+     * Returns the encoded node or the value with \arg hash, if it was written
+     * by one of the states in the overlay. It is shared with the overlay and
+     * stays valid after the state is evicted.
+     */
+    std::shared_ptr<const common::Buffer> get(
+        const common::Hash256 &hash) const;
+
+    /**
+     * Drops the states committed before the state \arg root, which is kept
+     * as the base of unfinalized states
+     */
+    void onFinalized(const RootHash &root);
+
+    bool contains(const RootHash &root) const;
+
+    size_t statesNum() const;
+
+    size_t sizeBytes() const;
+
+   private:
+    struct State {
+      RootHash root;
+      std::vector<common::Hash256> hashes;
+    };
+
+    struct Entry {
+      std::shared_ptr<const common::Buffer> encoded;
+      size_t refs = 0;
+    };
+
+    void popOldest();
+    void updateMetrics();
+
+    size_t max_states_;
+    size_t capacity_bytes_;
+    mutable std::shared_mutex mutex_;
+    // in order of commit
+    std::deque<State> states_;
+    std::unordered_map<common::Hash256, Entry> entries_;
+    size_t size_ = 0;
+    std::optional<primitives::events::ChainSub> chain_sub_;
+    log::Logger logger_;
+  };
+
+}  // namespace kagome::storage::trie
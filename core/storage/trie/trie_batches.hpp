@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include "scale/encode_append.hpp"
 #include "storage/buffer_map_types.hpp"
 #include "storage/trie/polkadot_trie/polkadot_trie_cursor.hpp"
 #include "storage/trie/types.hpp"
@@ -37,5 +38,18 @@ namespace kagome::storage::trie {
 
     virtual outcome::result<std::optional<std::shared_ptr<TrieBatch>>>
     createChildBatch(common::BufferView path) = 0;
+
+    /**
+     * Append SCALE-encoded item to SCALE-encoded vector stored by key.
+     * Value which is missing or is not a vector is replaced by new vector.
+     * Copies the whole vector, overlays may override it to do better.
+     */
+    virtual outcome::result<void> append(const BufferView &key,
+                                         BufferView item) {
+      OUTCOME_TRY(value, tryGet(key));
+      auto vec = value ? std::move(*value).intoBuffer() : Buffer{};
+      OUTCOME_TRY(scale::append_or_new_vec(vec.asVector(), item));
+      return put(key, std::move(vec));
+    }
   };
 }  // namespace kagome::storage::trie
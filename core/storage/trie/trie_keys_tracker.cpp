@@ -0,0 +1,137 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "storage/trie/trie_keys_tracker.hpp"
+
+#include <algorithm>
+
+#include "storage/trie/serialization/trie_serializer.hpp"
+
+namespace kagome::storage::trie {
+  namespace {
+    bool sameMerkle(const MerkleValue &lhs, const MerkleValue &rhs) {
+      return std::ranges::equal(lhs.asBuffer(), rhs.asBuffer());
+    }
+  }  // namespace
+
+  TrieKeysTracker::TrieKeysTracker(
+      std::shared_ptr<const TrieSerializer> serializer,
+      std::span<const common::Buffer> keys)
+      : serializer_{std::move(serializer)} {
+    BOOST_ASSERT(serializer_ != nullptr);
+    keys_.reserve(keys.size());
+    for (auto &key : keys) {
+      keys_.emplace_back(KeyState{.nibbles = KeyNibbles::fromByteBuffer(key)});
+    }
+  }
+
+  outcome::result<void> TrieKeysTracker::update(const RootHash &root,
+                                                const OnChange &on_change) {
+    prev_nodes_ = std::move(nodes_);
+    nodes_.clear();
+    for (size_t i = 0; i < keys_.size(); ++i) {
+      OUTCOME_TRY(changed, updateKey(keys_[i], root));
+      if (changed) {
+        on_change(i, keys_[i].value);
+      }
+    }
+    return outcome::success();
+  }
+
+  outcome::result<bool> TrieKeysTracker::updateKey(KeyState &key,
+                                                   const RootHash &root) {
+    const auto &prev_path = key.path;
+    size_t prev_idx = 0;
+    std::vector<PathStep> path;
+    std::optional<MerkleValue> merkle{root};
+    size_t offset = 0;
+    PolkadotTrie::ConstNodePtr found;
+    while (merkle) {
+      while (prev_idx < prev_path.size()
+             and prev_path[prev_idx].offset < offset) {
+        ++prev_idx;
+      }
+      if (key.initialized and prev_idx < prev_path.size()
+          and prev_path[prev_idx].offset == offset
+          and sameMerkle(prev_path[prev_idx].merkle, *merkle)) {
+        // same subtree at the same position of the key path, so the rest of
+        // the path and the value are the same too
+        path.insert(
+            path.end(), prev_path.begin() + prev_idx, prev_path.end());
+        key.path = std::move(path);
+        return false;
+      }
+      path.emplace_back(PathStep{offset, *merkle});
+
+      OUTCOME_TRY(node, loadNode(*merkle));
+      merkle.reset();
+      if (node == nullptr) {
+        break;
+      }
+      auto &partial = node->getKeyNibbles();
+      if (not key.nibbles.subspan(offset).startsWith(partial)) {
+        break;
+      }
+      offset += partial.size();
+      if (offset == key.nibbles.size()) {
+        found = std::move(node);
+        break;
+      }
+      if (not node->isBranch()) {
+        break;
+      }
+      auto child = node->asBranch().getChild(key.nibbles[offset]);
+      if (child == nullptr) {
+        break;
+      }
+      ++offset;
+      merkle.emplace(child->asDummy().db_key);
+    }
+
+    std::optional<common::Buffer> value;
+    std::optional<common::Hash256> value_hash;
+    if (found != nullptr) {
+      auto &node_value = found->getValue();
+      value_hash = node_value.hash;
+      if (node_value.value) {
+        value = node_value.value;
+      } else if (node_value.hash) {
+        if (key.initialized and key.value_hash == node_value.hash) {
+          value = key.value;
+        } else {
+          OUTCOME_TRY(loaded, serializer_->retrieveValue(*node_value.hash, {}));
+          value = std::move(loaded);
+        }
+      }
+    }
+
+    key.path = std::move(path);
+    auto changed = not key.initialized or value != key.value;
+    key.initialized = true;
+    key.value = std::move(value);
+    key.value_hash = value_hash;
+    return changed;
+  }
+
+  outcome::result<PolkadotTrie::ConstNodePtr> TrieKeysTracker::loadNode(
+      const MerkleValue &merkle) {
+    auto hash = merkle.asHash();
+    if (hash) {
+      if (auto it = nodes_.find(*hash); it != nodes_.end()) {
+        return it->second;
+      }
+      if (auto node = prev_nodes_.extract(*hash)) {
+        return nodes_.insert(std::move(node)).position->second;
+      }
+    }
+    OUTCOME_TRY(node, serializer_->retrieveNode(merkle));
+    ++decoded_nodes_;
+    if (hash) {
+      nodes_.emplace(*hash, node);
+    }
+    return node;
+  }
+}  // namespace kagome::storage::trie
@@ -0,0 +1,81 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <span>
+#include <unordered_map>
+
+#include "storage/trie/polkadot_trie/polkadot_trie.hpp"
+#include "storage/trie/types.hpp"
+
+namespace kagome::storage::trie {
+  class TrieSerializer;
+
+  /**
+   * Follows values of a fixed set of keys through a sequence of states.
+   * For every key the path of merkle values from the root down to the key's
+   * node is remembered. When moving to the next state, the key path is walked
+   * from the new root until it meets a subtree with the same merkle value at
+   * the same nibble offset as in the previous state, in which case the value
+   * is known to be unchanged and the rest of the path is not loaded.
+   * Decoded nodes are shared between keys and states by their hash. Only
+   * nodes used by the current and the previous state are kept, so memory
+   * does not grow with the number of states.
+   */
+  class TrieKeysTracker {
+   public:
+    /**
+     * Called for each key whose value differs from the previous state (for
+     * every key on the first state).
+     */
+    using OnChange = std::function<void(
+        size_t key_index, const std::optional<common::Buffer> &value)>;
+
+    TrieKeysTracker(std::shared_ptr<const TrieSerializer> serializer,
+                    std::span<const common::Buffer> keys);
+
+    outcome::result<void> update(const RootHash &root,
+                                 const OnChange &on_change);
+
+    /**
+     * Number of nodes loaded from the storage and decoded so far
+     */
+    size_t decodedNodes() const {
+      return decoded_nodes_;
+    }
+
+   private:
+    struct PathStep {
+      size_t offset;
+      MerkleValue merkle;
+    };
+
+    struct KeyState {
+      KeyNibbles nibbles;
+      std::vector<PathStep> path;
+      std::optional<common::Buffer> value;
+      std::optional<common::Hash256> value_hash;
+      bool initialized = false;
+    };
+
+    // returns true if the value of the key changed
+    outcome::result<bool> updateKey(KeyState &key, const RootHash &root);
+
+    outcome::result<PolkadotTrie::ConstNodePtr> loadNode(
+        const MerkleValue &merkle);
+
+    std::shared_ptr<const TrieSerializer> serializer_;
+    std::vector<KeyState> keys_;
+    using Nodes =
+        std::unordered_map<common::Hash256, PolkadotTrie::ConstNodePtr>;
+    // nodes used by the current state
+    Nodes nodes_;
+    // nodes used by the previous state, moved to `nodes_` when used again
+    Nodes prev_nodes_;
+    size_t decoded_nodes_ = 0;
+  };
+}  // namespace kagome::storage::trie
@@ -22,6 +22,13 @@ namespace kagome::storage::trie_pruner {
       return outcome::success();
     }
 
+    outcome::result<std::unique_ptr<BufferBatch>> addNewState(
+        const trie::PolkadotTrie &,
+        trie::StateVersion,
+        std::unique_ptr<BufferBatch> batch) override {
+      return batch;
+    }
+
     outcome::result<void> pruneFinalized(
         const primitives::BlockHeader &) override {
       return outcome::success();
@@ -0,0 +1,234 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "storage/trie_pruner/impl/ref_count_store.hpp"
+
+#include <cstring>
+
+#include <boost/assert.hpp>
+
+#include "scale/kagome_scale.hpp"
+
+namespace kagome::storage::trie_pruner {
+
+  // initial table capacity, power of two
+  constexpr size_t kMinSlots = 1 << 10;
+
+  RefCountStore::RefCountStore(std::shared_ptr<BufferStorage> space,
+                               uint8_t prefix,
+                               size_t cache_size)
+      : space_{std::move(space)},
+        key_prefix_{common::Buffer::fromString(kKeyMarker).putUint8(prefix)},
+        cache_size_{cache_size},
+        slots_(kMinSlots) {}
+
+  outcome::result<void> RefCountStore::load() {
+    if (not space_) {
+      return outcome::success();
+    }
+    OUTCOME_TRY(raw, space_->tryGet(sizeKey()));
+    size_ = 0;
+    if (raw) {
+      OUTCOME_TRY(size, scale::decode<uint64_t>(*raw));
+      size_ = size;
+    }
+    return outcome::success();
+  }
+
+  outcome::result<RefCountStore::Count> RefCountStore::get(const Key &key) {
+    if (auto slot = find(key)) {
+      return slot->count;
+    }
+    if (not space_) {
+      return 0;
+    }
+    OUTCOME_TRY(raw, space_->tryGet(dbKey(key)));
+    Count count = 0;
+    if (raw) {
+      OUTCOME_TRY(decoded, decodeCount(*raw));
+      count = decoded;
+    }
+    // cache absent keys too, new nodes are looked up repeatedly
+    insert(key).count = count;
+    return count;
+  }
+
+  void RefCountStore::set(const Key &key, Count count) {
+    auto slot = find(key);
+    BOOST_ASSERT(slot != nullptr or not space_);
+    if (slot == nullptr) {
+      slot = &insert(key);
+    }
+    if (slot->count == count) {
+      return;
+    }
+    if (slot->count == 0) {
+      ++size_;
+      size_dirty_ = true;
+    } else if (count == 0) {
+      --size_;
+      size_dirty_ = true;
+    }
+    slot->count = count;
+    if (not space_) {
+      if (count == 0) {
+        erase(*slot);
+      }
+      return;
+    }
+    if (not slot->dirty) {
+      slot->dirty = true;
+      dirty_.emplace_back(key);
+    }
+  }
+
+  outcome::result<void> RefCountStore::flush(BufferBatch &batch) {
+    if (not space_) {
+      return outcome::success();
+    }
+    for (auto &key : dirty_) {
+      // dirty slots are not dropped by `shrink`
+      auto slot = find(key);
+      BOOST_ASSERT(slot != nullptr and slot->dirty);
+      if (slot->count == 0) {
+        OUTCOME_TRY(batch.remove(dbKey(key)));
+      } else {
+        OUTCOME_TRY(count, scale::encode(slot->count));
+        OUTCOME_TRY(batch.put(dbKey(key), common::Buffer{std::move(count)}));
+      }
+      slot->dirty = false;
+    }
+    dirty_.clear();
+    if (size_dirty_) {
+      OUTCOME_TRY(size, scale::encode(static_cast<uint64_t>(size_)));
+      OUTCOME_TRY(batch.put(sizeKey(), common::Buffer{std::move(size)}));
+      size_dirty_ = false;
+    }
+    return outcome::success();
+  }
+
+  void RefCountStore::shrink() {
+    // dirty counts are not flushed yet
+    if (not space_ or used_ <= cache_size_ or not dirty_.empty()) {
+      return;
+    }
+    slots_ = std::vector<Slot>(kMinSlots);
+    used_ = 0;
+  }
+
+  outcome::result<void> RefCountStore::clear() {
+    slots_ = std::vector<Slot>(kMinSlots);
+    dirty_.clear();
+    used_ = 0;
+    size_ = 0;
+    size_dirty_ = false;
+    if (not space_) {
+      return outcome::success();
+    }
+    auto batch = space_->batch();
+    auto cursor = space_->cursor();
+    OUTCOME_TRY(cursor->seek(key_prefix_));
+    while (cursor->isValid()) {
+      auto db_key = *cursor->key();
+      if (not startsWith(db_key, key_prefix_)) {
+        break;
+      }
+      if (isCountKey(db_key) or db_key == sizeKey()) {
+        OUTCOME_TRY(batch->remove(db_key));
+      }
+      OUTCOME_TRY(cursor->next());
+    }
+    return batch->commit();
+  }
+
+  size_t RefCountStore::index(const Key &key) const {
+    // keys are cryptographic hashes, any 8 bytes are uniformly distributed
+    uint64_t h = 0;
+    memcpy(&h, key.data(), sizeof(h));
+    return h & (slots_.size() - 1);
+  }
+
+  RefCountStore::Slot *RefCountStore::find(const Key &key) {
+    auto mask = slots_.size() - 1;
+    for (auto i = index(key);; i = (i + 1) & mask) {
+      auto &slot = slots_[i];
+      if (not slot.used) {
+        return nullptr;
+      }
+      if (slot.key == key) {
+        return &slot;
+      }
+    }
+  }
+
+  RefCountStore::Slot &RefCountStore::insert(const Key &key) {
+    // keep load factor below 3/4
+    if ((used_ + 1) * 4 > slots_.size() * 3) {
+      grow();
+    }
+    auto mask = slots_.size() - 1;
+    auto i = index(key);
+    while (slots_[i].used) {
+      i = (i + 1) & mask;
+    }
+    auto &slot = slots_[i];
+    slot = Slot{.key = key, .used = true};
+    ++used_;
+    return slot;
+  }
+
+  void RefCountStore::erase(Slot &slot) {
+    // backward shift deletion, keeps probe sequences without tombstones
+    auto mask = slots_.size() - 1;
+    auto hole = static_cast<size_t>(&slot - slots_.data());
+    for (auto i = (hole + 1) & mask; slots_[i].used; i = (i + 1) & mask) {
+      auto ideal = index(slots_[i].key);
+      // move entry into hole if hole lies between its ideal slot and itself
+      if (((i - ideal) & mask) >= ((i - hole) & mask)) {
+        slots_[hole] = slots_[i];
+        hole = i;
+      }
+    }
+    slots_[hole] = Slot{};
+    --used_;
+  }
+
+  void RefCountStore::grow() {
+    auto old = std::move(slots_);
+    slots_ = std::vector<Slot>(old.size() * 2);
+    used_ = 0;
+    for (auto &slot : old) {
+      if (slot.used) {
+        insert(slot.key) = slot;
+      }
+    }
+  }
+
+  common::Buffer RefCountStore::dbKey(const Key &key) const {
+    common::Buffer db_key;
+    db_key.reserve(key_prefix_.size() + Key::size());
+    db_key.put(key_prefix_);
+    db_key.put(key);
+    return db_key;
+  }
+
+  bool RefCountStore::isCountKey(common::BufferView db_key) const {
+    return db_key.size() == key_prefix_.size() + Key::size()
+       and startsWith(db_key, key_prefix_);
+  }
+
+  common::Buffer RefCountStore::sizeKey() const {
+    common::Buffer db_key{key_prefix_};
+    db_key.put(":size");
+    return db_key;
+  }
+
+  outcome::result<RefCountStore::Count> RefCountStore::decodeCount(
+      common::BufferView raw) {
+    return scale::decode<Count>(raw);
+  }
+
+}  // namespace kagome::storage::trie_pruner
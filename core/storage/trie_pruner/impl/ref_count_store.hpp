@@ -0,0 +1,134 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <memory>
+#include <string_view>
+#include <vector>
+
+#include "common/blob.hpp"
+#include "storage/buffer_map_types.hpp"
+
+namespace kagome::storage::trie_pruner {
+
+  /**
+   * Reference counts of trie nodes (or values) tracked by the pruner.
+   * Counts live in a compact open-addressing table of full hashes, without
+   * per-entry allocations.
+   * If backed by a storage space, the table is only a write-back cache:
+   * changed counts are written to the space on `flush` and the table is
+   * dropped by `shrink` when it grows beyond `cache_size` entries, so memory
+   * stays bounded and counts survive restarts.
+   * The space may be shared with trie nodes, which keys are 32 byte hashes.
+   * Count keys are `kKeyMarker`, store prefix and hash of counted node, so
+   * they are told apart from node keys both by the marker and by the length.
+   * Without a space all counts are kept in memory.
+   */
+  class RefCountStore {
+   public:
+    using Key = common::Hash256;
+    using Count = uint32_t;
+
+    /// Starts every key written by stores to their space
+    static constexpr std::string_view kKeyMarker = ":trie_pruner_ref_count:";
+
+    /**
+     * @param space storage for counts, may be null
+     * @param prefix distinguishes several stores sharing one space
+     * @param cache_size number of entries kept in memory after `shrink`
+     */
+    RefCountStore(std::shared_ptr<BufferStorage> space,
+                  uint8_t prefix,
+                  size_t cache_size);
+
+    bool persistent() const {
+      return space_ != nullptr;
+    }
+
+    /// Reads number of tracked entries from space
+    outcome::result<void> load();
+
+    /// Number of keys with non-zero count
+    size_t size() const {
+      return size_;
+    }
+
+    outcome::result<Count> get(const Key &key);
+
+    /// Must be preceded by `get` of same key
+    void set(const Key &key, Count count);
+
+    /// Writes counts changed since previous flush to batch
+    outcome::result<void> flush(BufferBatch &batch);
+
+    /// Drops cached counts if cache is too large, after flushed batch commit
+    void shrink();
+
+    /// Removes all counts, from space too
+    outcome::result<void> clear();
+
+    template <typename F>
+    outcome::result<void> forEach(const F &f) {
+      for (auto &slot : slots_) {
+        if (slot.used and slot.count != 0) {
+          f(slot.key, slot.count);
+        }
+      }
+      if (not space_) {
+        return outcome::success();
+      }
+      auto cursor = space_->cursor();
+      OUTCOME_TRY(cursor->seek(key_prefix_));
+      while (cursor->isValid()) {
+        auto db_key = *cursor->key();
+        if (not startsWith(db_key, key_prefix_)) {
+          break;
+        }
+        if (isCountKey(db_key)) {
+          auto key = Key::fromSpan(db_key.view(key_prefix_.size())).value();
+          if (find(key) == nullptr) {
+            OUTCOME_TRY(count, decodeCount(cursor->value()->view()));
+            f(key, count);
+          }
+        }
+        OUTCOME_TRY(cursor->next());
+      }
+      return outcome::success();
+    }
+
+   private:
+    struct Slot {
+      Key key;
+      Count count = 0;
+      bool used = false;
+      bool dirty = false;
+    };
+
+    Slot *find(const Key &key);
+    Slot &insert(const Key &key);
+    void erase(Slot &slot);
+    void grow();
+    size_t index(const Key &key) const;
+
+    common::Buffer dbKey(const Key &key) const;
+    bool isCountKey(common::BufferView db_key) const;
+    common::Buffer sizeKey() const;
+    static outcome::result<Count> decodeCount(common::BufferView raw);
+
+    std::shared_ptr<BufferStorage> space_;
+    /// `kKeyMarker` followed by prefix of this store
+    common::Buffer key_prefix_;
+    size_t cache_size_;
+    std::vector<Slot> slots_;
+    /// Keys of dirty slots, so that `flush` doesn't scan whole table
+    std::vector<Key> dirty_;
+    size_t used_ = 0;
+    size_t size_ = 0;
+    bool size_dirty_ = false;
+  };
+
+}  // namespace kagome::storage::trie_pruner
@@ -8,6 +8,8 @@
 
 #include <chrono>
 #include <cstdint>
+#include <functional>
+#include <mutex>
 #include <queue>
 #include <thread>
 
@@ -47,6 +49,57 @@ OUTCOME_CPP_DEFINE_CATEGORY(kagome::storage::trie_pruner,
 
 namespace kagome::storage::trie_pruner {
 
+  // prefixes of node and value ref counts, after RefCountStore::kKeyMarker
+  constexpr uint8_t kNodeRefCountPrefix = 'n';
+  constexpr uint8_t kValueRefCountPrefix = 'v';
+
+  namespace {
+    /**
+     * Batch of new trie nodes with their ref counts.
+     * Holds pruner lock until committed or destroyed, so that counts of later
+     * prunes are not overwritten by older counts of this batch.
+     * Lock order is pruner lock, then locks taken by commit of the wrapped
+     * batch (database write and trie state overlay), which never call back
+     * into the pruner. The batch is committed right after `addNewState`
+     * returns, so pruning waits for one database write per block at most.
+     */
+    class RefCountsBatch final : public BufferBatch {
+     public:
+      RefCountsBatch(std::unique_ptr<BufferBatch> batch,
+                     std::unique_lock<std::mutex> lock,
+                     std::function<void()> on_commit)
+          : batch_{std::move(batch)},
+            lock_{std::move(lock)},
+            on_commit_{std::move(on_commit)} {}
+
+      outcome::result<void> commit() override {
+        BOOST_ASSERT(lock_.owns_lock());
+        OUTCOME_TRY(batch_->commit());
+        on_commit_();
+        lock_.unlock();
+        return outcome::success();
+      }
+
+      outcome::result<void> put(const common::BufferView &key,
+                                common::BufferOrView &&value) override {
+        return batch_->put(key, std::move(value));
+      }
+
+      outcome::result<void> remove(const common::BufferView &key) override {
+        return batch_->remove(key);
+      }
+
+      void clear() override {
+        batch_->clear();
+      }
+
+     private:
+      std::unique_ptr<BufferBatch> batch_;
+      std::unique_lock<std::mutex> lock_;
+      std::function<void()> on_commit_;
+    };
+  }  // namespace
+
   template <typename F>
     requires std::
         is_invocable_r_v<outcome::result<void>, F, const trie::RootHash &>
@@ -85,6 +138,10 @@ namespace kagome::storage::trie_pruner {
         codec_{std::move(codec)},
         storage_{std::move(storage)},
         hasher_{std::move(hasher)},
+        ref_count_space_{storage_->getSpace(kTrieNode)},
+        ref_count_{ref_count_space_, kNodeRefCountPrefix, kRefCountCacheSize},
+        value_ref_count_{
+            ref_count_space_, kValueRefCountPrefix, kRefCountCacheSize},
         prune_thread_handler_{thread_pool->handler(*app_state_manager)},
         prune_queue_{2},
         pruning_depth_{config->statePruningDepth()},
@@ -120,6 +177,14 @@ namespace kagome::storage::trie_pruner {
         return false;
       }
     }
+    if (auto res = ref_count_.load(); !res) {
+      SL_ERROR(logger_, "Failed to load node ref counts: {}", res.error());
+      return false;
+    }
+    if (auto res = value_ref_count_.load(); !res) {
+      SL_ERROR(logger_, "Failed to load value ref counts: {}", res.error());
+      return false;
+    }
     SL_DEBUG(
         logger_,
         "Initialize trie pruner with pruning depth {}, last pruned block {}",
@@ -216,9 +281,12 @@ namespace kagome::storage::trie_pruner {
 
     auto node_batch = node_storage_->batch();
     OUTCOME_TRY(prune(*node_batch, root));
+    last_pruned_block_ = block_info;
+    // counts are written in same batch as removal of nodes
+    OUTCOME_TRY(saveRefCounts(*node_batch, true));
     OUTCOME_TRY(node_batch->commit());
+    shrinkRefCounts();
 
-    last_pruned_block_ = block_info;
     OUTCOME_TRY(savePersistentState());
     return outcome::success();
   }
@@ -232,8 +300,10 @@ namespace kagome::storage::trie_pruner {
     auto node_batch = node_storage_->batch();
     auto value_batch = node_storage_->batch();
     OUTCOME_TRY(prune(*node_batch, root));
+    OUTCOME_TRY(saveRefCounts(*node_batch, false));
     OUTCOME_TRY(node_batch->commit());
     OUTCOME_TRY(value_batch->commit());
+    shrinkRefCounts();
     return outcome::success();
   }
 
@@ -281,21 +351,13 @@ namespace kagome::storage::trie_pruner {
     while (!queued_nodes.empty()) {
       auto [hash, node, depth] = queued_nodes.back();
       queued_nodes.pop_back();
-      auto ref_count_it = ref_count_.find(hash);
-      if (ref_count_it == ref_count_.end()) {
-        nodes_unknown++;
-        continue;
-      }
-
-      auto &ref_count = ref_count_it->second;
+      OUTCOME_TRY(ref_count, ref_count_.get(hash));
       if (ref_count == 0) {
-        SL_WARN(logger_,
-                "Pruner encountered an unindexed node {} while pruning, this "
-                "indicates a bug",
-                hash);
+        nodes_unknown++;
         continue;
       }
       ref_count--;
+      ref_count_.set(hash, ref_count);
       SL_TRACE(logger_,
                "Prune - {} - Node {}, ref count {}",
                depth,
@@ -305,20 +367,18 @@ namespace kagome::storage::trie_pruner {
       if (immortal_nodes_.find(hash) == immortal_nodes_.end()
           && ref_count == 0) {
         nodes_removed++;
-        ref_count_.erase(ref_count_it);
         OUTCOME_TRY(node_batch.remove(hash));
         auto hash_opt = node->getValue().hash;
         if (hash_opt.has_value()) {
           auto &value_hash = *hash_opt;
-          auto value_ref_it = value_ref_count_.find(value_hash);
-          if (value_ref_it == value_ref_count_.end()) {
+          OUTCOME_TRY(value_ref_count, value_ref_count_.get(value_hash));
+          if (value_ref_count == 0) {
             values_unknown++;
           } else {
-            auto &value_ref_count = value_ref_it->second;
             value_ref_count--;
+            value_ref_count_.set(value_hash, value_ref_count);
             if (value_ref_count == 0) {
               OUTCOME_TRY(node_batch.remove(value_hash));
-              value_ref_count_.erase(value_ref_it);
               values_removed++;
             }
           }
@@ -391,6 +451,7 @@ namespace kagome::storage::trie_pruner {
     std::unique_lock lock{mutex_};
     OUTCOME_TRY(trie, serializer_->retrieveTrie(state_root));
     OUTCOME_TRY(addNewStateWith(*trie, version));
+    OUTCOME_TRY(commitRefCounts(false));
     return outcome::success();
   }
 
@@ -400,9 +461,26 @@ namespace kagome::storage::trie_pruner {
     std::unique_lock lock{mutex_};
     KAGOME_PROFILE_END(pruner_add_state_mutex);
     OUTCOME_TRY(addNewStateWith(new_trie, version));
+    OUTCOME_TRY(commitRefCounts(false));
     return outcome::success();
   }
 
+  outcome::result<std::unique_ptr<BufferBatch>> TriePrunerImpl::addNewState(
+      const trie::PolkadotTrie &new_trie,
+      trie::StateVersion version,
+      std::unique_ptr<BufferBatch> batch) {
+    KAGOME_PROFILE_START(pruner_add_state_mutex);
+    std::unique_lock lock{mutex_};
+    KAGOME_PROFILE_END(pruner_add_state_mutex);
+    OUTCOME_TRY(addNewStateWith(new_trie, version));
+    if (!ref_count_space_) {
+      return batch;
+    }
+    OUTCOME_TRY(saveRefCounts(*batch, false));
+    return std::make_unique<RefCountsBatch>(
+        std::move(batch), std::move(lock), [this] { shrinkRefCounts(); });
+  }
+
   outcome::result<storage::trie::RootHash> TriePrunerImpl::addNewStateWith(
       const trie::PolkadotTrie &new_trie, trie::StateVersion version) {
     if (new_trie.getRoot() == nullptr) {
@@ -435,7 +513,7 @@ namespace kagome::storage::trie_pruner {
     while (!queued_nodes.empty()) {
       auto [node, hash] = queued_nodes.back();
       queued_nodes.pop_back();
-      auto &ref_count = ref_count_[hash];
+      OUTCOME_TRY(ref_count, ref_count_.get(hash));
       if (ref_count == 0 && !thorough_pruning_) {
         OUTCOME_TRY(hash_is_in_storage, node_storage_->contains(hash));
         if (hash_is_in_storage) {
@@ -450,6 +528,7 @@ namespace kagome::storage::trie_pruner {
         }
       }
       ref_count++;
+      ref_count_.set(hash, ref_count);
       SL_TRACE(logger_, "Add node {}, ref count {}", hash.toHex(), ref_count);
 
       referenced_nodes_num++;
@@ -458,7 +537,7 @@ namespace kagome::storage::trie_pruner {
       if (is_new_node_with_value) {
         auto value_hash_opt = getValueHash(*codec_, *node, version);
         if (value_hash_opt) {
-          auto &value_ref_count = value_ref_count_[*value_hash_opt];
+          OUTCOME_TRY(value_ref_count, value_ref_count_.get(*value_hash_opt));
           if (value_ref_count == 0 && !thorough_pruning_) {
             OUTCOME_TRY(contains_value,
                         node_storage_->contains(*value_hash_opt));
@@ -467,6 +546,7 @@ namespace kagome::storage::trie_pruner {
             }
           }
           value_ref_count++;
+          value_ref_count_.set(*value_hash_opt, value_ref_count);
           referenced_values_num++;
         }
       }
@@ -551,6 +631,14 @@ namespace kagome::storage::trie_pruner {
     static log::Logger logger =
         log::createLogger("PrunerStateRecovery", "storage");
     auto last_pruned_block = last_pruned_block_;
+    OUTCOME_TRY(have_ref_counts, haveRefCounts());
+    if (have_ref_counts) {
+      SL_INFO(logger,
+              "Use persisted ref counts of {} nodes, last pruned block {}",
+              ref_count_.size(),
+              last_pruned_block);
+      return outcome::success();
+    }
     if (!last_pruned_block.has_value()) {
       if (block_tree.bestBlock().number != 0) {
         SL_WARN(logger,
@@ -575,6 +663,7 @@ namespace kagome::storage::trie_pruner {
             block_tree.getBlockHeader(block_tree.getGenesisBlockHash()));
         OUTCOME_TRY(trie, serializer_->retrieveTrie(genesis_header.state_root));
         OUTCOME_TRY(addNewStateWith(*trie, trie::StateVersion::V0));
+        OUTCOME_TRY(commitRefCounts(true));
       }
     } else {
       OUTCOME_TRY(base_block_header,
@@ -601,7 +690,11 @@ namespace kagome::storage::trie_pruner {
              "Restore state - last pruned block {}",
              last_pruned_block.blockInfo());
 
-    ref_count_.clear();
+    if (ref_count_space_) {
+      OUTCOME_TRY(ref_count_space_->remove(REF_COUNTS_INFO_KEY));
+    }
+    OUTCOME_TRY(ref_count_.clear());
+    OUTCOME_TRY(value_ref_count_.clear());
 
     std::queue<primitives::BlockHash> block_queue;
 
@@ -620,6 +713,7 @@ namespace kagome::storage::trie_pruner {
       }
       OUTCOME_TRY(base_tree, std::move(base_tree_res));
       OUTCOME_TRY(addNewStateWith(*base_tree, trie::StateVersion::V0));
+      OUTCOME_TRY(commitRefCounts(false));
       OUTCOME_TRY(children, block_tree.getChildren(base_block_hash));
       for (auto child : children) {
         block_queue.push(child);
@@ -645,6 +739,7 @@ namespace kagome::storage::trie_pruner {
       }
       OUTCOME_TRY(tree, tree_res);
       OUTCOME_TRY(addNewStateWith(*tree, trie::StateVersion::V0));
+      OUTCOME_TRY(commitRefCounts(false));
 
       OUTCOME_TRY(children, block_tree.getChildren(block_hash));
       for (auto child : children) {
@@ -652,6 +747,7 @@ namespace kagome::storage::trie_pruner {
       }
     }
     last_pruned_block_ = last_pruned_block.blockInfo();
+    OUTCOME_TRY(commitRefCounts(true));
     OUTCOME_TRY(savePersistentState());
     return outcome::success();
   }
@@ -667,6 +763,52 @@ namespace kagome::storage::trie_pruner {
     return outcome::success();
   }
 
+  outcome::result<void> TriePrunerImpl::saveRefCounts(BufferBatch &batch,
+                                                      bool update_info) {
+    if (!ref_count_space_) {
+      return outcome::success();
+    }
+    OUTCOME_TRY(ref_count_.flush(batch));
+    OUTCOME_TRY(value_ref_count_.flush(batch));
+    if (update_info) {
+      OUTCOME_TRY(enc_info,
+                  scale::encode(TriePrunerInfo{
+                      last_pruned_block_,
+                  }));
+      OUTCOME_TRY(
+          batch.put(REF_COUNTS_INFO_KEY, common::Buffer{std::move(enc_info)}));
+    }
+    return outcome::success();
+  }
+
+  outcome::result<void> TriePrunerImpl::commitRefCounts(bool update_info) {
+    if (!ref_count_space_) {
+      return outcome::success();
+    }
+    auto batch = node_storage_->batch();
+    OUTCOME_TRY(saveRefCounts(*batch, update_info));
+    OUTCOME_TRY(batch->commit());
+    shrinkRefCounts();
+    return outcome::success();
+  }
+
+  void TriePrunerImpl::shrinkRefCounts() {
+    ref_count_.shrink();
+    value_ref_count_.shrink();
+  }
+
+  outcome::result<bool> TriePrunerImpl::haveRefCounts() const {
+    if (!ref_count_space_) {
+      return false;
+    }
+    OUTCOME_TRY(encoded_info, ref_count_space_->tryGet(REF_COUNTS_INFO_KEY));
+    if (!encoded_info) {
+      return false;
+    }
+    OUTCOME_TRY(info, scale::decode<TriePrunerInfo>(*encoded_info));
+    return info.last_pruned_block == last_pruned_block_;
+  }
+
   void TriePrunerImpl::restoreStateAtFinalized(
       const blockchain::BlockTree &block_tree) {
     std::unique_lock lock{mutex_};
@@ -14,7 +14,6 @@
 #include <chrono>
 #include <memory>
 #include <queue>
-#include <unordered_map>
 #include <unordered_set>
 
 #include <boost/assert.hpp>
@@ -24,6 +23,7 @@
 #include "common/worker_thread_pool.hpp"
 #include "log/logger.hpp"
 #include "storage/buffer_map_types.hpp"
+#include "storage/trie_pruner/impl/ref_count_store.hpp"
 #include "utils/pool_handler.hpp"
 
 namespace kagome::application {
@@ -60,6 +60,13 @@ namespace kagome::storage::trie_pruner {
     inline static const common::Buffer TRIE_PRUNER_INFO_KEY =
         ":trie_pruner:info"_buf;
 
+    /// Pruner info which persisted ref counts correspond to
+    inline static const common::Buffer REF_COUNTS_INFO_KEY =
+        ":trie_pruner:ref_counts"_buf;
+
+    /// Number of ref counts kept in memory between prunes
+    static constexpr size_t kRefCountCacheSize = 1 << 20;
+
     struct TriePrunerInfo {
       std::optional<primitives::BlockInfo> last_pruned_block;
     };
@@ -83,6 +90,11 @@ namespace kagome::storage::trie_pruner {
     outcome::result<void> addNewState(const trie::PolkadotTrie &new_trie,
                                       trie::StateVersion version) override;
 
+    outcome::result<std::unique_ptr<BufferBatch>> addNewState(
+        const trie::PolkadotTrie &new_trie,
+        trie::StateVersion version,
+        std::unique_ptr<BufferBatch> batch) override;
+
     void schedulePrune(const trie::RootHash &root,
                        const primitives::BlockInfo &block_info,
                        PruneReason reason) override;
@@ -102,16 +114,14 @@ namespace kagome::storage::trie_pruner {
       return ref_count_.size();
     }
 
-    size_t getRefCountOf(const common::Hash256 &node) const {
-      auto it = ref_count_.find(node);
-      return it == ref_count_.end() ? 0 : it->second;
+    outcome::result<size_t> getRefCountOf(const common::Hash256 &node) const {
+      OUTCOME_TRY(count, ref_count_.get(node));
+      return count;
     }
 
     template <typename F>
-    void forRefCounts(const F &f) {
-      for (auto &[node, count] : ref_count_) {
-        f(node, count);
-      }
+    outcome::result<void> forRefCounts(const F &f) {
+      return ref_count_.forEach(f);
     }
 
     std::optional<uint32_t> getPruningDepth() const override {
@@ -144,9 +154,21 @@ namespace kagome::storage::trie_pruner {
     // store the persistent pruner info to the database
     outcome::result<void> savePersistentState() const;
 
+    // write changed ref counts to the batch, with current pruner info if
+    // the counts are consistent with it
+    outcome::result<void> saveRefCounts(BufferBatch &batch, bool update_info);
+
+    // write changed ref counts to the database in a separate batch
+    outcome::result<void> commitRefCounts(bool update_info);
+
+    // drop cached ref counts if there are too many, after batch with them is
+    // committed
+    void shrinkRefCounts();
+
+    // whether persisted ref counts correspond to the last pruned block
+    outcome::result<bool> haveRefCounts() const;
+
     mutable std::mutex mutex_;
-    std::unordered_map<common::Hash256, size_t> ref_count_;
-    std::unordered_map<common::Hash256, size_t> value_ref_count_;
     std::unordered_set<common::Hash256> immortal_nodes_;
 
     std::optional<primitives::BlockInfo> last_pruned_block_;
@@ -155,6 +177,11 @@ namespace kagome::storage::trie_pruner {
     std::shared_ptr<const storage::trie::Codec> codec_;
     std::shared_ptr<storage::SpacedStorage> storage_;
     std::shared_ptr<const crypto::Hasher> hasher_;
+    // ref counts are kept in the trie node space, so that they are written in
+    // same batch with nodes
+    std::shared_ptr<BufferStorage> ref_count_space_;
+    mutable RefCountStore ref_count_;
+    RefCountStore value_ref_count_;
     std::shared_ptr<PoolHandler> prune_thread_handler_;
 
     struct PendingPrune {
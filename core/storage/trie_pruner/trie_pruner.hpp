@@ -12,6 +12,7 @@
 #include "primitives/block_header.hpp"
 #include "primitives/block_id.hpp"
 #include "primitives/common.hpp"
+#include "storage/buffer_map_types.hpp"
 #include "storage/trie/types.hpp"
 
 namespace kagome::blockchain {
@@ -62,6 +63,17 @@ namespace kagome::storage::trie_pruner {
     virtual outcome::result<void> addNewState(
         const trie::PolkadotTrie &new_trie, trie::StateVersion version) = 0;
 
+    /**
+     * Same as above, but changed reference counts are written to \arg batch
+     * with nodes of the new trie, so that they are committed together.
+     * Pruning waits until returned batch is committed or destroyed.
+     * @return batch to commit instead of \arg batch
+     */
+    virtual outcome::result<std::unique_ptr<BufferBatch>> addNewState(
+        const trie::PolkadotTrie &new_trie,
+        trie::StateVersion version,
+        std::unique_ptr<BufferBatch> batch) = 0;
+
     /**
      * Schedule pruning the trie state of a block \param block_info.
      * Nodes belonging to this trie are deleted if no other trie references
@@ -55,6 +55,16 @@ namespace kagome {
       return std::ref(it->second->v);
     }
 
+    /// Same as `get`, but doesn't mark entry as used, so it may be called
+    /// concurrently
+    std::optional<std::reference_wrapper<const V>> peek(const K &k) const {
+      auto it = map_.find(k);
+      if (it == map_.end()) {
+        return std::nullopt;
+      }
+      return std::cref(it->second->v);
+    }
+
     V &put(const K &k, V v) {
       return put2(k, std::move(v)).first->second->v;
     }
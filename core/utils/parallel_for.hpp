@@ -0,0 +1,160 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <atomic>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include <boost/asio/post.hpp>
+#include <libp2p/common/final_action.hpp>
+
+namespace kagome {
+
+  /**
+   * Tasks posted to a thread pool, which are waited for together.
+   * Every task is run once, either by the pool or by the waiting thread,
+   * whichever takes it first. The waiting thread runs tasks not started by the
+   * pool instead of waiting for them, so it may be a thread of the pool
+   * itself, and it doesn't wait for tasks dropped by a stopped pool.
+   */
+  class TaskGroup {
+   public:
+    TaskGroup() = default;
+    TaskGroup(const TaskGroup &) = delete;
+    TaskGroup &operator=(const TaskGroup &) = delete;
+
+    /// Waits for tasks, so that none of them outlives what it references
+    ~TaskGroup() {
+      for (auto &task : tasks_) {
+        task->run();
+      }
+      for (auto &task : tasks_) {
+        task->done.wait(false);
+      }
+    }
+
+    /**
+     * Posts \arg f to \arg pool, which is `boost::asio::io_context` or
+     * `PoolHandler`
+     */
+    template <typename Pool>
+    void spawn(Pool &pool, std::function<void()> f) {
+      auto task = std::make_shared<Task>(std::move(f));
+      tasks_.emplace_back(task);
+      // handler may run after the group is destroyed, when its task was taken
+      // by the waiting thread
+      post(pool, [task] { task->run(); });
+    }
+
+    /**
+     * Runs tasks not started by pool, waits for the rest.
+     * Rethrows the first exception thrown by tasks, after all of them finish.
+     */
+    void wait() {
+      auto tasks = std::move(tasks_);
+      tasks_.clear();
+      for (auto &task : tasks) {
+        task->run();
+      }
+      for (auto &task : tasks) {
+        task->done.wait(false);
+      }
+      for (auto &task : tasks) {
+        if (task->error) {
+          std::rethrow_exception(task->error);
+        }
+      }
+    }
+
+   private:
+    struct Task {
+      explicit Task(std::function<void()> f) : f{std::move(f)} {}
+
+      void run() {
+        if (taken.exchange(true)) {
+          return;
+        }
+        ::libp2p::common::FinalAction finish([&] {
+          done = true;
+          done.notify_all();
+        });
+        try {
+          f();
+        } catch (...) {
+          error = std::current_exception();
+        }
+      }
+
+      std::function<void()> f;
+      std::atomic_bool taken = false;
+      std::atomic_bool done = false;
+      std::exception_ptr error;
+    };
+
+    std::vector<std::shared_ptr<Task>> tasks_;
+  };
+
+  /**
+   * Calls \arg f for every index in [0, \arg n) on \arg pool and the calling
+   * thread, and waits for all of them.
+   * Rethrows the first exception thrown by \arg f.
+   */
+  template <typename Pool>
+  void parallelFor(Pool &pool,
+                   size_t n,
+                   const std::function<void(size_t)> &f) {
+    if (n == 1) {
+      f(0);
+      return;
+    }
+    TaskGroup tasks;
+    for (size_t i = 0; i < n; ++i) {
+      tasks.spawn(pool, [&f, i] { f(i); });
+    }
+    tasks.wait();
+  }
+
+  /**
+   * Calls \arg f for every index in [0, \arg n) on \arg pool without waiting
+   * for them, then calls \arg done on the thread which finished last.
+   * \arg done is called even if \arg f throws, but not if the pool is stopped
+   * and drops some of the calls.
+   */
+  template <typename Pool>
+  void parallelForAsync(Pool &pool,
+                        size_t n,
+                        std::function<void(size_t)> f,
+                        std::function<void()> done) {
+    if (n == 0) {
+      done();
+      return;
+    }
+    struct Shared {
+      std::function<void(size_t)> f;
+      std::function<void()> done;
+      std::atomic_size_t unfinished;
+    };
+    auto shared = std::make_shared<Shared>();
+    shared->f = std::move(f);
+    shared->done = std::move(done);
+    shared->unfinished = n;
+    for (size_t i = 0; i < n; ++i) {
+      post(pool, [shared, i] {
+        ::libp2p::common::FinalAction finish([&] {
+          if (shared->unfinished.fetch_sub(1) == 1) {
+            shared->done();
+          }
+        });
+        shared->f(i);
+      });
+    }
+  }
+
+}  // namespace kagome
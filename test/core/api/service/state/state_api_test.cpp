@@ -19,10 +19,16 @@
 #include "mock/core/runtime/core_mock.hpp"
 #include "mock/core/runtime/metadata_mock.hpp"
 #include "mock/core/runtime/runtime_context_factory_mock.hpp"
+#include "mock/core/storage/trie/serialization/trie_serializer_mock.hpp"
 #include "mock/core/storage/trie/trie_batches_mock.hpp"
 #include "mock/core/storage/trie/trie_storage_mock.hpp"
 #include "primitives/block_header.hpp"
 #include "runtime/executor.hpp"
+#include "storage/in_memory/in_memory_spaced_storage.hpp"
+#include "storage/trie/impl/trie_storage_backend_impl.hpp"
+#include "storage/trie/polkadot_trie/polkadot_trie_factory_impl.hpp"
+#include "storage/trie/serialization/polkadot_codec.hpp"
+#include "storage/trie/serialization/trie_serializer_impl.hpp"
 #include "testutil/lazy.hpp"
 #include "testutil/literals.hpp"
 
@@ -38,6 +44,7 @@ using kagome::runtime::CoreMock;
 using kagome::runtime::Executor;
 using kagome::runtime::MetadataMock;
 using kagome::storage::trie::TrieBatchMock;
+using kagome::storage::trie::TrieSerializerMock;
 using kagome::storage::trie::TrieStorageMock;
 using testing::_;
 using testing::ElementsAre;
@@ -60,8 +67,16 @@ namespace kagome::api {
     void SetUp() override {
       executor_ = std::make_shared<Executor>(
           std::make_shared<kagome::runtime::RuntimeContextFactoryMock>());
+      trie_factory_ =
+          std::make_shared<storage::trie::PolkadotTrieFactoryImpl>();
+      trie_serializer_ = std::make_shared<storage::trie::TrieSerializerImpl>(
+          trie_factory_,
+          std::make_shared<storage::trie::PolkadotCodec>(),
+          std::make_shared<storage::trie::TrieStorageBackendImpl>(
+              std::make_shared<storage::InMemorySpacedStorage>()));
       api_ = std::make_unique<api::StateApiImpl>(
           storage_,
+          trie_serializer_,
           block_tree_,
           runtime_core_,
           metadata_,
@@ -70,6 +85,22 @@ namespace kagome::api {
     }
 
    protected:
+    /**
+     * Stores a state with the given entries and returns its root
+     */
+    storage::trie::RootHash storeState(
+        const std::vector<std::pair<Buffer, Buffer>> &entries) {
+      auto trie = trie_factory_->createEmpty();
+      for (auto &[key, value] : entries) {
+        EXPECT_TRUE(trie->put(key, Buffer{value}).has_value());
+      }
+      auto [root, batch] =
+          trie_serializer_->storeTrie(*trie, storage::trie::StateVersion::V0)
+              .value();
+      EXPECT_TRUE(batch->commit().has_value());
+      return root;
+    }
+
     std::shared_ptr<TrieStorageMock> storage_ =
         std::make_shared<TrieStorageMock>();
     std::shared_ptr<BlockTreeMock> block_tree_ =
@@ -79,6 +110,8 @@ namespace kagome::api {
     std::shared_ptr<ApiServiceMock> api_service_ =
         std::make_shared<ApiServiceMock>();
     std::shared_ptr<Executor> executor_;
+    std::shared_ptr<storage::trie::PolkadotTrieFactory> trie_factory_;
+    std::shared_ptr<storage::trie::TrieSerializer> trie_serializer_;
 
     std::unique_ptr<api::StateApiImpl> api_{};
   };
@@ -128,6 +161,7 @@ namespace kagome::api {
 
       api_ = std::make_shared<api::StateApiImpl>(
           storage,
+          std::make_shared<TrieSerializerMock>(),
           block_tree_,
           runtime_core,
           metadata,
@@ -366,9 +400,11 @@ namespace kagome::api {
   }
 
   /**
-   * @given that every queried key changed in every queired block
+   * @given states of a block range where the queried keys change at
+   * different blocks
    * @when querying these changes through queryStorage
-   * @then all changes are reported for every block
+   * @then every key is reported for the first block and then only for the
+   * blocks where its value changed
    */
   TEST_F(StateApiTest, QueryStorageSucceeds) {
     // GIVEN
@@ -382,37 +418,41 @@ namespace kagome::api {
     EXPECT_CALL(*block_tree_, getNumberByHash(from))
         .WillOnce(testing::Return(1));
     EXPECT_CALL(*block_tree_, getNumberByHash(to)).WillOnce(testing::Return(4));
-    for (auto &block_hash : block_range) {
-      primitives::BlockHash state_root;
-      auto s = block_hash.toString() + "_etats";
-      std::copy_if(s.begin(), s.end(), state_root.begin(), [](auto b) {
-        return b != 0;
-      });
-      EXPECT_CALL(*block_tree_, getBlockHeader(block_hash))
+    // key1 changes in every block, key2 only in the third one and key3 is
+    // removed in the last one
+    std::vector<std::vector<std::pair<Buffer, Buffer>>> states{
+        {{"key1"_buf, "1"_buf}, {"key2"_buf, "a"_buf}, {"key3"_buf, "x"_buf}},
+        {{"key1"_buf, "2"_buf}, {"key2"_buf, "a"_buf}, {"key3"_buf, "x"_buf}},
+        {{"key1"_buf, "3"_buf}, {"key2"_buf, "b"_buf}, {"key3"_buf, "x"_buf}},
+        {{"key1"_buf, "4"_buf}, {"key2"_buf, "b"_buf}},
+    };
+    for (size_t i = 0; i < block_range.size(); ++i) {
+      auto state_root = storeState(states[i]);
+      EXPECT_CALL(*block_tree_, getBlockHeader(block_range[i]))
           .WillOnce(testing::Return(makeBlockHeaderOfStateRoot(state_root)));
-      EXPECT_CALL(*storage_, getEphemeralBatchAt(state_root))
-          .WillOnce(testing::Invoke([&keys](auto &root) {
-            auto batch = std::make_unique<storage::trie::TrieBatchMock>();
-            for (auto &key : keys) {
-              EXPECT_CALL(*batch, tryGetMock(key.view()))
-                  .WillOnce(testing::Return(common::Buffer(root)));
-            }
-            return batch;
-          }));
     }
+
     // WHEN
     ASSERT_OUTCOME_SUCCESS(changes, api_->queryStorage(keys, from, to));
 
     // THEN
-    auto current_block = block_range.begin();
-    for (auto &block_changes : changes) {
-      ASSERT_EQ(*current_block, block_changes.block);
-      ASSERT_THAT(block_changes.changes,
-                  ::testing::Each(::testing::Field(
-                      &StateApiImpl::StorageChangeSet::Change::key,
-                      ContainedIn(keys))));
-      current_block++;
+    using Change = StateApiImpl::StorageChangeSet::Change;
+    ASSERT_EQ(changes.size(), block_range.size());
+    for (size_t i = 0; i < block_range.size(); ++i) {
+      ASSERT_EQ(changes[i].block, block_range[i]);
     }
+    EXPECT_EQ(changes[0].changes,
+              (std::vector<Change>{{"key1"_buf, "1"_buf},
+                                   {"key2"_buf, "a"_buf},
+                                   {"key3"_buf, "x"_buf}}));
+    EXPECT_EQ(changes[1].changes,
+              (std::vector<Change>{{"key1"_buf, "2"_buf}}));
+    EXPECT_EQ(
+        changes[2].changes,
+        (std::vector<Change>{{"key1"_buf, "3"_buf}, {"key2"_buf, "b"_buf}}));
+    EXPECT_EQ(changes[3].changes,
+              (std::vector<Change>{{"key1"_buf, "4"_buf},
+                                   {"key3"_buf, std::nullopt}}));
   }
 
   /**
@@ -456,18 +496,11 @@ namespace kagome::api {
     EXPECT_CALL(*block_tree_, getChainByBlocks(at, at))
         .WillOnce(testing::Return(block_range));
 
-    primitives::BlockHash state_root = "at_state"_hash256;
+    auto state_root = storeState({{"key1"_buf, "1"_buf},
+                                  {"key2"_buf, "2"_buf},
+                                  {"key3"_buf, "3"_buf}});
     EXPECT_CALL(*block_tree_, getBlockHeader(at))
         .WillOnce(testing::Return(makeBlockHeaderOfStateRoot(state_root)));
-    EXPECT_CALL(*storage_, getEphemeralBatchAt(state_root))
-        .WillOnce(testing::Invoke([&keys](auto &root) {
-          auto batch = std::make_unique<storage::trie::TrieBatchMock>();
-          for (auto &key : keys) {
-            EXPECT_CALL(*batch, tryGetMock(key.view()))
-                .WillOnce(testing::Return(common::Buffer(root)));
-          }
-          return batch;
-        }));
 
     // WHEN
     ASSERT_OUTCOME_SUCCESS(changes, api_->queryStorageAt(keys, at));
@@ -22,6 +22,7 @@
 using kagome::api::JRpcServer;
 using kagome::api::JRpcServerMock;
 using kagome::api::makeValue;
+using kagome::api::RawJson;
 using kagome::api::StateApi;
 using kagome::api::StateApiMock;
 using kagome::api::state::StateJrpcProcessor;
@@ -222,8 +223,14 @@ TEST_F(StateJrpcProcessorTest, ProcessQueryStorage) {
     return std::equal(x.begin(), x.end(), keys.begin());
   });
   EXPECT_CALL(*state_api,
-              queryStorage(if_keys, from, std::optional<BlockHash>{}))
-      .WillOnce(Return(outcome::success(res)));
+              queryStorageLazy(if_keys, from, std::optional<BlockHash>{}, _))
+      .WillOnce(Invoke([&](auto &&, auto &&, auto &&, auto &on_change_set)
+                           -> outcome::result<void> {
+        for (auto change : res) {
+          OUTCOME_TRY(on_change_set(std::move(change)));
+        }
+        return outcome::success();
+      }));
 
   registerHandlers();
 
@@ -234,25 +241,16 @@ TEST_F(StateJrpcProcessorTest, ProcessQueryStorage) {
   jsonrpc::Request::Parameters params{keys_json, "0x" + from.toHex()};
   // WHEN
   auto result = execute(CallType::kCallType_QueryStorage, params);
-  auto expected_json = makeValue(res).AsArray();
   // THEN
-  ASSERT_EQ(expected_json.size(), result.AsArray().size());
-  for (auto expected = expected_json.cbegin(),
-            received = result.AsArray().begin();
-       expected != expected_json.end();
-       expected++, received++) {
-    ASSERT_EQ(expected->AsStruct().at("block").AsString(),
-              received->AsStruct().at("block").AsString());
-    auto json_tuple_to_pair = [](auto &value) {
-      auto &tuple = value.AsArray();
-      return std::pair(tuple[0].AsString(), tuple[1].AsString());
-    };
-    auto e = expected->AsStruct().at("changes").AsArray()
-           | boost::adaptors::transformed(json_tuple_to_pair);
-    auto r = received->AsStruct().at("changes").AsArray()
-           | boost::adaptors::transformed(json_tuple_to_pair);
-    ASSERT_EQ(e, r);
-  }
+  // result is formatted to json text, and is inserted into response
+  ASSERT_TRUE(result.IsString());
+  // placeholder starts with control character, which is escaped in response
+  auto json = RawJson::splice(R"("\u0001)" + result.AsString().substr(1)
+                              + R"(")");
+  ASSERT_TRUE(json);
+  EXPECT_EQ(*json,
+            R"([{"block":")" + kagome::common::hex_lower_0x(from)
+                + R"(","changes":[["0x6b657931","0x3432"]]}])");
 }
 
 TEST_F(StateJrpcProcessorTest, ProcessQueryStorageAt) {
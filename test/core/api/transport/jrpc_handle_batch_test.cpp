@@ -8,12 +8,18 @@
 #include <jsonrpc-lean/server.h>
 
 #include "api/jrpc/jrpc_handle_batch.hpp"
+#include "api/jrpc/raw_json.hpp"
 
 using kagome::api::JrpcHandleBatch;
+using kagome::api::RawJson;
 
 #define REQUEST(id) \
   R"({"jsonrpc":"2.0","method":"foo","id":)" #id R"(,"params":[]})"
 #define RESPONSE(id) R"({"jsonrpc":"2.0","id":)" #id R"(,"result":0})"
+#define RAW_REQUEST(id) \
+  R"({"jsonrpc":"2.0","method":"raw","id":)" #id R"(,"params":[]})"
+#define RAW_RESPONSE(id) \
+  R"({"jsonrpc":"2.0","id":)" #id R"(,"result":{"a":[1,null]}})"
 
 struct JrpcHanldeBatchTest : ::testing::Test {
   jsonrpc::Server jsonrpc_handler_;
@@ -22,6 +28,19 @@ struct JrpcHanldeBatchTest : ::testing::Test {
     jsonrpc_handler_.RegisterFormatHandler(format_handler_);
     auto &dispatcher = jsonrpc_handler_.GetDispatcher();
     dispatcher.AddMethod("foo", [] { return 0; });
+    dispatcher.AddMethod(
+        "raw", [] { return RawJson::make(R"({"a":[1,null]})"); });
+    // returns raw json together with string from client
+    dispatcher.AddMethod(
+        "echo",
+        jsonrpc::MethodWrapper::Method{
+            [](const jsonrpc::Request::Parameters &params) {
+              jsonrpc::Value::Array result{
+                  RawJson::make("[]"),
+                  params.at(0),
+              };
+              return jsonrpc::Value{std::move(result)};
+            }});
   }
 };
 
@@ -44,3 +63,36 @@ TEST_F(JrpcHanldeBatchTest, Batch) {
   JrpcHandleBatch batch(jsonrpc_handler_, "[" REQUEST(1) "," REQUEST(2) "]");
   EXPECT_EQ(batch.response(), "[" RESPONSE(1) "," RESPONSE(2) "]");
 }
+
+/**
+ * @given requests to method returning raw json
+ * @when handle single and batch requests
+ * @then raw json is inserted into responses as is
+ */
+TEST_F(JrpcHanldeBatchTest, RawJson) {
+  JrpcHandleBatch single(jsonrpc_handler_, RAW_REQUEST(0));
+  EXPECT_EQ(single.response(), RAW_RESPONSE(0));
+  JrpcHandleBatch batch(
+      jsonrpc_handler_,
+      "[" RAW_REQUEST(1) "," REQUEST(2) "," RAW_REQUEST(3) "]");
+  EXPECT_EQ(batch.response(),
+            "[" RAW_RESPONSE(1) "," RESPONSE(2) "," RAW_RESPONSE(3) "]");
+}
+
+/**
+ * @given request with string which looks like raw json placeholder
+ * @when method returns that string together with raw json
+ * @then only the placeholder returned by method is replaced
+ */
+TEST_F(JrpcHanldeBatchTest, RawJsonInjection) {
+  for (std::string injected : {R"(\u0001raw_json:0)",
+                               R"(\u0001raw_json:)",
+                               R"(\u0001raw_json:0:0)"}) {
+    auto request = R"({"jsonrpc":"2.0","method":"echo","id":0,"params":[")"
+                 + injected + R"("]})";
+    JrpcHandleBatch single(jsonrpc_handler_, request);
+    EXPECT_EQ(single.response(),
+              R"({"jsonrpc":"2.0","id":0,"result":[[],")" + injected
+                  + R"("]})");
+  }
+}
@@ -0,0 +1,146 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "api/transport/impl/ws/ws_write_queue.hpp"
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+using kagome::api::Notification;
+using kagome::api::WsWriteQueue;
+using Policy = WsWriteQueue::Policy;
+
+namespace {
+  /// Notification of \arg subscription_id, written as \arg size bytes
+  WsWriteQueue::Message notification(uint32_t subscription_id, size_t size) {
+    auto id = std::to_string(subscription_id);
+    return {
+        .text = id,
+        .notification = std::make_shared<Notification>(
+            Notification{.json = std::string(size - id.size(), 'n')}),
+        .subscription_id = subscription_id,
+    };
+  }
+
+  WsWriteQueue::Message response(size_t size) {
+    return {.text = std::string(size, 'r'), .notification = nullptr};
+  }
+
+  /// Writes all queued messages
+  std::vector<WsWriteQueue::Message> writeAll(WsWriteQueue &queue) {
+    std::vector<WsWriteQueue::Message> written;
+    while (auto message = queue.startWrite()) {
+      written.emplace_back(*message);
+      queue.finishWrite();
+    }
+    return written;
+  }
+
+  std::vector<uint32_t> subscriptions(
+      const std::vector<WsWriteQueue::Message> &messages) {
+    std::vector<uint32_t> ids;
+    for (auto &message : messages) {
+      ids.emplace_back(message.notification ? message.subscription_id : 0);
+    }
+    return ids;
+  }
+}  // namespace
+
+/**
+ * @given queue with small limit and any policy
+ * @when single response or notification bigger than limit is queued, while
+ * other message is being written
+ * @then it is admitted
+ */
+TEST(WsWriteQueueTest, AdmitsBigMessage) {
+  for (auto policy :
+       {Policy::kDropOldest, Policy::kCoalesce, Policy::kDisconnect}) {
+    WsWriteQueue queue{100, policy};
+    EXPECT_TRUE(queue.push(notification(1, 1000)));
+    ASSERT_NE(queue.startWrite(), nullptr);
+    EXPECT_TRUE(queue.push(response(1000)));
+    EXPECT_TRUE(queue.push(response(1000)));
+    EXPECT_TRUE(queue.push(notification(2, 1000)));
+    EXPECT_EQ(queue.size(), 4000);
+    queue.finishWrite();
+    EXPECT_EQ(writeAll(queue).size(), 3);
+    EXPECT_EQ(queue.size(), 0);
+    EXPECT_EQ(queue.dropped(), 0);
+  }
+}
+
+/**
+ * @given queue with "drop-oldest" policy, and message being written
+ * @when notifications behind it exceed limit
+ * @then oldest notifications are dropped, while responses and the message
+ * being written are kept
+ */
+TEST(WsWriteQueueTest, DropOldest) {
+  WsWriteQueue queue{250, Policy::kDropOldest};
+  EXPECT_TRUE(queue.push(notification(1, 100)));
+  ASSERT_NE(queue.startWrite(), nullptr);
+  EXPECT_TRUE(queue.push(notification(2, 100)));
+  EXPECT_TRUE(queue.push(response(1000)));
+  EXPECT_TRUE(queue.push(notification(3, 100)));
+  EXPECT_TRUE(queue.push(notification(4, 100)));
+  EXPECT_EQ(queue.dropped(), 1);
+  EXPECT_TRUE(queue.push(notification(5, 100)));
+  EXPECT_EQ(queue.dropped(), 2);
+  EXPECT_EQ(queue.size(), 1300);
+  queue.finishWrite();
+  EXPECT_EQ(subscriptions(writeAll(queue)),
+            (std::vector<uint32_t>{0, 4, 5}));
+}
+
+/**
+ * @given queue with "coalesce" policy
+ * @when notifications exceed limit, and the newest one is of other
+ * subscription than the stale ones
+ * @then only the latest notification of every subscription is kept
+ */
+TEST(WsWriteQueueTest, Coalesce) {
+  WsWriteQueue queue{250, Policy::kCoalesce};
+  EXPECT_TRUE(queue.push(notification(1, 100)));
+  ASSERT_NE(queue.startWrite(), nullptr);
+  EXPECT_TRUE(queue.push(notification(1, 100)));
+  EXPECT_TRUE(queue.push(notification(1, 100)));
+  EXPECT_TRUE(queue.push(response(100)));
+  EXPECT_TRUE(queue.push(notification(2, 100)));
+  EXPECT_EQ(queue.dropped(), 1);
+  EXPECT_EQ(queue.size(), 400);
+  queue.finishWrite();
+  EXPECT_EQ(subscriptions(writeAll(queue)),
+            (std::vector<uint32_t>{1, 0, 2}));
+}
+
+/**
+ * @given queue with "coalesce" policy
+ * @when latest notifications of distinct subscriptions exceed limit
+ * @then queue reports that session should be evicted
+ */
+TEST(WsWriteQueueTest, CoalesceOverflow) {
+  WsWriteQueue queue{250, Policy::kCoalesce};
+  EXPECT_TRUE(queue.push(notification(1, 100)));
+  EXPECT_TRUE(queue.push(notification(2, 100)));
+  EXPECT_FALSE(queue.push(notification(3, 100)));
+  EXPECT_EQ(queue.dropped(), 0);
+}
+
+/**
+ * @given queue with "disconnect" policy
+ * @when notifications exceed limit
+ * @then nothing is dropped, and queue reports that session should be evicted
+ */
+TEST(WsWriteQueueTest, Disconnect) {
+  WsWriteQueue queue{250, Policy::kDisconnect};
+  EXPECT_TRUE(queue.push(notification(1, 100)));
+  EXPECT_TRUE(queue.push(response(1000)));
+  EXPECT_TRUE(queue.push(notification(1, 100)));
+  EXPECT_FALSE(queue.push(notification(1, 100)));
+  EXPECT_EQ(queue.dropped(), 0);
+  EXPECT_EQ(queue.size(), 1300);
+}
@@ -258,3 +258,63 @@ TEST_F(BlockStorageTest, Remove) {
 
   ASSERT_OUTCOME_SUCCESS(block_storage->removeBlock(genesis_block_hash));
 }
+
+/**
+ * @given a block storage with a block put into it
+ * @when getting header and hash of the block
+ * @then they are served from cache without reading the underlying storage
+ * @and cache is invalidated when the block is removed
+ */
+TEST_F(BlockStorageTest, HeaderCache) {
+  auto block_storage = createWithGenesis();
+
+  Block block;
+  block.header.number = 1;
+  block.header.parent_hash = genesis_block_hash;
+  auto encoded_header = Buffer(encode(block.header).value());
+  ON_CALL(*hasher, blake2b_256(encoded_header.view()))
+      .WillByDefault(Return(regular_block_hash));
+
+  ASSERT_OUTCOME_SUCCESS(block_storage->putBlock(block));
+  ASSERT_OUTCOME_SUCCESS(block_storage->assignNumberToHash(
+      {block.header.number, regular_block_hash}));
+
+  BufferView hash(regular_block_hash);
+  EXPECT_CALL(*(spaces[Space::kHeader]), tryGetMock(hash)).Times(0);
+  EXPECT_CALL(*(spaces[Space::kLookupKey]), tryGetMock(_)).Times(0);
+
+  ASSERT_OUTCOME_SUCCESS(header,
+                         block_storage->getBlockHeader(regular_block_hash));
+  EXPECT_EQ(header, block.header);
+  ASSERT_OUTCOME_SUCCESS(has,
+                         block_storage->hasBlockHeader(regular_block_hash));
+  EXPECT_TRUE(has);
+  ASSERT_OUTCOME_SUCCESS(block_hash,
+                         block_storage->getBlockHash(block.header.number));
+  EXPECT_EQ(block_hash, regular_block_hash);
+  testing::Mock::VerifyAndClearExpectations(spaces[Space::kHeader].get());
+  testing::Mock::VerifyAndClearExpectations(spaces[Space::kLookupKey].get());
+
+  EXPECT_CALL(*(spaces[Space::kHeader]), tryGetMock(hash))
+      .WillOnce(Return(encoded_header))
+      .WillOnce(Return(std::nullopt));
+  EXPECT_CALL(*(spaces[Space::kLookupKey]), tryGetMock(_))
+      .WillOnce(Return(Buffer{regular_block_hash}))
+      .WillOnce(Return(std::nullopt));
+  EXPECT_CALL(*(spaces[Space::kBlockBody]), remove(hash))
+      .WillOnce(Return(outcome::success()));
+  EXPECT_CALL(*(spaces[Space::kHeader]), remove(hash))
+      .WillOnce(Return(outcome::success()));
+  EXPECT_CALL(*(spaces[Space::kJustification]), remove(hash))
+      .WillOnce(Return(outcome::success()));
+  EXPECT_CALL(*(spaces[Space::kLookupKey]), remove(_))
+      .WillOnce(Return(outcome::success()));
+  ASSERT_OUTCOME_SUCCESS(block_storage->removeBlock(regular_block_hash));
+
+  ASSERT_OUTCOME_SUCCESS(removed,
+                         block_storage->tryGetBlockHeader(regular_block_hash));
+  EXPECT_FALSE(removed.has_value());
+  ASSERT_OUTCOME_SUCCESS(removed_hash,
+                         block_storage->getBlockHash(block.header.number));
+  EXPECT_FALSE(removed_hash.has_value());
+}
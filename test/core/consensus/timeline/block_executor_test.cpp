@@ -20,6 +20,7 @@
 #include "consensus/babe/types/babe_block_header.hpp"
 #include "consensus/babe/types/seal.hpp"
 #include "consensus/timeline/impl/block_appender_base.hpp"
+#include "consensus/timeline/impl/block_prefetcher.hpp"
 #include "mock/core/application/app_state_manager_mock.hpp"
 #include "mock/core/blockchain/block_tree_mock.hpp"
 #include "mock/core/consensus/babe/babe_config_repository_mock.hpp"
@@ -47,6 +48,7 @@ using kagome::common::MainThreadPool;
 using kagome::common::WorkerThreadPool;
 using kagome::consensus::BlockAppenderBase;
 using kagome::consensus::BlockExecutorImpl;
+using kagome::consensus::BlockPrefetcher;
 using kagome::consensus::ConsensusSelector;
 using kagome::consensus::ConsensusSelectorMock;
 using kagome::consensus::EpochNumber;
@@ -201,6 +203,7 @@ class BlockExecutorTest : public testing::Test {
                                                offchain_worker_api_,
                                                storage_sub_engine_,
                                                chain_sub_engine_,
+                                               prefetcher_,
                                                std::move(appender));
 
     app_state_manager.start();
@@ -218,6 +221,8 @@ class BlockExecutorTest : public testing::Test {
   std::shared_ptr<WorkerThreadPool> worker_thread_pool_;
 
   std::shared_ptr<CoreMock> core_;
+  std::shared_ptr<BlockPrefetcher> prefetcher_ =
+      std::make_shared<BlockPrefetcher>(nullptr, 0, nullptr, nullptr);
   std::shared_ptr<BabeConfiguration> babe_config_;
   std::shared_ptr<BabeConfigRepositoryMock> babe_config_repo_;
   EpochTimings timings_{
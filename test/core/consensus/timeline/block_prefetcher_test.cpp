@@ -0,0 +1,196 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "consensus/timeline/impl/block_prefetcher.hpp"
+
+#include <gtest/gtest.h>
+
+#include <qtils/test/outcome.hpp>
+
+#include "common/worker_thread_pool.hpp"
+#include "crypto/hasher/hasher_impl.hpp"
+#include "storage/in_memory/in_memory_spaced_storage.hpp"
+#include "storage/trie/impl/trie_storage_backend_impl.hpp"
+#include "storage/trie/polkadot_trie/polkadot_trie_factory_impl.hpp"
+#include "storage/trie/serialization/polkadot_codec.hpp"
+#include "storage/trie/serialization/trie_node_cache.hpp"
+#include "storage/trie/serialization/trie_serializer_impl.hpp"
+#include "testutil/prepare_loggers.hpp"
+
+using kagome::TestThreadPool;
+using kagome::common::Buffer;
+using kagome::common::WorkerThreadPool;
+using kagome::consensus::BlockPrefetcher;
+using kagome::crypto::HasherImpl;
+using kagome::primitives::Block;
+using kagome::primitives::Extrinsic;
+using namespace kagome::storage;
+using namespace kagome::storage::trie;
+
+class BlockPrefetcherTest : public testing::Test {
+ public:
+  static void SetUpTestCase() {
+    testutil::prepareLoggers();
+  }
+
+  void SetUp() override {
+    backend_ = std::make_shared<TrieStorageBackendImpl>(
+        std::make_shared<InMemorySpacedStorage>());
+    serializer_ = std::make_shared<TrieSerializerImpl>(
+        factory_, codec_, backend_, cache_);
+    prefetcher_ =
+        std::make_shared<BlockPrefetcher>(pool_, 2, serializer_, hasher_);
+  }
+
+  /// Signed extrinsic of `signer`
+  static Extrinsic signedExtrinsic(uint8_t signer) {
+    Buffer data{0x84, 0x00};
+    data.put(Buffer(32, signer));
+    data.put(Buffer(64, 0xff));
+    return {data};
+  }
+
+  /// Stores state with `keys`, without filling the cache.
+  /// Values are large enough for leaves not to be inlined
+  RootHash storeState(const std::vector<Buffer> &keys) {
+    auto trie = factory_->createEmpty();
+    for (auto &key : keys) {
+      EXPECT_OUTCOME_SUCCESS(trie->put(key, Buffer(40, 1)));
+    }
+    for (uint8_t i = 0; i < 255; ++i) {
+      EXPECT_OUTCOME_SUCCESS(trie->put(Buffer{i, 1, 2, 3}, Buffer(40, i)));
+    }
+    TrieSerializerImpl serializer{factory_, codec_, backend_};
+    auto [root, batch] = serializer.storeTrie(*trie, StateVersion::V0).value();
+    EXPECT_OUTCOME_SUCCESS(batch->commit());
+    return root;
+  }
+
+  /// Key of the signer of `block`, the only key predicted besides static
+  Buffer signerKey(const Block &block) {
+    auto static_keys = prefetcher_->predict(Block{});
+    for (auto &key : prefetcher_->predict(block)) {
+      if (not static_keys.contains(key)) {
+        return key;
+      }
+    }
+    return {};
+  }
+
+  /// Reads key through serializer, which has the cache but no database
+  bool cached(const RootHash &root, const Buffer &key) {
+    TrieSerializerImpl serializer{
+        factory_,
+        codec_,
+        std::make_shared<TrieStorageBackendImpl>(
+            std::make_shared<InMemorySpacedStorage>()),
+        cache_};
+    auto trie = serializer.retrieveTrie(root, nullptr);
+    return trie and trie.value()->get(key).has_value();
+  }
+
+  std::shared_ptr<PolkadotTrieFactory> factory_ =
+      std::make_shared<PolkadotTrieFactoryImpl>();
+  std::shared_ptr<Codec> codec_ = std::make_shared<PolkadotCodec>();
+  std::shared_ptr<TrieNodeCache> cache_ =
+      std::make_shared<TrieNodeCache>(16 << 20);
+  std::shared_ptr<TrieStorageBackend> backend_;
+  std::shared_ptr<TrieSerializer> serializer_;
+  std::shared_ptr<HasherImpl> hasher_ = std::make_shared<HasherImpl>();
+  // not run by threads, tests run loading themselves
+  std::shared_ptr<boost::asio::io_context> io_ =
+      std::make_shared<boost::asio::io_context>();
+  std::shared_ptr<WorkerThreadPool> pool_ =
+      std::make_shared<WorkerThreadPool>(TestThreadPool{io_});
+  std::shared_ptr<BlockPrefetcher> prefetcher_;
+};
+
+/**
+ * @given block with signed and unsigned extrinsics
+ * @when keys are predicted
+ * @then accounts of signers are predicted
+ */
+TEST_F(BlockPrefetcherTest, PredictsSigners) {
+  Block block;
+  block.body.emplace_back(signedExtrinsic(1));
+  block.body.emplace_back(Extrinsic{Buffer{0x04, 0x00, 1, 2, 3}});
+  auto static_keys = prefetcher_->predict(Block{});
+  auto keys = prefetcher_->predict(block);
+  ASSERT_EQ(keys.size(), static_keys.size() + 1);
+
+  Buffer account_key;
+  account_key.put(hasher_->twox_128(Buffer::fromString("System")));
+  account_key.put(hasher_->twox_128(Buffer::fromString("Account")));
+  account_key.put(hasher_->blake2b_128(Buffer(32, 1)));
+  account_key.put(Buffer(32, 1));
+  EXPECT_TRUE(keys.contains(account_key));
+}
+
+/**
+ * @given state and keys read by previous block
+ * @when block is prefetched
+ * @then prefetch returns before paths are loaded
+ * @and paths to predicted keys and keys read by previous block are cached
+ * once the pool runs, paths to other keys are not
+ */
+TEST_F(BlockPrefetcherTest, LoadsPredictedPaths) {
+  Block block;
+  block.body.emplace_back(signedExtrinsic(7));
+  auto signer_key = signerKey(block);
+  Buffer read_key{0x42, 1, 2, 3};
+  auto root = storeState({signer_key});
+  EXPECT_FALSE(cached(root, signer_key));
+
+  prefetcher_->onExecuted({}, {read_key});
+  auto prefetched = prefetcher_->prefetch(block, root);
+  EXPECT_TRUE(prefetched.contains(signer_key));
+  EXPECT_TRUE(prefetched.contains(read_key));
+  EXPECT_FALSE(cached(root, signer_key));
+
+  io_->run();
+  EXPECT_TRUE(cached(root, signer_key));
+  EXPECT_TRUE(cached(root, read_key));
+  EXPECT_FALSE(cached(root, Buffer{0x43, 1, 2, 3}));
+}
+
+/**
+ * @given disabled prefetcher
+ * @when block is prefetched
+ * @then nothing is loaded
+ */
+TEST_F(BlockPrefetcherTest, Disabled) {
+  auto prefetcher =
+      std::make_shared<BlockPrefetcher>(pool_, 0, nullptr, nullptr);
+  EXPECT_FALSE(prefetcher->enabled());
+  Block block;
+  block.body.emplace_back(signedExtrinsic(7));
+  EXPECT_TRUE(prefetcher->prefetch(block, RootHash{}).empty());
+  EXPECT_EQ(io_->poll(), 0u);
+}
+
+/**
+ * @given block prefetch, which is not loaded yet
+ * @when block is executed, or its execution fails
+ * @then loading is abandoned
+ */
+TEST_F(BlockPrefetcherTest, AbandonedAfterExecution) {
+  for (auto failed : {false, true}) {
+    Block block;
+    block.body.emplace_back(signedExtrinsic(failed ? 8 : 7));
+    auto signer_key = signerKey(block);
+    auto root = storeState({signer_key});
+
+    auto prefetched = prefetcher_->prefetch(block, root);
+    if (failed) {
+      prefetcher_->abandon();
+    } else {
+      prefetcher_->onExecuted(prefetched, {});
+    }
+    io_->restart();
+    io_->run();
+    EXPECT_FALSE(cached(root, signer_key));
+  }
+}
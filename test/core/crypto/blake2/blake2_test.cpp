@@ -66,6 +66,40 @@ TEST(Blake2b, Correctness) {
   EXPECT_EQ(memcmp(md, blake2b_res.data(), 32), 0) << "hashes are different";
 }
 
+/**
+ * @given inputs of different lengths, many of them with the same number of
+ * blocks
+ * @when they are hashed as a batch
+ * @then every hash is the same as hash of input alone
+ */
+TEST(Blake2b, Batch) {
+  std::vector<std::vector<uint8_t>> inputs;
+  for (size_t len : {0, 1, 3, 127, 128, 129, 255, 256, 257, 1024}) {
+    for (size_t seed = 0; seed < 9; ++seed) {
+      auto &input = inputs.emplace_back(len);
+      selftest_seq(input.data(), len, len + seed);
+    }
+  }
+  std::vector<kagome::common::BufferView> views(inputs.begin(), inputs.end());
+
+  for (size_t outlen : {20, 32, 64}) {
+    std::vector<uint8_t> expected(outlen * inputs.size());
+    for (size_t i = 0; i < inputs.size(); ++i) {
+      kagome::crypto::blake2b(expected.data() + i * outlen,
+                              outlen,
+                              nullptr,
+                              0,
+                              inputs[i].data(),
+                              inputs[i].size());
+    }
+    std::vector<uint8_t> batch(outlen * inputs.size());
+    ASSERT_EQ(kagome::crypto::blake2b_batch(
+                  batch.data(), outlen, views.data(), views.size()),
+              0);
+    EXPECT_EQ(batch, expected) << "outlen " << outlen;
+  }
+}
+
 TEST(Blake2s, Correctness) {
   // Grand hash of hash results.
   auto blake2s_res =
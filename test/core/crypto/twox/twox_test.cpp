@@ -6,8 +6,10 @@
 
 #include "crypto/twox/twox.hpp"
 
+#include <boost/endian/conversion.hpp>
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
+#include <xxhash.h>
 #include "testutil/literals.hpp"
 
 using kagome::common::Buffer;
@@ -56,3 +58,51 @@ TEST(Twox256, Correctness) {
     ASSERT_THAT(hash, ::testing::ElementsAreArray(reference));
   }
 }
+
+/**
+ * @given inputs of every length around stripe and word boundaries
+ * @when calling make_twox128 and make_twox256, which hash all seeds at once
+ * @then every 64-bit part matches xxhash64 with its own seed
+ */
+TEST(Twox, MatchesXxhashPerSeed) {
+  for (size_t size = 0; size < 100; ++size) {
+    Buffer input;
+    for (size_t i = 0; i < size; ++i) {
+      input.putUint8(i * 31 + size);
+    }
+    auto hash128 = make_twox128(input);
+    auto hash256 = make_twox256(input);
+    for (uint64_t seed = 0; seed < 4; ++seed) {
+      uint64_t reference = 0;
+      boost::endian::store_little_u64(
+          reinterpret_cast<uint8_t *>(&reference),
+          XXH64(input.data(), input.size(), seed));
+      if (seed < 2) {
+        EXPECT_EQ(memcmp(hash128.data() + seed * 8, &reference, 8), 0)
+            << "size " << size << " seed " << seed;
+      }
+      EXPECT_EQ(memcmp(hash256.data() + seed * 8, &reference, 8), 0)
+          << "size " << size << " seed " << seed;
+    }
+  }
+}
+
+/**
+ * @given cache of twox_128
+ * @when hashing names, which collide in cache slots, and long inputs
+ * @then cached hashes are the same as computed ones
+ */
+TEST(Twox128Cache, ReturnsSameHashes) {
+  Twox128Cache cache;
+  std::vector<Buffer> inputs{
+      Buffer{}, Buffer::fromString("System"), Buffer::fromString("Account")};
+  for (size_t i = 0; i < 3 * Twox128Cache::kEntries; ++i) {
+    inputs.emplace_back(Buffer::fromString("Pallet" + std::to_string(i)));
+  }
+  inputs.emplace_back(Twox128Cache::kMaxSize + 1, 0x42);
+  for (auto round = 0; round < 2; ++round) {
+    for (auto &input : inputs) {
+      EXPECT_EQ(cache.get(input), make_twox128(input));
+    }
+  }
+}
@@ -0,0 +1,89 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "host_api/impl/crypto_batch_verifier.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <mutex>
+#include <thread>
+
+#include "testutil/prepare_loggers.hpp"
+#include "utils/thread_pool.hpp"
+
+using kagome::TestThreadPool;
+using kagome::ThreadPool;
+using kagome::host_api::CryptoBatchVerifier;
+
+class CryptoBatchVerifierTest : public testing::Test {
+ public:
+  static void SetUpTestCase() {
+    testutil::prepareLoggers();
+  }
+
+  /// Pushes checks spanning several chunks, which record their thread
+  void pushChecks(CryptoBatchVerifier &verifier, bool ok = true) {
+    for (size_t i = 0; i < 3 * CryptoBatchVerifier::kChunkSize + 1; ++i) {
+      verifier.push([this, ok, i] {
+        std::lock_guard lock{mutex_};
+        threads_.emplace_back(std::this_thread::get_id());
+        return ok or i != CryptoBatchVerifier::kChunkSize;
+      });
+    }
+  }
+
+  std::shared_ptr<boost::asio::io_context> io_ =
+      std::make_shared<boost::asio::io_context>();
+  std::shared_ptr<ThreadPool> pool_ =
+      std::make_shared<ThreadPool>(TestThreadPool{io_});
+  std::mutex mutex_;
+  std::vector<std::thread::id> threads_;
+};
+
+/**
+ * @given batch of checks spanning several chunks
+ * @when pool has run dispatched chunks before finish
+ * @then only the tail is verified by the caller @and all checks are verified
+ */
+TEST_F(CryptoBatchVerifierTest, VerifiesChunksOnPool) {
+  CryptoBatchVerifier verifier{pool_};
+  pushChecks(verifier, false);
+  std::thread pool_thread{[&] { io_->run(); }};
+  pool_thread.join();
+
+  auto result = verifier.finish();
+  EXPECT_FALSE(result.ok);
+  EXPECT_EQ(result.count, 3 * CryptoBatchVerifier::kChunkSize + 1);
+  ASSERT_EQ(threads_.size(), result.count);
+  EXPECT_EQ(std::count(threads_.begin(),
+                       threads_.end(),
+                       std::this_thread::get_id()),
+            1);
+}
+
+/**
+ * @given batch of checks spanning several chunks
+ * @when pool doesn't run, as after shutdown
+ * @then finish verifies all chunks on the calling thread instead of waiting
+ */
+TEST_F(CryptoBatchVerifierTest, VerifiesInlineWhenPoolDoesNotRun) {
+  CryptoBatchVerifier verifier{pool_};
+  pushChecks(verifier);
+
+  auto result = verifier.finish();
+  EXPECT_TRUE(result.ok);
+  ASSERT_EQ(threads_.size(), result.count);
+  EXPECT_EQ(std::count(threads_.begin(),
+                       threads_.end(),
+                       std::this_thread::get_id()),
+            result.count);
+  EXPECT_LE(result.saved_time, CryptoBatchVerifier::Clock::duration{});
+
+  // tasks left in pool are skipped
+  io_->run();
+  EXPECT_EQ(threads_.size(), result.count);
+}
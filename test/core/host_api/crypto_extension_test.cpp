@@ -106,7 +106,8 @@ class CryptoExtensionTest : public ::testing::Test {
                                                     ed25519_provider_,
                                                     secp256k1_provider_,
                                                     hasher_,
-                                                    key_store_);
+                                                    key_store_,
+                                                    nullptr);
 
     ASSERT_OUTCOME_SUCCESS(
         seed_tmp, kagome::common::Blob<32>::fromHexWithPrefix(seed_hex));
@@ -385,6 +386,77 @@ TEST_F(CryptoExtensionTest, Sr25519VerifyFailure) {
             CryptoExtension::kVerifyFail);
 }
 
+/**
+ * @given initialized crypto extension @and started batch of ed25519 signatures
+ * spanning several verification chunks
+ * @when finishing the batch
+ * @then batched calls succeed immediately @and the batch is valid
+ */
+TEST_F(CryptoExtensionTest, Ed25519BatchVerifySuccess) {
+  SecureBuffer<> seed_buf(Ed25519Seed::size());
+  random_generator_->fillRandomly(seed_buf);
+  auto seed = Ed25519Seed::from(std::move(seed_buf)).value();
+  auto keypair = ed25519_provider_->generateKeypair(seed, {}).value();
+  ASSERT_OUTCOME_SUCCESS(signature, ed25519_provider_->sign(keypair, input));
+
+  crypto_ext_->ext_crypto_start_batch_verify_version_1();
+  for (size_t i = 0; i < 3 * CryptoBatchVerifier::kChunkSize + 1; ++i) {
+    ASSERT_EQ(
+        crypto_ext_->ext_crypto_ed25519_batch_verify_version_1(
+            memory_[signature], memory_[input], memory_[keypair.public_key]),
+        CryptoExtension::kVerifySuccess);
+  }
+  ASSERT_EQ(crypto_ext_->ext_crypto_finish_batch_verify_version_1(),
+            CryptoExtension::kVerifySuccess);
+}
+
+/**
+ * @given initialized crypto extension @and started batch with one invalid
+ * ed25519 signature
+ * @when finishing the batch
+ * @then batched call succeeds immediately @and the batch is invalid
+ */
+TEST_F(CryptoExtensionTest, Ed25519BatchVerifyFailure) {
+  SecureBuffer<> seed_buf(Ed25519Seed::size());
+  random_generator_->fillRandomly(seed_buf);
+  auto seed = Ed25519Seed::from(std::move(seed_buf)).value();
+  auto keypair = ed25519_provider_->generateKeypair(seed, {}).value();
+  ASSERT_OUTCOME_SUCCESS(signature, ed25519_provider_->sign(keypair, input));
+  Ed25519Signature invalid_signature;
+  invalid_signature.fill(0x11);
+
+  crypto_ext_->ext_crypto_start_batch_verify_version_1();
+  for (size_t i = 0; i < 2 * CryptoBatchVerifier::kChunkSize; ++i) {
+    auto &sig = i == CryptoBatchVerifier::kChunkSize / 2 ? invalid_signature
+                                                         : signature;
+    ASSERT_EQ(crypto_ext_->ext_crypto_ed25519_batch_verify_version_1(
+                  memory_[sig], memory_[input], memory_[keypair.public_key]),
+              CryptoExtension::kVerifySuccess);
+  }
+  ASSERT_EQ(crypto_ext_->ext_crypto_finish_batch_verify_version_1(),
+            CryptoExtension::kVerifyFail);
+}
+
+/**
+ * @given initialized crypto extension without started batch
+ * @when calling batch verification with an invalid signature
+ * @then the signature is verified immediately
+ */
+TEST_F(CryptoExtensionTest, Ed25519BatchVerifyWithoutBatch) {
+  SecureBuffer<> seed_buf(Ed25519Seed::size());
+  random_generator_->fillRandomly(seed_buf);
+  auto seed = Ed25519Seed::from(std::move(seed_buf)).value();
+  auto keypair = ed25519_provider_->generateKeypair(seed, {}).value();
+  Ed25519Signature invalid_signature;
+  invalid_signature.fill(0x11);
+
+  ASSERT_EQ(crypto_ext_->ext_crypto_ed25519_batch_verify_version_1(
+                memory_[invalid_signature],
+                memory_[input],
+                memory_[keypair.public_key]),
+            CryptoExtension::kVerifyFail);
+}
+
 /**
  * @given initialized crypto extensions @and secp256k1 signature and message
  * @when call recovery public secp256k1 uncompressed key
@@ -52,8 +52,12 @@ std::shared_ptr<TrieStorage> makeEmptyInMemoryTrie() {
       std::make_shared<TrieSerializerImpl>(trie_factory, codec, node_backend);
   auto state_pruner = std::make_shared<TriePrunerMock>();
   ON_CALL(*state_pruner,
-          addNewState(testing::A<const storage::trie::PolkadotTrie &>(), _))
-      .WillByDefault(Return(outcome::success()));
+          addNewState(
+              testing::A<const storage::trie::PolkadotTrie &>(), _, _))
+      .WillByDefault([](auto &, auto, auto batch) {
+        return outcome::result<std::unique_ptr<storage::BufferBatch>>{
+            std::move(batch)};
+      });
 
   return kagome::storage::trie::TrieStorageImpl::createEmpty(
              trie_factory, codec, serializer, state_pruner)
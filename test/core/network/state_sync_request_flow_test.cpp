@@ -0,0 +1,232 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "network/impl/state_sync_request_flow.hpp"
+
+#include <gtest/gtest.h>
+
+#include <qtils/test/outcome.hpp>
+
+#include "mock/core/blockchain/block_header_repository_mock.hpp"
+#include "mock/core/storage/trie_pruner/trie_pruner_mock.hpp"
+#include "network/impl/state_protocol_observer_impl.hpp"
+#include "storage/in_memory/in_memory_spaced_storage.hpp"
+#include "storage/trie/impl/trie_storage_backend_impl.hpp"
+#include "storage/trie/impl/trie_storage_impl.hpp"
+#include "storage/trie/polkadot_trie/polkadot_trie_factory_impl.hpp"
+#include "storage/trie/serialization/polkadot_codec.hpp"
+#include "storage/trie/serialization/trie_serializer_impl.hpp"
+#include "storage/trie/trie_batches.hpp"
+#include "testutil/literals.hpp"
+#include "testutil/prepare_loggers.hpp"
+
+using namespace kagome;
+
+using namespace blockchain;
+using namespace common;
+using namespace network;
+using namespace primitives;
+using namespace storage;
+
+using namespace trie;
+using namespace trie_pruner;
+
+using testing::_;
+using testing::Return;
+
+class StateSyncRequestFlowTest : public testing::Test {
+ public:
+  static void SetUpTestCase() {
+    testutil::prepareLoggers();
+  }
+
+  void SetUp() override {
+    auto trie_factory = std::make_shared<PolkadotTrieFactoryImpl>();
+    auto codec = std::make_shared<PolkadotCodec>();
+    auto serializer =
+        std::make_shared<TrieSerializerImpl>(trie_factory, codec, source_db_);
+    auto state_pruner = std::make_shared<TriePrunerMock>();
+    ON_CALL(*state_pruner,
+            addNewState(
+                testing::A<const storage::trie::PolkadotTrie &>(), _, _))
+        .WillByDefault([](auto &, auto, auto batch) {
+          return outcome::result<std::unique_ptr<storage::BufferBatch>>{
+              std::move(batch)};
+        });
+    source_ = TrieStorageImpl::createEmpty(
+                  trie_factory, codec, serializer, state_pruner)
+                  .value();
+    observer_ = std::make_shared<StateProtocolObserverImpl>(headers_, source_);
+  }
+
+  /// State larger than single response, spread over all root children
+  void makeState() {
+    auto batch =
+        source_->getPersistentBatchAt(kEmptyRootHash, std::nullopt).value();
+    for (size_t i = 0; i < 256; ++i) {
+      Buffer key{std::vector<uint8_t>{static_cast<uint8_t>(i), 1, 2, 3}};
+      Buffer value{std::vector<uint8_t>(32 << 10, static_cast<uint8_t>(i))};
+      ASSERT_OUTCOME_SUCCESS_TRY(batch->put(key, value));
+    }
+    ASSERT_OUTCOME_SUCCESS(root, batch->commit(StateVersion::V0));
+    header_.number = 1;
+    header_.state_root = root;
+    block_ = {1, "1"_hash256};
+    EXPECT_CALL(*headers_, getBlockHeader(block_.hash))
+        .WillRepeatedly(Return(header_));
+  }
+
+  /// Fetches next part of state for flow
+  void step(StateSyncRequestFlow &flow) {
+    ASSERT_OUTCOME_SUCCESS(res, observer_->onStateRequest(flow.nextRequest()));
+    ASSERT_OUTCOME_SUCCESS_TRY(flow.onResponse(res));
+  }
+
+  /// Checks that all nodes of source state were fetched
+  void checkFetched() {
+    auto cursor = source_db_->cursor();
+    ASSERT_OUTCOME_SUCCESS_TRY(cursor->seekFirst());
+    size_t count = 0;
+    while (cursor->isValid()) {
+      ASSERT_OUTCOME_SUCCESS(contains, target_db_->contains(*cursor->key()));
+      EXPECT_TRUE(contains);
+      ++count;
+      ASSERT_OUTCOME_SUCCESS_TRY(cursor->next());
+    }
+    EXPECT_GT(count, 256);
+  }
+
+  std::shared_ptr<TrieStorageBackend> source_db_ =
+      std::make_shared<TrieStorageBackendImpl>(
+          std::make_shared<InMemorySpacedStorage>());
+  std::shared_ptr<TrieStorageBackend> target_db_ =
+      std::make_shared<TrieStorageBackendImpl>(
+          std::make_shared<InMemorySpacedStorage>());
+  std::shared_ptr<BlockHeaderRepositoryMock> headers_ =
+      std::make_shared<BlockHeaderRepositoryMock>();
+  std::shared_ptr<TrieStorage> source_;
+  std::shared_ptr<StateProtocolObserver> observer_;
+  BlockHeader header_;
+  BlockInfo block_;
+};
+
+/**
+ * @given state larger than single response
+ * @when state is fetched by single flow
+ * @then all nodes are stored
+ */
+TEST_F(StateSyncRequestFlowTest, Sequential) {
+  makeState();
+  StateSyncRequestFlow flow{target_db_, block_, header_};
+  size_t requests = 0;
+  while (not flow.complete()) {
+    ASSERT_NO_FATAL_FAILURE(step(flow));
+    ++requests;
+  }
+  EXPECT_GT(requests, 1);
+  checkFetched();
+}
+
+/**
+ * @given state larger than single response
+ * @when state is split into partitions after first response
+ * @then partitions are fetched independently
+ * @and flow completes after partitions without further requests
+ */
+TEST_F(StateSyncRequestFlowTest, Partitions) {
+  makeState();
+  StateSyncRequestFlow flow{target_db_, block_, header_};
+  step(flow);
+  ASSERT_FALSE(flow.complete());
+  auto partitions = flow.partitions();
+  ASSERT_GT(partitions.size(), 1);
+  EXPECT_TRUE(flow.partitions().empty());
+
+  // interleave requests, as if partitions were fetched from different peers
+  for (auto done = false; not done;) {
+    done = true;
+    for (auto &partition : partitions) {
+      if (not partition.complete()) {
+        ASSERT_NO_FATAL_FAILURE(step(partition));
+        done = false;
+      }
+    }
+  }
+  EXPECT_FALSE(target_db_->contains(header_.state_root).value());
+  ASSERT_OUTCOME_SUCCESS_TRY(flow.resume());
+  EXPECT_TRUE(flow.complete());
+  checkFetched();
+}
+
+/**
+ * @given state partially fetched by partitions before restart
+ * @when state is split again
+ * @then fetched partitions are skipped
+ * @and partition continues from persisted start
+ */
+TEST_F(StateSyncRequestFlowTest, Resume) {
+  makeState();
+  StateSyncRequestFlow flow{target_db_, block_, header_};
+  step(flow);
+  auto partitions = flow.partitions();
+  ASSERT_GT(partitions.size(), 2);
+  auto &last = partitions.back();
+  while (not last.complete()) {
+    ASSERT_NO_FATAL_FAILURE(step(last));
+  }
+  auto &first = partitions.front();
+  auto start = first.nextRequest().start;
+  for (auto &partition : partitions) {
+    EXPECT_EQ(partition.contains(start), &partition == &first);
+  }
+
+  StateSyncRequestFlow flow2{target_db_, block_, header_};
+  step(flow2);
+  auto partitions2 = flow2.partitions();
+  ASSERT_EQ(partitions2.size(), partitions.size() - 1);
+  EXPECT_NE(partitions2.back().partition(), last.partition());
+  for (auto &partition : partitions2) {
+    if (partition.contains(start)) {
+      partition.setStart(start);
+      EXPECT_EQ(partition.nextRequest().start, start);
+    }
+    while (not partition.complete()) {
+      ASSERT_NO_FATAL_FAILURE(step(partition));
+    }
+  }
+  ASSERT_OUTCOME_SUCCESS_TRY(flow2.resume());
+  EXPECT_TRUE(flow2.complete());
+  checkFetched();
+}
+
+/**
+ * @given state split into partitions
+ * @when response for partition contains nodes past its end
+ * @then following partition uses these nodes
+ * @and its next request starts after them
+ */
+TEST_F(StateSyncRequestFlowTest, RestOfResponse) {
+  makeState();
+  StateSyncRequestFlow flow{target_db_, block_, header_};
+  step(flow);
+  auto partitions = flow.partitions();
+  ASSERT_GT(partitions.size(), 2);
+  auto &first = partitions[0];
+  auto &second = partitions[1];
+  auto start = second.nextRequest().start;
+  CompactDecoded rest;
+  while (not first.complete()) {
+    ASSERT_OUTCOME_SUCCESS(res, observer_->onStateRequest(first.nextRequest()));
+    ASSERT_OUTCOME_SUCCESS_TRY(first.onResponse(res, rest));
+  }
+  ASSERT_FALSE(rest.empty());
+  auto count = rest.size();
+  ASSERT_OUTCOME_SUCCESS_TRY(second.onNodes(rest));
+  EXPECT_LT(rest.size(), count);
+  if (not second.complete()) {
+    EXPECT_NE(second.nextRequest().start, start);
+  }
+}
@@ -89,6 +89,8 @@ class SynchronizerTest
     auto state_pruner =
         std::make_shared<kagome::storage::trie_pruner::TriePrunerMock>();
 
+    ON_CALL(*spaced_storage, getSpace(_)).WillByDefault(Return(buffer_storage));
+
     main_thread_pool = std::make_shared<MainThreadPool>(
         watchdog, std::make_shared<boost::asio::io_context>());
 
@@ -111,7 +113,8 @@ class SynchronizerTest
                                                     nullptr,
                                                     grandpa_environment,
                                                     *main_thread_pool,
-                                                    block_storage);
+                                                    block_storage,
+                                                    spaced_storage);
   }
 
   void TearDown() override {
@@ -144,6 +147,8 @@ class SynchronizerTest
   std::shared_ptr<Timeline> timeline;
   std::shared_ptr<BufferStorageMock> buffer_storage =
       std::make_shared<BufferStorageMock>();
+  std::shared_ptr<SpacedStorageMock> spaced_storage =
+      std::make_shared<SpacedStorageMock>();
   std::shared_ptr<EnvironmentMock> grandpa_environment =
       std::make_shared<EnvironmentMock>();
   std::shared_ptr<blockchain::BlockStorageMock> block_storage =
@@ -0,0 +1,72 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <gtest/gtest.h>
+
+#include "parachain/approval/knowledge.hpp"
+
+using kagome::parachain::Hash;
+using kagome::parachain::approval::Knowledge;
+using kagome::parachain::approval::MessageKind;
+using kagome::parachain::approval::MessageSubject;
+using kagome::parachain::approval::MessageSubjects;
+
+namespace {
+  MessageSubject makeSubject(size_t candidate, uint32_t validator) {
+    scale::BitVector bits;
+    bits.resize(candidate + 1);
+    bits[candidate] = true;
+    return {Hash{}, bits, validator};
+  }
+}  // namespace
+
+/**
+ * @given subjects of one block
+ * @when they are interned repeatedly
+ * @then every subject gets its own dense index, which is stable
+ */
+TEST(ApprovalKnowledgeTest, InternsSubjects) {
+  MessageSubjects subjects;
+  EXPECT_EQ(subjects.find(makeSubject(0, 1)), MessageSubjects::kUnknown);
+  EXPECT_EQ(subjects.intern(makeSubject(0, 1)), 0);
+  EXPECT_EQ(subjects.intern(makeSubject(1, 1)), 1);
+  EXPECT_EQ(subjects.intern(makeSubject(0, 2)), 2);
+  EXPECT_EQ(subjects.intern(makeSubject(0, 1)), 0);
+  EXPECT_EQ(subjects.find(makeSubject(1, 1)), 1);
+  EXPECT_EQ(subjects.size(), 3);
+}
+
+/**
+ * @given empty knowledge
+ * @when assignment and then approval are inserted
+ * @then approval implies assignment, and each message is inserted once
+ */
+TEST(ApprovalKnowledgeTest, AssignmentThenApproval) {
+  Knowledge knowledge;
+  EXPECT_FALSE(knowledge.contains(MessageSubjects::kUnknown,
+                                  MessageKind::Assignment));
+  EXPECT_TRUE(knowledge.can_send(MessageSubjects::kUnknown,
+                                 MessageKind::Assignment));
+  EXPECT_FALSE(knowledge.can_send(100, MessageKind::Approval));
+
+  EXPECT_TRUE(knowledge.insert(100, MessageKind::Assignment));
+  EXPECT_FALSE(knowledge.insert(100, MessageKind::Assignment));
+  EXPECT_TRUE(knowledge.contains(100, MessageKind::Assignment));
+  EXPECT_FALSE(knowledge.contains(100, MessageKind::Approval));
+  EXPECT_FALSE(knowledge.contains(99, MessageKind::Assignment));
+  EXPECT_FALSE(knowledge.can_send(100, MessageKind::Assignment));
+  EXPECT_TRUE(knowledge.can_send(100, MessageKind::Approval));
+
+  EXPECT_TRUE(knowledge.insert(100, MessageKind::Approval));
+  EXPECT_FALSE(knowledge.insert(100, MessageKind::Approval));
+  EXPECT_FALSE(knowledge.insert(100, MessageKind::Assignment));
+  EXPECT_TRUE(knowledge.contains(100, MessageKind::Approval));
+  EXPECT_FALSE(knowledge.can_send(100, MessageKind::Approval));
+
+  EXPECT_TRUE(knowledge.insert(7, MessageKind::Approval));
+  EXPECT_TRUE(knowledge.contains(7, MessageKind::Assignment));
+  EXPECT_TRUE(knowledge.contains(7, MessageKind::Approval));
+}
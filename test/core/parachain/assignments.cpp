@@ -617,3 +617,28 @@ TEST_F(AssignmentsTest, check_rejects_modulo_core_wrong) {
         }
       });
 }
+
+/**
+ * @given approvals of one and of several candidates
+ * @when their signing payloads are built
+ * @then single candidate payload is the one of V1 approval vote, and payload
+ * of several candidates contains all of them
+ */
+TEST(ApprovalSigningPayloadTest, single_and_multiple_candidates) {
+  using kagome::parachain::approvalSigningPayload;
+  using kagome::parachain::CandidateHash;
+  constexpr std::array<uint8_t, 4> kMagic{'A', 'P', 'P', 'R'};
+  CandidateHash a, b;
+  a.fill(1);
+  b.fill(2);
+  kagome::parachain::SessionIndex session = 7;
+
+  EXPECT_EQ(approvalSigningPayload({a}, session),
+            Buffer{scale::encode(std::make_tuple(kMagic, a, session)).value()});
+  EXPECT_EQ(approvalSigningPayload({a, b}, session),
+            Buffer{scale::encode(std::make_tuple(
+                                     kMagic,
+                                     std::vector<CandidateHash>{a, b},
+                                     session))
+                       .value()});
+}
@@ -0,0 +1,129 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "parachain/availability/erasure_coder.hpp"
+
+#include <future>
+
+#include <gtest/gtest.h>
+
+#include <qtils/test/outcome.hpp>
+
+#include "common/worker_thread_pool.hpp"
+#include "parachain/availability/chunks.hpp"
+#include "parachain/availability/proof.hpp"
+#include "testutil/prepare_loggers.hpp"
+
+using kagome::TestThreadPool;
+using kagome::Watchdog;
+using kagome::common::WorkerThreadPool;
+using kagome::parachain::checkTrieProof;
+using kagome::parachain::ErasureCoder;
+using kagome::parachain::fromChunks;
+using kagome::parachain::makeTrieProof;
+using kagome::parachain::toChunks;
+using kagome::runtime::AvailableData;
+
+class ErasureCoderTest : public ::testing::TestWithParam<size_t> {
+ public:
+  static void SetUpTestCase() {
+    testutil::prepareLoggers();
+  }
+
+  void SetUp() override {
+    data_.pov.payload.resize(100000);
+    for (size_t i = 0; i < data_.pov.payload.size(); ++i) {
+      data_.pov.payload[i] = i * 7 + i / 251;
+    }
+  }
+
+  void TearDown() override {
+    watchdog_->stop();
+  }
+
+  /// Checks \arg encoded against the serial coding of the data
+  void expectSameAsSerial(size_t validators,
+                          const ErasureCoder::Chunks &encoded) {
+    ASSERT_OUTCOME_SUCCESS(expected, toChunks(validators, data_));
+    auto expected_root = makeTrieProof(expected);
+    EXPECT_EQ(encoded.erasure_root, expected_root);
+    ASSERT_EQ(encoded.chunks.size(), expected.size());
+    for (size_t i = 0; i < expected.size(); ++i) {
+      EXPECT_EQ(encoded.chunks[i].index, expected[i].index);
+      EXPECT_EQ(encoded.chunks[i].chunk, expected[i].chunk);
+      EXPECT_EQ(encoded.chunks[i].proof, expected[i].proof);
+      EXPECT_OUTCOME_SUCCESS(
+          checkTrieProof(encoded.chunks[i], encoded.erasure_root));
+    }
+
+    ASSERT_OUTCOME_SUCCESS(recovered, fromChunks(validators, encoded.chunks));
+    EXPECT_EQ(recovered.pov.payload, data_.pov.payload);
+  }
+
+ protected:
+  AvailableData data_;
+  std::shared_ptr<Watchdog> watchdog_ =
+      std::make_shared<Watchdog>(std::chrono::milliseconds(1));
+  std::shared_ptr<WorkerThreadPool> pool_ =
+      std::make_shared<WorkerThreadPool>(watchdog_, 4);
+};
+
+/**
+ * @given available data
+ * @when it is encoded by the coder with several threads
+ * @then chunks, proofs and the erasure root are the same as of the serial
+ * coding, every proof is valid and the data is recovered from the chunks
+ */
+TEST_P(ErasureCoderTest, SameAsSerial) {
+  auto validators = GetParam();
+  auto coder = std::make_shared<ErasureCoder>(pool_, 4);
+  ASSERT_OUTCOME_SUCCESS(encoded, coder->encode(validators, data_));
+  expectSameAsSerial(validators, encoded);
+}
+
+/**
+ * @given available data
+ * @when it is encoded asynchronously
+ * @then callback is called on the pool with the same chunks as of the serial
+ * coding
+ */
+TEST_P(ErasureCoderTest, EncodeAsync) {
+  auto validators = GetParam();
+  auto coder = std::make_shared<ErasureCoder>(pool_, 4);
+  std::promise<outcome::result<ErasureCoder::Chunks>> promise;
+  auto future = promise.get_future();
+  coder->encodeAsync(validators,
+                     std::make_shared<const AvailableData>(data_),
+                     [&](outcome::result<ErasureCoder::Chunks> r) {
+                       EXPECT_TRUE(pool_->io_context()
+                                       ->get_executor()
+                                       .running_in_this_thread());
+                       promise.set_value(std::move(r));
+                     });
+  ASSERT_EQ(future.wait_for(std::chrono::seconds(10)),
+            std::future_status::ready);
+  ASSERT_OUTCOME_SUCCESS(encoded, future.get());
+  expectSameAsSerial(validators, encoded);
+}
+
+/**
+ * @given coder with a pool, which never runs posted handlers
+ * @when data is encoded
+ * @then calling thread hashes all chunks itself instead of waiting for the
+ * pool
+ */
+TEST_P(ErasureCoderTest, IdlePool) {
+  auto validators = GetParam();
+  auto coder = std::make_shared<ErasureCoder>(
+      std::make_shared<WorkerThreadPool>(TestThreadPool{}), 4);
+  ASSERT_OUTCOME_SUCCESS(encoded, coder->encode(validators, data_));
+  expectSameAsSerial(validators, encoded);
+}
+
+// less chunks than are split between threads, and more
+INSTANTIATE_TEST_SUITE_P(Validators,
+                         ErasureCoderTest,
+                         ::testing::Values(10, 300));
@@ -10,6 +10,7 @@
 
 #include <qtils/test/outcome.hpp>
 
+#include "common/worker_thread_pool.hpp"
 #include "crypto/random_generator/boost_generator.hpp"
 #include "mock/core/application/chain_spec_mock.hpp"
 #include "mock/core/authority_discovery/query_mock.hpp"
@@ -28,8 +29,10 @@
 using kagome::Buffer;
 using kagome::application::ChainSpecMock;
 using kagome::authority_discovery::QueryMock;
+using kagome::TestThreadPool;
 using kagome::blockchain::BlockTreeMock;
 using kagome::common::Buffer;
+using kagome::common::WorkerThreadPool;
 using kagome::crypto::BoostRandomGenerator;
 using kagome::crypto::HasherMock;
 using kagome::crypto::SessionKeysMock;
@@ -158,7 +161,8 @@ class RecoveryTest : public testing::Test {
                                               query_audi,
                                               router,
                                               peer_manager,
-                                              session_keys);
+                                              session_keys,
+                                              *worker_thread_pool);
 
     auto &val_group_0 = session.validator_groups.emplace_back();
     for (size_t i = 0; i < n_validators; ++i) {
@@ -193,6 +197,12 @@ class RecoveryTest : public testing::Test {
     original_chunks.clear();
   }
 
+  /// Runs decoding and checks of data posted to worker
+  void runWorker() {
+    io->restart();
+    io->run();
+  }
+
   BoostRandomGenerator random_generator;
 
   size_t n_validators = 10;
@@ -227,6 +237,11 @@ class RecoveryTest : public testing::Test {
           outcome::result<kagome::network::FetchChunkResponseObsolete>)>>>
       fetch_chunk_obsolete_requests;
 
+  std::shared_ptr<boost::asio::io_context> io =
+      std::make_shared<boost::asio::io_context>();
+  std::shared_ptr<WorkerThreadPool> worker_thread_pool =
+      std::make_shared<WorkerThreadPool>(TestThreadPool{io});
+
   std::shared_ptr<ChainSpecMock> chain_spec;
   std::shared_ptr<HasherMock> hasher;
   std::shared_ptr<BlockTreeMock> block_tree;
@@ -280,6 +295,55 @@ TEST_F(RecoveryTest, FullFromBakers_Success) {
     cb(original_available_data);
   }
 
+  runWorker();
+  testing::Mock::VerifyAndClear(callback.get());
+
+  ASSERT_TRUE(available_data_res_opt.has_value());
+  ASSERT_OUTCOME_SUCCESS(available_data, available_data_res_opt.value());
+  ASSERT_EQ(available_data, original_available_data);
+}
+
+/**
+ * @given backing group
+ * @when recovery is started
+ * @then several backers are asked for full data at once
+ * @and the first valid data completes recovery, while later is ignored
+ */
+TEST_F(RecoveryTest, FullFromBakers_Race) {
+  prepareAvailableData(2048);
+
+  std::optional<GroupIndex> backing_group = 0;
+  std::optional<CoreIndex> core = std::nullopt;
+
+  std::optional<outcome::result<AvailableData>> available_data_res_opt;
+
+  EXPECT_CALL(*callback, Call(_))
+      .WillOnce(WithArgs<0>(
+          [&](std::optional<outcome::result<AvailableData>> x) mutable {
+            available_data_res_opt = std::move(x);
+          }));
+
+  recovery->recover(
+      receipt, session_index, backing_group, core, callback->AsStdFunction());
+
+  ASSERT_GT(fetch_available_data_requests.size(), size_t{1});
+
+  // The first backer has no data, the next one is asked instead
+  auto requests = fetch_available_data_requests.size();
+  std::get<2>(fetch_available_data_requests.front())(kagome::network::Empty{});
+  fetch_available_data_requests.pop();
+  ASSERT_EQ(fetch_available_data_requests.size(), requests);
+
+  while (not fetch_available_data_requests.empty()) {
+    auto [peer_id, req, cb] = std::move(fetch_available_data_requests.front());
+    fetch_available_data_requests.pop();
+    cb(original_available_data);
+  }
+
+  // No chunks are requested while data of backers is being checked
+  ASSERT_TRUE(fetch_chunk_requests.empty());
+
+  runWorker();
   testing::Mock::VerifyAndClear(callback.get());
 
   ASSERT_TRUE(available_data_res_opt.has_value());
@@ -320,6 +384,7 @@ TEST_F(RecoveryTest, SystematicChunks_NoCore) {
     fetch_chunk_requests.pop();
   }
 
+  runWorker();
   testing::Mock::VerifyAndClear(callback.get());
 
   ASSERT_TRUE(available_data_res_opt.has_value());
@@ -360,6 +425,7 @@ TEST_F(RecoveryTest, SystematicChunks_Success) {
     fetch_chunk_requests.pop();
   }
 
+  runWorker();
   testing::Mock::VerifyAndClear(callback.get());
 
   ASSERT_TRUE(available_data_res_opt.has_value());
@@ -404,6 +470,7 @@ TEST_F(RecoveryTest, RegularChunks_Success) {
     fetch_chunk_requests.pop();
   }
 
+  runWorker();
   testing::Mock::VerifyAndClear(callback.get());
 
   ASSERT_TRUE(available_data_res_opt.has_value());
@@ -452,6 +519,7 @@ TEST_F(RecoveryTest, CorruptedChunk) {
     fetch_chunk_requests.pop();
   }
 
+  runWorker();
   testing::Mock::VerifyAndClear(callback.get());
 
   ASSERT_TRUE(available_data_res_opt.has_value());
@@ -499,6 +567,7 @@ TEST_F(RecoveryTest, InsufficientChunks) {
     fetch_chunk_requests.pop();
   }
 
+  runWorker();
   testing::Mock::VerifyAndClear(callback.get());
 
   ASSERT_FALSE(available_data_res_opt.has_value());
@@ -554,6 +623,7 @@ TEST_F(RecoveryTest, DelayedChunks) {
   // Available data still is not reconstructed
   ASSERT_FALSE(available_data_res_opt.has_value());
 
+  runWorker();
   testing::Mock::VerifyAndClear(callback.get());
 
   EXPECT_CALL(*callback, Call(_))
@@ -575,6 +645,7 @@ TEST_F(RecoveryTest, DelayedChunks) {
     fetch_chunk_requests.pop();
   }
 
+  runWorker();
   testing::Mock::VerifyAndClear(callback.get());
 
   ASSERT_TRUE(available_data_res_opt.has_value());
@@ -621,6 +692,7 @@ TEST_F(RecoveryTest, DuplicateChunk) {
     fetch_chunk_requests.pop();
   }
 
+  runWorker();
   testing::Mock::VerifyAndClear(callback.get());
 
   ASSERT_TRUE(available_data_res_opt.has_value());
@@ -669,6 +741,7 @@ TEST_F(RecoveryTest, FailureHandling) {
     fetch_chunk_requests.pop();
   }
 
+  runWorker();
   testing::Mock::VerifyAndClear(callback.get());
 
   ASSERT_TRUE(available_data_res_opt.has_value());
@@ -707,6 +780,7 @@ TEST_F(RecoveryTest, LargeScaleRecovery) {
     fetch_chunk_requests.pop();
   }
 
+  runWorker();
   testing::Mock::VerifyAndClear(callback.get());
 
   ASSERT_TRUE(available_data_res_opt.has_value());
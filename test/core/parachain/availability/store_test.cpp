@@ -0,0 +1,175 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "parachain/availability/store/store_impl.hpp"
+
+#include <gtest/gtest.h>
+
+#include "mock/core/application/app_state_manager_mock.hpp"
+#include "mock/core/clock/clock_mock.hpp"
+#include "parachain/availability/store/availability_data_key.hpp"
+#include "storage/in_memory/in_memory_spaced_storage.hpp"
+#include "testutil/prepare_loggers.hpp"
+
+using kagome::application::AppStateManagerMock;
+using kagome::clock::SteadyClockMock;
+using kagome::clock::SystemClockMock;
+using kagome::common::Buffer;
+using kagome::network::ErasureChunk;
+using kagome::network::ParachainBlock;
+using kagome::parachain::AvailabilityStoreImpl;
+using kagome::parachain::CandidateHash;
+using kagome::primitives::events::ChainSubscriptionEngine;
+using kagome::runtime::AvailableData;
+using kagome::runtime::PersistedValidationData;
+using kagome::storage::InMemorySpacedStorage;
+
+using testing::_;
+using testing::Invoke;
+
+class AvailabilityStoreTest : public testing::Test {
+ public:
+  static void SetUpTestCase() {
+    testutil::prepareLoggers();
+  }
+
+  void SetUp() override {
+    EXPECT_CALL(*app_state_manager_, atLaunch(_)).Times(testing::AnyNumber());
+    EXPECT_CALL(steady_clock_, nowUint64())
+        .WillRepeatedly(Invoke([&] { return now_; }));
+    EXPECT_CALL(system_clock_, nowUint64())
+        .WillRepeatedly(Invoke([&] { return now_; }));
+  }
+
+  /// Creates store over the same storage, as after restart
+  std::shared_ptr<AvailabilityStoreImpl> makeStore() {
+    auto store = std::make_shared<AvailabilityStoreImpl>(
+        app_state_manager_,
+        steady_clock_,
+        system_clock_,
+        storage_,
+        std::make_shared<ChainSubscriptionEngine>());
+    EXPECT_TRUE(store->start());
+    return store;
+  }
+
+  static CandidateHash candidate(uint8_t i) {
+    CandidateHash hash;
+    hash.fill(i);
+    return hash;
+  }
+
+  static AvailableData availableData(uint8_t i) {
+    return {
+        .pov = ParachainBlock{Buffer(100, i)},
+        .validation_data =
+            PersistedValidationData{
+                .parent_head = Buffer{i},
+                .relay_parent_number = i,
+                .relay_parent_storage_root = {},
+                .max_pov_size = 1000,
+            },
+    };
+  }
+
+  static std::vector<ErasureChunk> chunks(uint8_t i) {
+    std::vector<ErasureChunk> chunks;
+    for (uint32_t index = 0; index < 3; ++index) {
+      chunks.emplace_back(ErasureChunk{
+          .chunk = Buffer(10, i), .index = index, .proof = {Buffer{i}}});
+    }
+    return chunks;
+  }
+
+  void storeCandidate(AvailabilityStoreImpl &store, uint8_t i) {
+    auto data = availableData(i);
+    store.storeData(candidate(i),
+                    candidate(i),
+                    chunks(i),
+                    data.pov,
+                    data.validation_data);
+  }
+
+  std::shared_ptr<AppStateManagerMock> app_state_manager_ =
+      std::make_shared<AppStateManagerMock>();
+  SteadyClockMock steady_clock_;
+  SystemClockMock system_clock_;
+  std::shared_ptr<InMemorySpacedStorage> storage_ =
+      std::make_shared<InMemorySpacedStorage>();
+  uint64_t now_ = 1000;
+};
+
+/**
+ * @given candidate stored and removed from memory
+ * @when store is restarted over the same storage
+ * @then available data and chunks of candidate are read from disk
+ */
+TEST_F(AvailabilityStoreTest, ReadsFromDiskAfterRestart) {
+  auto store = makeStore();
+  storeCandidate(*store, 1);
+  store->remove(candidate(1));
+  EXPECT_TRUE(store->hasData(candidate(1)));
+
+  store = makeStore();
+  EXPECT_TRUE(store->hasPov(candidate(1)));
+  EXPECT_EQ(store->getPovAndData(candidate(1)), availableData(1));
+  EXPECT_EQ(store->getPov(candidate(1)), availableData(1).pov);
+  auto chunk = store->getChunk(candidate(1), 2);
+  ASSERT_TRUE(chunk);
+  EXPECT_EQ(chunk->chunk, chunks(1)[2].chunk);
+  EXPECT_FALSE(store->hasData(candidate(2)));
+}
+
+/**
+ * @given candidates stored a day apart
+ * @when store is restarted after the first one expired
+ * @then only the first one is pruned from disk
+ */
+TEST_F(AvailabilityStoreTest, PrunesExpiredFromDisk) {
+  auto store = makeStore();
+  storeCandidate(*store, 1);
+  now_ += 24 * 60 * 60;
+  storeCandidate(*store, 2);
+
+  now_ += 60 * 60;
+  store = makeStore();
+  EXPECT_FALSE(store->hasData(candidate(1)));
+  EXPECT_FALSE(store->hasChunk(candidate(1), 0));
+  EXPECT_TRUE(store->hasData(candidate(2)));
+  EXPECT_TRUE(store->hasChunk(candidate(2), 0));
+}
+
+/**
+ * @given candidate stored, and one more chunk of it put a day later
+ * @when store is restarted after the candidate expired
+ * @then candidate has single pruning index entry, of the first write, and it
+ * is pruned from disk with all of its chunks
+ */
+TEST_F(AvailabilityStoreTest, IndexesCandidateOnce) {
+  auto store = makeStore();
+  storeCandidate(*store, 1);
+  now_ += 24 * 60 * 60;
+  auto chunk = chunks(1)[0];
+  chunk.index = 5;
+  store->putChunk(candidate(1), candidate(1), std::move(chunk));
+
+  size_t entries = 0;
+  auto cursor =
+      storage_->getSpace(kagome::storage::Space::kAvailabilityData)->cursor();
+  ASSERT_TRUE(cursor->seekFirst());
+  for (; cursor->isValid(); std::ignore = cursor->next()) {
+    if (kagome::AvailabilityDataKey::decodePrune(*cursor->key())) {
+      ++entries;
+    }
+  }
+  EXPECT_EQ(entries, 1);
+
+  now_ += 60 * 60;
+  store = makeStore();
+  EXPECT_FALSE(store->hasData(candidate(1)));
+  EXPECT_FALSE(store->hasChunk(candidate(1), 0));
+  EXPECT_FALSE(store->hasChunk(candidate(1), 5));
+}
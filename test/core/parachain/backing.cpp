@@ -40,6 +40,7 @@
 #include "mock/core/parachain/statement_distribution_mock.hpp"
 #include "mock/core/runtime/parachain_host_mock.hpp"
 #include "parachain/availability/chunks.hpp"
+#include "parachain/availability/erasure_coder.hpp"
 #include "parachain/availability/proof.hpp"
 #include "parachain/validator/parachain_processor.hpp"
 #include "primitives/event_types.hpp"
@@ -126,6 +127,7 @@ class BackingTest : public ProspectiveParachainsTestHarness {
         backing_store_,
         pvf_,
         av_store_,
+        std::make_shared<ErasureCoder>(nullptr, 1),
         parachain_host_,
         signer_factory_,
         app_config_,
@@ -0,0 +1,183 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <atomic>
+#include <map>
+#include <mutex>
+#include <numeric>
+#include <optional>
+#include <string>
+#include <thread>
+
+#include <boost/asio/executor_work_guard.hpp>
+
+#include "parachain/approval/verification_queue.hpp"
+
+using kagome::PoolHandler;
+
+namespace {
+  struct Item {
+    int value;
+    std::optional<int> checked{};
+    std::thread::id checked_on{};
+  };
+
+  using Queue = kagome::parachain::approval::VerificationQueue<Item>;
+}  // namespace
+
+class VerificationQueueTest : public testing::Test {
+ public:
+  void SetUp() override {
+    owner->start();
+    pool->start();
+    for (auto &thread : pool_threads) {
+      thread = std::thread{[this] { pool_io->run(); }};
+    }
+  }
+
+  void TearDown() override {
+    pool_work.reset();
+    for (auto &thread : pool_threads) {
+      thread.join();
+    }
+  }
+
+  /// Queue, which checks every distinct value once
+  std::shared_ptr<Queue> makeQueue(Queue::Config config,
+                                   size_t expected_imports) {
+    return std::make_shared<Queue>(
+        config,
+        owner,
+        pool,
+        [this](std::vector<Item> &items) {
+          std::lock_guard lock{mutex};
+          events.emplace_back("prepare");
+          std::map<int, std::vector<size_t>> identical;
+          for (size_t i = 0; i < items.size(); ++i) {
+            identical[items[i].value].emplace_back(i);
+          }
+          Queue::Checks checks;
+          for (auto &[value, indices] : identical) {
+            checks.emplace_back([this, &items, value, indices] {
+              // later checks finish earlier
+              std::this_thread::sleep_for(
+                  std::chrono::milliseconds(20 - value));
+              ++checks_done;
+              for (auto i : indices) {
+                items[i].checked = value * 10;
+                items[i].checked_on = std::this_thread::get_id();
+              }
+            });
+          }
+          return checks;
+        },
+        [this, expected_imports](std::vector<Item> items, auto) {
+          std::lock_guard lock{mutex};
+          events.emplace_back("import");
+          for (auto &item : items) {
+            imported.emplace_back(std::move(item));
+          }
+          if (imported.size() == expected_imports) {
+            owner_io->stop();
+          }
+        });
+  }
+
+  /// Pushes \arg values to \arg queue on the owner thread, runs it until all
+  /// values are imported
+  void verify(const std::shared_ptr<Queue> &queue,
+              const std::vector<int> &values) {
+    owner->execute([&] {
+      for (auto value : values) {
+        EXPECT_TRUE(queue->push(Item{.value = value}));
+      }
+      queue->verify();
+    });
+    owner_io->run();
+  }
+
+  std::shared_ptr<boost::asio::io_context> owner_io =
+      std::make_shared<boost::asio::io_context>();
+  boost::asio::executor_work_guard<boost::asio::io_context::executor_type>
+      owner_work = boost::asio::make_work_guard(*owner_io);
+  std::shared_ptr<PoolHandler> owner = std::make_shared<PoolHandler>(owner_io);
+
+  std::shared_ptr<boost::asio::io_context> pool_io =
+      std::make_shared<boost::asio::io_context>();
+  std::optional<
+      boost::asio::executor_work_guard<boost::asio::io_context::executor_type>>
+      pool_work = boost::asio::make_work_guard(*pool_io);
+  std::shared_ptr<PoolHandler> pool = std::make_shared<PoolHandler>(pool_io);
+  std::array<std::thread, 4> pool_threads;
+
+  std::mutex mutex;
+  std::vector<std::string> events;
+  std::vector<Item> imported;
+  std::atomic_size_t checks_done = 0;
+};
+
+/**
+ * @given queue with a batch of messages, some of them identical
+ * @when the batch is verified
+ * @then every distinct message is checked once on the pool, and results are
+ * written to all identical messages
+ */
+TEST_F(VerificationQueueTest, BatchVerification) {
+  auto queue = makeQueue({.capacity = 100, .max_batch = 8, .max_chunks = 4},
+                         8);
+  verify(queue, {1, 1, 2, 3, 3, 3, 4, 5});
+
+  EXPECT_EQ(checks_done, 5);
+  EXPECT_EQ(events, (std::vector<std::string>{"prepare", "import"}));
+  ASSERT_EQ(imported.size(), 8);
+  for (auto &item : imported) {
+    EXPECT_EQ(item.checked, item.value * 10);
+    EXPECT_NE(item.checked_on, std::thread::id{});
+    EXPECT_NE(item.checked_on, std::this_thread::get_id());
+  }
+}
+
+/**
+ * @given queue with more messages than fit a batch
+ * @when checks of later messages finish earlier
+ * @then messages are imported in order of their arrival, and the next batch
+ * is prepared only after the previous one is imported
+ */
+TEST_F(VerificationQueueTest, InOrderImport) {
+  auto queue = makeQueue({.capacity = 100, .max_batch = 8, .max_chunks = 8},
+                         16);
+  std::vector<int> values(16);
+  std::iota(values.begin(), values.end(), 0);
+  verify(queue, values);
+
+  EXPECT_EQ(checks_done, 16);
+  EXPECT_EQ(events,
+            (std::vector<std::string>{
+                "prepare", "import", "prepare", "import"}));
+  ASSERT_EQ(imported.size(), values.size());
+  for (size_t i = 0; i < values.size(); ++i) {
+    EXPECT_EQ(imported[i].value, values[i]);
+    EXPECT_EQ(imported[i].checked, values[i] * 10);
+  }
+}
+
+/**
+ * @given full queue
+ * @when one more message is pushed
+ * @then it is dropped
+ */
+TEST_F(VerificationQueueTest, DropsOverflow) {
+  auto queue = makeQueue({.capacity = 2, .max_batch = 8, .max_chunks = 4}, 2);
+  EXPECT_TRUE(queue->push(Item{.value = 1}));
+  EXPECT_FALSE(queue->full());
+  EXPECT_TRUE(queue->push(Item{.value = 2}));
+  EXPECT_TRUE(queue->full());
+  EXPECT_FALSE(queue->push(Item{.value = 3}));
+  EXPECT_EQ(queue->size(), 2);
+}
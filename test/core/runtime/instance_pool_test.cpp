@@ -104,3 +104,100 @@ TEST(InstancePoolTest, HeavilyMultithreadedCompilation) {
         RuntimeContext::ContextParams{{}, {}, {}}));
   }
 }
+
+/**
+ * @given a pool with a compiled module
+ * @when many threads borrow and release instances concurrently
+ * @then released instances are reused, so no more instances are created than
+ * are borrowed at the same time
+ */
+TEST(InstancePoolTest, ConcurrentBorrowReusesInstances) {
+  testutil::prepareLoggers();
+
+  static constexpr int THREAD_NUM = 8;
+  static constexpr int CALLS_NUM = 1000;
+
+  auto module_mock = std::make_shared<ModuleMock>();
+  std::atomic_int created = 0;
+  EXPECT_CALL(*module_mock, instantiate()).WillRepeatedly([&] {
+    ++created;
+    return std::make_shared<ModuleInstanceMock>();
+  });
+  auto module_factory = std::make_shared<ModuleFactoryMock>();
+  EXPECT_CALL(*module_factory, compilerType())
+      .WillRepeatedly(Return(std::nullopt));
+  EXPECT_CALL(*module_factory, compile(_, _, _)).WillRepeatedly([] {
+    return outcome::success();
+  });
+  EXPECT_CALL(*module_factory, loadCompiled(_, _)).WillOnce([&] {
+    return module_mock;
+  });
+
+  AppConfigurationMock app_config;
+  EXPECT_CALL(app_config, runtimeCacheDirPath()).WillRepeatedly(Return("/tmp"));
+  auto pool = std::make_shared<RuntimeInstancesPoolImpl>(
+      app_config, module_factory, std::make_shared<NoopWasmInstrumenter>());
+  auto code = std::make_shared<Buffer>("runtime_code"_buf);
+  ASSERT_OUTCOME_SUCCESS(
+      pool->precompile(make_code_hash(0),
+                       [&] { return code; },
+                       RuntimeContext::ContextParams{{}, {}, {}}));
+
+  std::vector<std::thread> threads;
+  for (int i = 0; i < THREAD_NUM; i++) {
+    threads.emplace_back([&] {
+      for (int call = 0; call < CALLS_NUM; ++call) {
+        ASSERT_OUTCOME_SUCCESS(pool->instantiateFromCode(
+            make_code_hash(0),
+            [&] { return code; },
+            RuntimeContext::ContextParams{{}, {}, {}}));
+      }
+    });
+  }
+  for (auto &t : threads) {
+    t.join();
+  }
+  EXPECT_GE(created, 1);
+  EXPECT_LE(created, THREAD_NUM);
+}
+
+/**
+ * @given an instance borrowed from a pool
+ * @when its module is evicted by newer modules before the instance is released
+ * @then the instance is released without errors and the evicted module is
+ * compiled again on the next call
+ */
+TEST(InstancePoolTest, ReleaseAfterEviction) {
+  testutil::prepareLoggers();
+
+  auto module_mock = std::make_shared<ModuleMock>();
+  EXPECT_CALL(*module_mock, instantiate()).WillRepeatedly([] {
+    return std::make_shared<ModuleInstanceMock>();
+  });
+  auto module_factory = std::make_shared<ModuleFactoryMock>();
+  EXPECT_CALL(*module_factory, compilerType())
+      .WillRepeatedly(Return(std::nullopt));
+  EXPECT_CALL(*module_factory, compile(_, _, _)).WillRepeatedly([] {
+    return outcome::success();
+  });
+  EXPECT_CALL(*module_factory, loadCompiled(_, _))
+      .Times(4)
+      .WillRepeatedly([&] { return module_mock; });
+
+  AppConfigurationMock app_config;
+  EXPECT_CALL(app_config, runtimeCacheDirPath()).WillRepeatedly(Return("/tmp"));
+  auto pool = std::make_shared<RuntimeInstancesPoolImpl>(
+      app_config, module_factory, std::make_shared<NoopWasmInstrumenter>(), 2);
+  auto code = std::make_shared<Buffer>("runtime_code"_buf);
+  auto instantiate = [&](int i) {
+    return pool->instantiateFromCode(make_code_hash(i),
+                                     [&] { return code; },
+                                     RuntimeContext::ContextParams{{}, {}, {}});
+  };
+
+  ASSERT_OUTCOME_SUCCESS(borrowed, instantiate(0));
+  ASSERT_OUTCOME_SUCCESS(instantiate(1));
+  ASSERT_OUTCOME_SUCCESS(instantiate(2));
+  borrowed.reset();
+  ASSERT_OUTCOME_SUCCESS(instantiate(0));
+}
@@ -0,0 +1,157 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "runtime/common/memory_snapshot.hpp"
+
+#include <algorithm>
+
+#include <sys/mman.h>
+
+#include <gtest/gtest.h>
+
+#include <qtils/test/outcome.hpp>
+
+#include "mock/core/runtime/module_instance_mock.hpp"
+#include "testutil/prepare_loggers.hpp"
+#include "testutil/runtime/memory.hpp"
+
+using kagome::common::Buffer;
+using kagome::runtime::BytesOut;
+using kagome::runtime::kMemoryPageSize;
+using kagome::runtime::Memory;
+using kagome::runtime::MemoryHandle;
+using kagome::runtime::MemorySnapshot;
+using kagome::runtime::ModuleInstance;
+using kagome::runtime::ModuleInstanceMock;
+using kagome::runtime::TestMemory;
+using kagome::runtime::WasmPointer;
+using kagome::runtime::WasmSize;
+using testing::_;
+
+/**
+ * Memory reserved with mmap, like the one of WAVM and WasmEdge
+ */
+struct MmapMemoryHandle : MemoryHandle {
+  MmapMemoryHandle(size_t size, size_t offset)
+      : size_{size},
+        offset_{offset},
+        base_{static_cast<uint8_t *>(mmap(nullptr,
+                                          size + offset,
+                                          PROT_READ | PROT_WRITE,
+                                          MAP_PRIVATE | MAP_ANONYMOUS,
+                                          -1,
+                                          0))} {}
+
+  ~MmapMemoryHandle() override {
+    munmap(base_, size_ + offset_);
+  }
+
+  WasmSize size() const override {
+    return size_;
+  }
+
+  std::optional<WasmSize> pagesMax() const override {
+    return std::nullopt;
+  }
+
+  void resize(WasmSize new_size) override {}
+
+  outcome::result<BytesOut> view(WasmPointer ptr,
+                                 WasmSize size) const override {
+    return BytesOut{base_ + offset_ + ptr, size};
+  }
+
+  size_t size_;
+  size_t offset_;
+  uint8_t *base_;
+};
+
+class MemorySnapshotTest : public ::testing::TestWithParam<size_t> {
+ public:
+  static void SetUpTestCase() {
+    testutil::prepareLoggers();
+  }
+
+  void SetUp() override {
+    handle_ = std::make_shared<MmapMemoryHandle>(4 * kMemoryPageSize,
+                                                 GetParam());
+    memory_ = std::make_unique<Memory>(
+        handle_, std::make_unique<TestMemory::TestMemoryAllocator>(dummy_));
+    EXPECT_CALL(instance_, forDataSegment(_))
+        .WillRepeatedly([&](const ModuleInstance::DataSegmentProcessor &cb) {
+          cb(16, segment1_);
+          cb(kMemoryPageSize + 8, segment2_);
+          // adjacent to the previous one
+          cb(kMemoryPageSize + 11, segment3_);
+        });
+  }
+
+  void dirty() {
+    auto all = memory_->view(0, handle_->size()).value();
+    std::ranges::fill(all, 0xff);
+  }
+
+  void expectSegments() {
+    EXPECT_EQ(Buffer{memory_->loadN(16, 4)}, segment1_);
+    EXPECT_EQ(Buffer{memory_->loadN(kMemoryPageSize + 8, 3)}, segment2_);
+    EXPECT_EQ(Buffer{memory_->loadN(kMemoryPageSize + 11, 2)}, segment3_);
+  }
+
+ protected:
+  Buffer segment1_{1, 2, 3, 4};
+  Buffer segment2_{5, 6, 7};
+  Buffer segment3_{8, 9};
+  Buffer dummy_;
+  std::shared_ptr<MmapMemoryHandle> handle_;
+  std::unique_ptr<Memory> memory_;
+  ModuleInstanceMock instance_;
+};
+
+/**
+ * @given memory written by a previous call
+ * @when it is restored from the snapshot several times
+ * @then data segments are written every time, the rest of memory is left as
+ * it is
+ */
+TEST_P(MemorySnapshotTest, RestoresSegments) {
+  MemorySnapshot snapshot;
+  for (int i = 0; i < 3; ++i) {
+    dirty();
+    ASSERT_OUTCOME_SUCCESS(snapshot.restore(instance_, *memory_));
+    EXPECT_EQ(snapshot.dataEnd(), kMemoryPageSize + 13);
+    expectSegments();
+    EXPECT_EQ(memory_->view(0, 1).value()[0], 0xff);
+    EXPECT_EQ(memory_->view(20, 1).value()[0], 0xff);
+    EXPECT_EQ(memory_->view(kMemoryPageSize + 13, 1).value()[0], 0xff);
+  }
+}
+
+/**
+ * @given a snapshot restored into two memories
+ * @when one of them is written
+ * @then the other one and later restores are not affected
+ */
+TEST_P(MemorySnapshotTest, WritesAreNotShared) {
+  MemorySnapshot snapshot;
+  ASSERT_OUTCOME_SUCCESS(snapshot.restore(instance_, *memory_));
+
+  auto other_handle =
+      std::make_shared<MmapMemoryHandle>(4 * kMemoryPageSize, GetParam());
+  Memory other{other_handle,
+               std::make_unique<TestMemory::TestMemoryAllocator>(dummy_)};
+  ASSERT_OUTCOME_SUCCESS(snapshot.restore(instance_, other));
+
+  memory_->storeBuffer(16, Buffer{9, 9});
+  EXPECT_EQ(Buffer{other.loadN(16, 4)}, segment1_);
+
+  ASSERT_OUTCOME_SUCCESS(snapshot.restore(instance_, *memory_));
+  expectSegments();
+}
+
+// segments are copied into memory regardless of its alignment
+INSTANTIATE_TEST_SUITE_P(Alignment,
+                         MemorySnapshotTest,
+                         ::testing::Values(0, 8));
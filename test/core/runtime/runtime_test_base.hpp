@@ -137,7 +137,8 @@ class RuntimeTestBaseImpl {
         key_store,
         offchain_storage_,
         offchain_worker_pool_,
-        testutil::sptr_to_lazy<api::StateApi>(state_api_mock));
+        testutil::sptr_to_lazy<api::StateApi>(state_api_mock),
+        nullptr);
 
     block_tree_ =
         std::make_shared<testing::NiceMock<blockchain::BlockTreeMock>>();
@@ -33,7 +33,8 @@ TEST_P(KeyToNibbles, keyToNibbles) {
   auto codec = std::make_unique<PolkadotCodec>();
   auto [nibbles, key] = GetParam();
   auto actualNibbles = KeyNibbles::fromByteBuffer(key);
-  ASSERT_EQ(nibbles, actualNibbles);
+  ASSERT_EQ(KeyNibbles{nibbles}, actualNibbles);
+  ASSERT_EQ(actualNibbles.packedSize(), key.size());
 }
 
 const std::vector<std::pair<Buffer, Buffer>> KEY_TO_NIBBLES = {
@@ -52,6 +53,64 @@ const std::vector<std::pair<KeyNibbles, Buffer>> NIBBLES_TO_KEY_LE = {
     {{0xa, 0xa, 0xf, 0xf, 0x0, 0x1, 0xc, 0x2}, {0xaa, 0xff, 0x01, 0xc2}},
     {{0xa, 0xa, 0xf, 0xf, 0x0, 0x1, 0xc}, {0xa, 0xaf, 0xf0, 0x1c}}};
 
+/**
+ * @given a partial key of odd length, as stored in a trie node
+ * @when it is decoded to nibbles and encoded back
+ * @then the bytes are kept as is and the nibbles are correct
+ */
+TEST(KeyNibblesTest, PartialKeyRoundTrip) {
+  auto nibbles = KeyNibbles::fromPartialKey(Buffer{0x0a, 0xbc}, 3);
+  EXPECT_EQ(nibbles, (KeyNibbles{0xa, 0xb, 0xc}));
+  EXPECT_EQ(nibbles.packedSize(), 2);
+  EXPECT_EQ(nibbles.toByteBuffer(), (Buffer{0x0a, 0xbc}));
+  EXPECT_EQ(nibbles.toHex(), "abc");
+}
+
+/**
+ * @given nibble sequences with the same and with different alignment
+ * @when common prefix length is computed
+ * @then it is the same as a nibble by nibble comparison would give
+ */
+TEST(KeyNibblesTest, CommonPrefixLength) {
+  Buffer key(40, 0x5a);
+  auto other_key = key;
+  other_key[35] = 0x5b;
+  auto nibbles = KeyNibbles::fromByteBuffer(key);
+  auto other = KeyNibbles::fromByteBuffer(other_key);
+  // aligned, word at a time
+  EXPECT_EQ(nibbles.view().commonPrefixLength(other), 71);
+  EXPECT_EQ(nibbles.subspan(1).commonPrefixLength(other.subspan(1)), 70);
+  // unaligned, "5a5a..." vs "a5a5..."
+  EXPECT_EQ(nibbles.subspan(1).commonPrefixLength(other), 0);
+  EXPECT_EQ(nibbles.subspan(2).commonPrefixLength(other), 69);
+  EXPECT_TRUE(nibbles.view().startsWith(other.first(71)));
+  EXPECT_FALSE(nibbles.view().startsWith(other.first(72)));
+  EXPECT_EQ(nibbles.subspan(3, 10), other.subspan(5, 10));
+  EXPECT_NE(nibbles.subspan(3, 10), other.subspan(4, 10));
+}
+
+/**
+ * @given nibble sequences of different alignment
+ * @when they are concatenated
+ * @then the result is the same as a nibble by nibble concatenation
+ */
+TEST(KeyNibblesTest, Append) {
+  auto bytes = KeyNibbles::fromByteBuffer(Buffer{0x12, 0x34, 0x56});
+  for (size_t prefix = 0; prefix < 4; ++prefix) {
+    for (size_t offset = 0; offset < 4; ++offset) {
+      KeyNibbles expected{bytes.first(prefix)};
+      for (auto nibble : bytes.subspan(offset)) {
+        expected.push_back(nibble);
+      }
+      KeyNibbles actual{bytes.first(prefix)};
+      actual.append(bytes.subspan(offset));
+      EXPECT_EQ(actual, expected) << prefix << " " << offset;
+      EXPECT_EQ(actual.size(), prefix + 6 - offset);
+      EXPECT_EQ(actual.packedSize(), (prefix + 6 - offset + 1) / 2);
+    }
+  }
+}
+
 INSTANTIATE_TEST_SUITE_P(KeyToNibbles,
                          KeyToNibbles,
                          ::testing::ValuesIn(KEY_TO_NIBBLES));
@@ -30,6 +30,7 @@ using kagome::common::BufferOrView;
 using kagome::common::BufferView;
 using kagome::common::Hash256;
 using kagome::primitives::BlockHash;
+using kagome::storage::BufferBatch;
 using kagome::storage::Space;
 using kagome::storage::SpacedStorageMock;
 using kagome::storage::trie::StateVersion;
@@ -58,9 +59,11 @@ class TrieBatchTest : public test::BaseRocksDB_Test {
 
     auto state_pruner = std::make_shared<TriePrunerMock>();
     ON_CALL(*state_pruner,
-            addNewState(
-                testing::A<const kagome::storage::trie::PolkadotTrie &>(), _))
-        .WillByDefault(Return(outcome::success()));
+            addNewState(testing::A<const PolkadotTrie &>(), _, _))
+        .WillByDefault([](auto &, auto, auto batch) {
+          return outcome::result<std::unique_ptr<BufferBatch>>{
+              std::move(batch)};
+        });
 
     trie =
         TrieStorageImpl::createEmpty(factory, codec, serializer, state_pruner)
@@ -207,10 +210,12 @@ TEST_F(TrieBatchTest, ConsistentOnFailure) {
   auto serializer = std::make_shared<TrieSerializerImpl>(
       factory, codec, std::make_shared<TrieStorageBackendImpl>(spaced_db));
   auto state_pruner = std::make_shared<TriePrunerMock>();
-  ON_CALL(
-      *state_pruner,
-      addNewState(testing::A<const kagome::storage::trie::PolkadotTrie &>(), _))
-      .WillByDefault(Return(outcome::success()));
+  ON_CALL(*state_pruner,
+          addNewState(testing::A<const PolkadotTrie &>(), _, _))
+      .WillByDefault([](auto &, auto, auto batch) {
+        return outcome::result<std::unique_ptr<BufferBatch>>{
+            std::move(batch)};
+      });
 
   auto trie =
       TrieStorageImpl::createEmpty(factory, codec, serializer, state_pruner)
@@ -273,4 +278,39 @@ TEST_F(TrieBatchTest, TopperBatchRemove) {
   ASSERT_FALSE(p_batch->contains("102030"_hex2buf).value());
 }
 
+/**
+ * @given vector stored in persistent batch and two nested topper batches
+ * @when items are appended to it through both toppers
+ * @then persistent batch is not changed until write back
+ * @and values read from toppers include all items appended beneath
+ */
+TEST_F(TrieBatchTest, TopperBatchAppend) {
+  std::shared_ptr<TrieBatch> p_batch =
+      trie->getPersistentBatchAt(empty_hash, std::nullopt).value();
+  ASSERT_OUTCOME_SUCCESS(p_batch->put("0e"_hex2buf, "04aa"_hex2buf));
+
+  auto m_batch = std::make_shared<TopperTrieBatchImpl>(p_batch);
+  auto t_batch = std::make_shared<TopperTrieBatchImpl>(m_batch);
+
+  ASSERT_OUTCOME_SUCCESS(t_batch->append("0e"_hex2buf, "bb"_hex2buf));
+  ASSERT_OUTCOME_SUCCESS(t_batch->append("0e"_hex2buf, "cc"_hex2buf));
+  ASSERT_OUTCOME_SUCCESS(t_batch->append("0f"_hex2buf, "ee"_hex2buf));
+  ASSERT_OUTCOME_IS_TRUE(t_batch->contains("0f"_hex2buf));
+  ASSERT_OUTCOME_IS_FALSE(m_batch->contains("0f"_hex2buf));
+  ASSERT_OUTCOME_SUCCESS(t_batch->writeBack());
+
+  ASSERT_OUTCOME_SUCCESS(m_batch->append("0e"_hex2buf, "dd"_hex2buf));
+  ASSERT_OUTCOME_SUCCESS(v1, m_batch->get("0e"_hex2buf));
+  ASSERT_EQ(v1, "10aabbccdd"_hex2buf);
+  ASSERT_OUTCOME_SUCCESS(m_batch->append("0e"_hex2buf, "ff"_hex2buf));
+  ASSERT_OUTCOME_SUCCESS(v2, p_batch->get("0e"_hex2buf));
+  ASSERT_EQ(v2, "04aa"_hex2buf);
+
+  ASSERT_OUTCOME_SUCCESS(m_batch->writeBack());
+  ASSERT_OUTCOME_SUCCESS(v3, p_batch->get("0e"_hex2buf));
+  ASSERT_EQ(v3, "14aabbccddff"_hex2buf);
+  ASSERT_OUTCOME_SUCCESS(v4, p_batch->get("0f"_hex2buf));
+  ASSERT_EQ(v4, "04ee"_hex2buf);
+}
+
 // TODO(Harrm): #595 test clearPrefix
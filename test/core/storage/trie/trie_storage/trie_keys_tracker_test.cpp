@@ -0,0 +1,125 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "storage/trie/trie_keys_tracker.hpp"
+
+#include <gtest/gtest.h>
+
+#include <qtils/test/outcome.hpp>
+
+#include "storage/in_memory/in_memory_spaced_storage.hpp"
+#include "storage/trie/impl/trie_storage_backend_impl.hpp"
+#include "storage/trie/polkadot_trie/polkadot_trie_factory_impl.hpp"
+#include "storage/trie/serialization/polkadot_codec.hpp"
+#include "storage/trie/serialization/trie_serializer_impl.hpp"
+#include "testutil/literals.hpp"
+#include "testutil/prepare_loggers.hpp"
+
+using kagome::common::Buffer;
+using namespace kagome::storage;
+using namespace kagome::storage::trie;
+
+class TrieKeysTrackerTest : public ::testing::Test {
+ public:
+  static void SetUpTestCase() {
+    testutil::prepareLoggers();
+  }
+
+  void SetUp() override {
+    factory_ = std::make_shared<PolkadotTrieFactoryImpl>();
+    serializer_ = std::make_shared<TrieSerializerImpl>(
+        factory_,
+        std::make_shared<PolkadotCodec>(),
+        std::make_shared<TrieStorageBackendImpl>(
+            std::make_shared<InMemorySpacedStorage>()));
+    trie_ = factory_->createEmpty();
+    for (int i = 0; i < 256; ++i) {
+      ASSERT_OUTCOME_SUCCESS(
+          trie_->put(Buffer::fromString("filler" + std::to_string(i)),
+                     Buffer::fromString("value" + std::to_string(i))));
+    }
+  }
+
+  RootHash store() {
+    auto [root, batch] =
+        serializer_->storeTrie(*trie_, StateVersion::V1).value();
+    batch->commit().value();
+    return root;
+  }
+
+  using Changes = std::vector<std::pair<size_t, std::optional<Buffer>>>;
+
+  Changes update(TrieKeysTracker &tracker, const RootHash &root) {
+    Changes changes;
+    tracker
+        .update(root,
+                [&](size_t i, const std::optional<Buffer> &value) {
+                  changes.emplace_back(i, value);
+                })
+        .value();
+    return changes;
+  }
+
+ protected:
+  std::shared_ptr<PolkadotTrieFactory> factory_;
+  std::shared_ptr<TrieSerializer> serializer_;
+  std::shared_ptr<PolkadotTrie> trie_;
+};
+
+/**
+ * @given a trie with some tracked keys
+ * @when the tracker is moved through several states of the trie
+ * @then only the keys whose values changed are reported for each state
+ */
+TEST_F(TrieKeysTrackerTest, ReportsOnlyChangedKeys) {
+  std::vector<Buffer> keys{"key1"_buf, "key2"_buf, "missing"_buf};
+  // longer than 32 bytes, so stored by hash with V1
+  Buffer big_value(64, 0xab);
+  ASSERT_OUTCOME_SUCCESS(trie_->put("key1"_buf, "a"_buf));
+  ASSERT_OUTCOME_SUCCESS(trie_->put("key2"_buf, Buffer{big_value}));
+  auto root1 = store();
+
+  TrieKeysTracker tracker{serializer_, keys};
+  EXPECT_EQ(update(tracker, root1),
+            (Changes{{0, "a"_buf}, {1, big_value}, {2, std::nullopt}}));
+
+  ASSERT_OUTCOME_SUCCESS(trie_->put("key1"_buf, "b"_buf));
+  auto root2 = store();
+  EXPECT_EQ(update(tracker, root2), (Changes{{0, "b"_buf}}));
+
+  ASSERT_OUTCOME_SUCCESS(trie_->remove("key2"_buf));
+  auto root3 = store();
+  EXPECT_EQ(update(tracker, root3), (Changes{{1, std::nullopt}}));
+
+  ASSERT_OUTCOME_SUCCESS(trie_->put("missing"_buf, "c"_buf));
+  auto root4 = store();
+  EXPECT_EQ(update(tracker, root4), (Changes{{2, "c"_buf}}));
+}
+
+/**
+ * @given a tracker which already visited a state
+ * @when it is updated with a state where the tracked keys are unchanged
+ * @then nothing is reported and only the nodes on the changed path are decoded
+ */
+TEST_F(TrieKeysTrackerTest, SkipsUnchangedSubtrees) {
+  std::vector<Buffer> keys{"key1"_buf};
+  ASSERT_OUTCOME_SUCCESS(trie_->put("key1"_buf, "a"_buf));
+  auto root1 = store();
+
+  TrieKeysTracker tracker{serializer_, keys};
+  EXPECT_EQ(update(tracker, root1).size(), 1);
+  auto decoded = tracker.decodedNodes();
+
+  EXPECT_TRUE(update(tracker, root1).empty());
+  EXPECT_EQ(tracker.decodedNodes(), decoded);
+
+  ASSERT_OUTCOME_SUCCESS(trie_->put("filler0"_buf, "other"_buf));
+  auto root2 = store();
+  EXPECT_TRUE(update(tracker, root2).empty());
+  // the new root is decoded, but not the whole path down to key1
+  EXPECT_GT(tracker.decodedNodes(), decoded);
+  EXPECT_LT(tracker.decodedNodes(), 2 * decoded);
+}
@@ -0,0 +1,146 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "storage/trie/serialization/trie_node_cache.hpp"
+
+#include <gtest/gtest.h>
+
+#include <qtils/test/outcome.hpp>
+
+#include "storage/in_memory/in_memory_spaced_storage.hpp"
+#include "storage/trie/impl/trie_storage_backend_impl.hpp"
+#include "storage/trie/polkadot_trie/polkadot_trie_factory_impl.hpp"
+#include "storage/trie/serialization/polkadot_codec.hpp"
+#include "storage/trie/serialization/trie_serializer_impl.hpp"
+#include "testutil/literals.hpp"
+#include "testutil/prepare_loggers.hpp"
+
+using kagome::common::Buffer;
+using kagome::common::BufferView;
+using kagome::common::Hash256;
+using namespace kagome::storage;
+using namespace kagome::storage::trie;
+
+class TrieNodeCacheTest : public ::testing::Test {
+ public:
+  static void SetUpTestCase() {
+    testutil::prepareLoggers();
+  }
+
+  void SetUp() override {
+    factory_ = std::make_shared<PolkadotTrieFactoryImpl>();
+    backend_ = std::make_shared<TrieStorageBackendImpl>(
+        std::make_shared<InMemorySpacedStorage>());
+    cache_ = std::make_shared<TrieNodeCache>(1 << 20);
+    serializer_ = std::make_shared<TrieSerializerImpl>(
+        factory_, std::make_shared<PolkadotCodec>(), backend_, cache_);
+  }
+
+  static size_t countLoaded(const TrieSerializer &serializer,
+                            const RootHash &root) {
+    size_t loaded = 0;
+    auto trie = serializer
+                    .retrieveTrie(root,
+                                  [&](const Hash256 &, BufferView) { ++loaded; })
+                    .value();
+    for (int i = 0; i < 64; ++i) {
+      trie->get(Buffer::fromString("key" + std::to_string(i))).value();
+    }
+    return loaded;
+  }
+
+ protected:
+  std::shared_ptr<PolkadotTrieFactory> factory_;
+  std::shared_ptr<TrieStorageBackendImpl> backend_;
+  std::shared_ptr<TrieNodeCache> cache_;
+  std::shared_ptr<TrieSerializer> serializer_;
+};
+
+/**
+ * @given a node put into the cache
+ * @when it is retrieved twice
+ * @then equal but distinct copies are returned, so that modifying one of them
+ * doesn't affect the cache
+ */
+TEST_F(TrieNodeCacheTest, ReturnsCopies) {
+  auto hash = "node"_hash256;
+  BranchNode node{KeyNibbles{Buffer{1, 2}}, "value"_buf};
+  node.setChild(3, std::make_shared<DummyNode>(MerkleValue{"child"_hash256}));
+  cache_->put(hash, node, "encoded"_buf);
+
+  Buffer encoded;
+  auto first = cache_->get(hash, [&](BufferView e) { encoded = Buffer{e}; });
+  ASSERT_NE(first, nullptr);
+  EXPECT_EQ(encoded, "encoded"_buf);
+  ASSERT_TRUE(first->isBranch());
+  EXPECT_EQ(first->getKeyNibbles(), node.getKeyNibbles());
+  EXPECT_EQ(first->getValue(), node.getValue());
+  EXPECT_EQ(first->asBranch().childrenBitmap(), node.childrenBitmap());
+
+  first->setValue(Buffer{"changed"_buf});
+  auto second = cache_->get(hash, {});
+  ASSERT_NE(second, nullptr);
+  EXPECT_NE(first, second);
+  EXPECT_EQ(second->getValue(), node.getValue());
+
+  EXPECT_EQ(cache_->get("other"_hash256, {}), nullptr);
+}
+
+/**
+ * @given a cache with a small budget
+ * @when more nodes than fit into the budget are put
+ * @then the least recently used ones are evicted and the budget is respected
+ */
+TEST_F(TrieNodeCacheTest, EvictsLeastRecentlyUsed) {
+  TrieNodeCache cache{16 * 1024};
+  LeafNode node{KeyNibbles{Buffer{1}}, Buffer(64, 1)};
+  std::vector<Hash256> hashes;
+  for (uint8_t i = 0; i < 255; ++i) {
+    Hash256 hash{};
+    // all in the same shard
+    hash[0] = 0;
+    hash[1] = i;
+    hashes.emplace_back(hash);
+    cache.put(hash, node, Buffer(64, 1));
+    // keep the first one used
+    EXPECT_NE(cache.get(hashes.front(), {}), nullptr);
+  }
+  EXPECT_LE(cache.sizeBytes(), 16 * 1024);
+  EXPECT_NE(cache.get(hashes.back(), {}), nullptr);
+  EXPECT_EQ(cache.get(hashes[1], {}), nullptr);
+}
+
+/**
+ * @given a serializer with a node cache and a stored trie
+ * @when the trie is read again through a serializer sharing the cache, but
+ * not the database
+ * @then the second read is served from the cache and still reports every
+ * loaded node, so proofs stay complete
+ */
+TEST_F(TrieNodeCacheTest, SerializerUsesCache) {
+  auto trie = factory_->createEmpty();
+  for (int i = 0; i < 64; ++i) {
+    ASSERT_OUTCOME_SUCCESS(
+        trie->put(Buffer::fromString("key" + std::to_string(i)),
+                  Buffer::fromString("value" + std::to_string(i))));
+  }
+  ASSERT_OUTCOME_SUCCESS(root_and_batch,
+                         serializer_->storeTrie(*trie, StateVersion::V0));
+  auto &[root, batch] = root_and_batch;
+  ASSERT_OUTCOME_SUCCESS(batch->commit());
+
+  auto loaded = countLoaded(*serializer_, root);
+  EXPECT_GT(loaded, 0);
+
+  // shares the cache, but not the database
+  TrieSerializerImpl empty_serializer{
+      factory_,
+      std::make_shared<PolkadotCodec>(),
+      std::make_shared<TrieStorageBackendImpl>(
+          std::make_shared<InMemorySpacedStorage>()),
+      cache_};
+  EXPECT_EQ(countLoaded(empty_serializer, root), loaded);
+}
@@ -0,0 +1,168 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "storage/trie/serialization/trie_serializer_impl.hpp"
+
+#include <gtest/gtest.h>
+
+#include <qtils/test/outcome.hpp>
+
+#include "common/worker_thread_pool.hpp"
+#include "storage/in_memory/in_memory_spaced_storage.hpp"
+#include "storage/trie/impl/trie_storage_backend_impl.hpp"
+#include "storage/trie/polkadot_trie/polkadot_trie_factory_impl.hpp"
+#include "storage/trie/serialization/polkadot_codec.hpp"
+#include "testutil/literals.hpp"
+#include "testutil/prepare_loggers.hpp"
+
+using kagome::TestThreadPool;
+using kagome::Watchdog;
+using kagome::common::Buffer;
+using kagome::common::WorkerThreadPool;
+using namespace kagome::storage;
+using namespace kagome::storage::trie;
+
+class TrieSerializerTest : public ::testing::TestWithParam<StateVersion> {
+ public:
+  static void SetUpTestCase() {
+    testutil::prepareLoggers();
+  }
+
+  void SetUp() override {
+    factory_ = std::make_shared<PolkadotTrieFactoryImpl>();
+  }
+
+  void TearDown() override {
+    watchdog_->stop();
+  }
+
+  std::shared_ptr<WorkerThreadPool> pool(size_t threads) {
+    return pools_.emplace_back(
+        std::make_shared<WorkerThreadPool>(watchdog_, threads));
+  }
+
+  std::shared_ptr<PolkadotTrie> createTrie() const {
+    auto trie = factory_->createEmpty();
+    for (size_t i = 0; i < 5000; ++i) {
+      // values both shorter and longer than the hashing threshold of V1
+      trie->put(Buffer::fromString("key" + std::to_string(i * 7919)),
+                Buffer(i % 64 + 1, i % 256))
+          .value();
+    }
+    return trie;
+  }
+
+  using Content = std::vector<std::pair<Buffer, Buffer>>;
+
+  static Content content(BufferStorage &db) {
+    Content content;
+    auto cursor = db.cursor();
+    EXPECT_TRUE(cursor->seekFirst().value());
+    while (cursor->isValid()) {
+      content.emplace_back(*cursor->key(),
+                           std::move(*cursor->value()).intoBuffer());
+      cursor->next().value();
+    }
+    return content;
+  }
+
+  std::pair<RootHash, Content> store(
+      std::shared_ptr<kagome::ThreadPool> encode_pool, size_t threads) const {
+    auto db = std::make_shared<InMemorySpacedStorage>();
+    TrieSerializerImpl serializer{factory_,
+                                  std::make_shared<PolkadotCodec>(),
+                                  std::make_shared<TrieStorageBackendImpl>(db),
+                                  nullptr,
+                                  std::move(encode_pool),
+                                  threads};
+    auto trie = createTrie();
+    auto [root, batch] = serializer.storeTrie(*trie, GetParam()).value();
+    batch->commit().value();
+    return {root, content(*db->getSpace(Space::kTrieNode))};
+  }
+
+ protected:
+  std::shared_ptr<PolkadotTrieFactory> factory_;
+  std::shared_ptr<Watchdog> watchdog_ =
+      std::make_shared<Watchdog>(std::chrono::milliseconds(1));
+  std::vector<std::shared_ptr<WorkerThreadPool>> pools_;
+};
+
+/**
+ * @given a trie large enough to be split into subtrees
+ * @when it is stored with several encoding threads
+ * @then the root and the stored nodes and values are the same as when it is
+ * stored on a single thread
+ */
+TEST_P(TrieSerializerTest, ParallelEncodingMatchesSequential) {
+  auto [root, nodes] = store(nullptr, 1);
+  EXPECT_FALSE(nodes.empty());
+  for (size_t threads : {2, 4, 16}) {
+    auto [parallel_root, parallel_nodes] = store(pool(threads), threads);
+    EXPECT_EQ(parallel_root, root) << threads;
+    EXPECT_EQ(parallel_nodes, nodes) << threads;
+  }
+}
+
+/**
+ * @given an encode pool, which doesn't run its tasks
+ * @when a trie is stored with it
+ * @then the calling thread encodes all subtrees itself, and the result is the
+ * same as stored without the pool
+ */
+TEST_P(TrieSerializerTest, ParallelEncodingWithIdlePool) {
+  auto [root, nodes] = store(nullptr, 1);
+  auto [idle_root, idle_nodes] =
+      store(std::make_shared<WorkerThreadPool>(TestThreadPool{}), 4);
+  EXPECT_EQ(idle_root, root);
+  EXPECT_EQ(idle_nodes, nodes);
+}
+
+/**
+ * @given a stored trie, which is then slightly modified
+ * @when it is stored again with several encoding threads
+ * @then the root matches the one of the same trie built from scratch, though
+ * most of the stored trie consists of dummy nodes
+ */
+TEST_P(TrieSerializerTest, ParallelEncodingOfModifiedTrie) {
+  auto db = std::make_shared<InMemorySpacedStorage>();
+  std::shared_ptr<TrieSerializer> serializer =
+      std::make_shared<TrieSerializerImpl>(
+          factory_,
+          std::make_shared<PolkadotCodec>(),
+          std::make_shared<TrieStorageBackendImpl>(db),
+          nullptr,
+          pool(4),
+          4);
+  ASSERT_OUTCOME_SUCCESS(root_and_batch,
+                         serializer->storeTrie(*createTrie(), GetParam()));
+  ASSERT_OUTCOME_SUCCESS(root_and_batch.second->commit());
+
+  ASSERT_OUTCOME_SUCCESS(stored,
+                         serializer->retrieveTrie(root_and_batch.first));
+  ASSERT_OUTCOME_SUCCESS(stored->put("key0"_buf, "changed"_buf));
+  ASSERT_OUTCOME_SUCCESS(stored->put("new key"_buf, "new value"_buf));
+  ASSERT_OUTCOME_SUCCESS(modified_root_and_batch,
+                         serializer->storeTrie(*stored, GetParam()));
+
+  auto expected = createTrie();
+  ASSERT_OUTCOME_SUCCESS(expected->put("key0"_buf, "changed"_buf));
+  ASSERT_OUTCOME_SUCCESS(expected->put("new key"_buf, "new value"_buf));
+  auto expected_root =
+      TrieSerializerImpl{factory_,
+                         std::make_shared<PolkadotCodec>(),
+                         std::make_shared<TrieStorageBackendImpl>(
+                             std::make_shared<InMemorySpacedStorage>())}
+          .storeTrie(*expected, GetParam())
+          .value()
+          .first;
+  EXPECT_EQ(modified_root_and_batch.first, expected_root);
+}
+
+INSTANTIATE_TEST_SUITE_P(TrieSerializerTestCases,
+                         TrieSerializerTest,
+                         ::testing::Values(StateVersion::V0,
+                                           StateVersion::V1));
@@ -0,0 +1,193 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "storage/trie/serialization/trie_state_overlay.hpp"
+
+#include <gtest/gtest.h>
+
+#include <qtils/test/outcome.hpp>
+
+#include "primitives/block_header.hpp"
+#include "storage/in_memory/in_memory_spaced_storage.hpp"
+#include "storage/trie/impl/trie_storage_backend_impl.hpp"
+#include "storage/trie/polkadot_trie/polkadot_trie_factory_impl.hpp"
+#include "storage/trie/serialization/polkadot_codec.hpp"
+#include "storage/trie/serialization/trie_serializer_impl.hpp"
+#include "testutil/literals.hpp"
+#include "testutil/prepare_loggers.hpp"
+
+using kagome::common::Buffer;
+using kagome::common::BufferView;
+using kagome::common::Hash256;
+using kagome::primitives::BlockHeader;
+using kagome::primitives::events::ChainEventType;
+using kagome::primitives::events::ChainSubscriptionEngine;
+using namespace kagome::storage;
+using namespace kagome::storage::trie;
+
+class TrieStateOverlayTest : public ::testing::Test {
+ public:
+  static void SetUpTestCase() {
+    testutil::prepareLoggers();
+  }
+
+  void SetUp() override {
+    factory_ = std::make_shared<PolkadotTrieFactoryImpl>();
+    backend_ = std::make_shared<TrieStorageBackendImpl>(
+        std::make_shared<InMemorySpacedStorage>());
+    overlay_ = std::make_shared<TrieStateOverlay>(4, 1 << 20);
+    serializer_ = std::make_shared<TrieSerializerImpl>(
+        factory_,
+        std::make_shared<PolkadotCodec>(),
+        backend_,
+        nullptr,
+        nullptr,
+        1,
+        overlay_);
+  }
+
+  static Hash256 makeHash(uint8_t first, uint8_t second) {
+    Hash256 hash{};
+    hash[0] = first;
+    hash[1] = second;
+    return hash;
+  }
+
+  /**
+   * Adds a state which diff is its root and one more node with \arg node
+   * hash
+   */
+  static RootHash addState(TrieStateOverlay &overlay,
+                           uint8_t root,
+                           const Hash256 &node) {
+    auto hash = makeHash(root, 0);
+    TrieStateOverlay::Entries entries;
+    entries.emplace_back(node, Buffer(8, root));
+    entries.emplace_back(hash, Buffer(8, root));
+    overlay.add(hash, std::move(entries));
+    return hash;
+  }
+
+ protected:
+  std::shared_ptr<PolkadotTrieFactory> factory_;
+  std::shared_ptr<TrieStorageBackendImpl> backend_;
+  std::shared_ptr<TrieStateOverlay> overlay_;
+  std::shared_ptr<TrieSerializer> serializer_;
+};
+
+/**
+ * @given a trie stored by a serializer with an overlay
+ * @when the batch is committed, and the trie is read back by a serializer
+ * with the same overlay but an empty database
+ * @then the state is added to the overlay only after the commit, all of its
+ * nodes and values are served from the overlay and reported as loaded
+ */
+TEST_F(TrieStateOverlayTest, SerializerReadsRecentState) {
+  auto trie = factory_->createEmpty();
+  for (int i = 0; i < 64; ++i) {
+    ASSERT_OUTCOME_SUCCESS(
+        trie->put(Buffer::fromString("key" + std::to_string(i)),
+                  Buffer(i + 1, static_cast<uint8_t>(i))));
+  }
+  ASSERT_OUTCOME_SUCCESS(root_and_batch,
+                         serializer_->storeTrie(*trie, StateVersion::V1));
+  auto &root = root_and_batch.first;
+  EXPECT_FALSE(overlay_->contains(root));
+  ASSERT_OUTCOME_SUCCESS(root_and_batch.second->commit());
+  EXPECT_TRUE(overlay_->contains(root));
+
+  TrieSerializerImpl reader{factory_,
+                            std::make_shared<PolkadotCodec>(),
+                            std::make_shared<TrieStorageBackendImpl>(
+                                std::make_shared<InMemorySpacedStorage>()),
+                            nullptr,
+                            nullptr,
+                            1,
+                            overlay_};
+  size_t loaded = 0;
+  ASSERT_OUTCOME_SUCCESS(
+      stored,
+      reader.retrieveTrie(root,
+                          [&](const Hash256 &, BufferView) { ++loaded; }));
+  for (int i = 0; i < 64; ++i) {
+    ASSERT_OUTCOME_SUCCESS(
+        value, stored->get(Buffer::fromString("key" + std::to_string(i))));
+    EXPECT_EQ(value, Buffer(i + 1, static_cast<uint8_t>(i)));
+  }
+  EXPECT_GT(loaded, 0);
+
+  overlay_->onFinalized(addState(*overlay_, 1, "node"_hash256));
+  EXPECT_FALSE(overlay_->contains(root));
+  EXPECT_FALSE(reader.retrieveTrie(root, nullptr));
+}
+
+/**
+ * @given a trie stored by a serializer with an overlay
+ * @when the batch is dropped without commit
+ * @then the state is not added to the overlay
+ */
+TEST_F(TrieStateOverlayTest, UncommittedStateIsNotAdded) {
+  auto trie = factory_->createEmpty();
+  ASSERT_OUTCOME_SUCCESS(trie->put("key"_buf, "value"_buf));
+  ASSERT_OUTCOME_SUCCESS(root_and_batch,
+                         serializer_->storeTrie(*trie, StateVersion::V1));
+  root_and_batch.second.reset();
+  EXPECT_FALSE(overlay_->contains(root_and_batch.first));
+}
+
+/**
+ * @given an overlay of at most 4 states
+ * @when more states are added, some of them sharing a node
+ * @then the oldest states are evicted, a shared node is kept while any state
+ * referencing it is kept
+ */
+TEST_F(TrieStateOverlayTest, EvictsOldestStates) {
+  auto shared = "shared"_hash256;
+  auto first = addState(*overlay_, 1, shared);
+  addState(*overlay_, 2, shared);
+  for (uint8_t i = 3; i <= 5; ++i) {
+    addState(*overlay_, i, makeHash(0, i));
+  }
+  EXPECT_EQ(overlay_->statesNum(), 4);
+  EXPECT_FALSE(overlay_->contains(first));
+  EXPECT_FALSE(overlay_->get(first));
+  auto shared_value = overlay_->get(shared);
+  ASSERT_TRUE(shared_value);
+  EXPECT_EQ(*shared_value, Buffer(8, 1));
+
+  addState(*overlay_, 6, makeHash(0, 6));
+  EXPECT_FALSE(overlay_->get(shared));
+  // value returned before eviction stays valid
+  EXPECT_EQ(*shared_value, Buffer(8, 1));
+  EXPECT_EQ(overlay_->sizeBytes(), 4 * 2 * 8);
+}
+
+/**
+ * @given an overlay subscribed to finalization
+ * @when a block which state is in the overlay is finalized
+ * @then states committed before it are dropped, the finalized state and
+ * later ones are kept
+ */
+TEST_F(TrieStateOverlayTest, EvictsOnFinalization) {
+  auto engine = std::make_shared<ChainSubscriptionEngine>();
+  TrieStateOverlay overlay{16, 1 << 20, engine};
+  std::vector<RootHash> roots;
+  for (uint8_t i = 1; i <= 4; ++i) {
+    roots.emplace_back(addState(overlay, i, makeHash(0, i)));
+  }
+
+  BlockHeader header;
+  header.state_root = "unknown"_hash256;
+  engine->notify(ChainEventType::kFinalizedHeads, header);
+  EXPECT_EQ(overlay.statesNum(), 4);
+
+  header.state_root = roots[2];
+  engine->notify(ChainEventType::kFinalizedHeads, header);
+  EXPECT_EQ(overlay.statesNum(), 2);
+  EXPECT_FALSE(overlay.contains(roots[1]));
+  EXPECT_TRUE(overlay.contains(roots[2]));
+  EXPECT_TRUE(overlay.contains(roots[3]));
+}
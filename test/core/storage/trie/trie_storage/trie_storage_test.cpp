@@ -23,9 +23,11 @@
 
 using kagome::common::Buffer;
 using kagome::primitives::BlockHash;
+using kagome::storage::BufferBatch;
 using kagome::storage::RocksDb;
 using kagome::storage::Space;
 using kagome::storage::trie::PolkadotCodec;
+using kagome::storage::trie::PolkadotTrie;
 using kagome::storage::trie::PolkadotTrieFactoryImpl;
 using kagome::storage::trie::RootHash;
 using kagome::storage::trie::StateVersion;
@@ -35,7 +37,6 @@ using kagome::storage::trie::TrieStorageImpl;
 using kagome::storage::trie_pruner::TriePrunerMock;
 using kagome::subscription::SubscriptionEngine;
 using testing::_;
-using testing::Return;
 
 /**
  * @given an empty persistent trie with RocksDb backend
@@ -61,9 +62,11 @@ TEST(TriePersistencyTest, CreateDestroyCreate) {
 
     auto state_pruner = std::make_shared<TriePrunerMock>();
     ON_CALL(*state_pruner,
-            addNewState(
-                testing::A<const kagome::storage::trie::PolkadotTrie &>(), _))
-        .WillByDefault(Return(outcome::success()));
+            addNewState(testing::A<const PolkadotTrie &>(), _, _))
+        .WillByDefault([](auto &, auto, auto batch) {
+          return outcome::result<std::unique_ptr<BufferBatch>>{
+              std::move(batch)};
+        });
 
     auto storage =
         TrieStorageImpl::createEmpty(factory, codec, serializer, state_pruner)
@@ -0,0 +1,144 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "storage/trie_pruner/impl/ref_count_store.hpp"
+
+#include <gtest/gtest.h>
+
+#include <qtils/test/outcome.hpp>
+
+#include "storage/in_memory/in_memory_storage.hpp"
+
+using kagome::common::Buffer;
+using kagome::common::Hash256;
+using kagome::storage::BufferStorage;
+using kagome::storage::InMemoryStorage;
+using kagome::storage::trie_pruner::RefCountStore;
+
+class RefCountStoreTest : public testing::Test {
+ public:
+  static Hash256 makeKey(size_t i) {
+    Hash256 key;
+    // same first bytes to force probe collisions
+    key[0] = i % 4;
+    key[31] = i;
+    key[30] = i >> 8;
+    return key;
+  }
+
+  /// Counts of all keys reported by store
+  static std::map<Hash256, size_t> collect(RefCountStore &store) {
+    std::map<Hash256, size_t> counts;
+    EXPECT_OUTCOME_SUCCESS(store.forEach(
+        [&](const Hash256 &key, size_t count) { counts[key] = count; }));
+    return counts;
+  }
+
+  std::shared_ptr<BufferStorage> space_ = std::make_shared<InMemoryStorage>();
+};
+
+/**
+ * @given in-memory store
+ * @when counts are set and reset to zero
+ * @then only non-zero counts are tracked
+ */
+TEST_F(RefCountStoreTest, Memory) {
+  RefCountStore store{nullptr, 'n', 0};
+  for (size_t i = 0; i < 3000; ++i) {
+    ASSERT_OUTCOME_SUCCESS(count, store.get(makeKey(i)));
+    EXPECT_EQ(count, 0);
+    store.set(makeKey(i), i + 1);
+  }
+  EXPECT_EQ(store.size(), 3000);
+  for (size_t i = 0; i < 3000; i += 2) {
+    store.set(makeKey(i), 0);
+  }
+  EXPECT_EQ(store.size(), 1500);
+  for (size_t i = 0; i < 3000; ++i) {
+    ASSERT_OUTCOME_SUCCESS(count, store.get(makeKey(i)));
+    EXPECT_EQ(count, i % 2 == 0 ? 0 : i + 1);
+  }
+  EXPECT_EQ(collect(store).size(), 1500);
+}
+
+/**
+ * @given store backed by space
+ * @when counts are flushed and cache is dropped
+ * @then counts are read back from space, also by new store
+ */
+TEST_F(RefCountStoreTest, Persistent) {
+  RefCountStore store{space_, 'n', 100};
+  for (size_t i = 0; i < 1000; ++i) {
+    ASSERT_OUTCOME_SUCCESS_TRY(store.get(makeKey(i)));
+    store.set(makeKey(i), i + 1);
+  }
+  auto batch = space_->batch();
+  ASSERT_OUTCOME_SUCCESS_TRY(store.flush(*batch));
+  ASSERT_OUTCOME_SUCCESS_TRY(batch->commit());
+  store.shrink();
+
+  ASSERT_OUTCOME_SUCCESS_TRY(store.get(makeKey(1)));
+  store.set(makeKey(1), 0);
+  ASSERT_OUTCOME_SUCCESS(count, store.get(makeKey(2)));
+  EXPECT_EQ(count, 3);
+  EXPECT_EQ(store.size(), 999);
+  // unflushed changes are visible
+  auto counts = collect(store);
+  EXPECT_EQ(counts.size(), 999);
+  EXPECT_EQ(counts.count(makeKey(1)), 0);
+
+  batch = space_->batch();
+  ASSERT_OUTCOME_SUCCESS_TRY(store.flush(*batch));
+  ASSERT_OUTCOME_SUCCESS_TRY(batch->commit());
+
+  RefCountStore restored{space_, 'n', 100};
+  ASSERT_OUTCOME_SUCCESS_TRY(restored.load());
+  EXPECT_EQ(restored.size(), 999);
+  EXPECT_EQ(collect(restored), counts);
+
+  // other prefix is independent
+  RefCountStore other{space_, 'v', 100};
+  ASSERT_OUTCOME_SUCCESS_TRY(other.load());
+  EXPECT_EQ(other.size(), 0);
+  EXPECT_TRUE(collect(other).empty());
+
+  ASSERT_OUTCOME_SUCCESS_TRY(restored.clear());
+  EXPECT_EQ(restored.size(), 0);
+  EXPECT_TRUE(collect(restored).empty());
+}
+
+/**
+ * @given store sharing space with other keys, some of them starting with
+ * store prefix or having length of count keys
+ * @when counts are iterated and cleared
+ * @then other keys are neither reported nor removed
+ */
+TEST_F(RefCountStoreTest, SharedSpace) {
+  std::vector<Buffer> others;
+  others.emplace_back(makeKey(1));
+  others.back()[0] = 'n';
+  others.emplace_back(Buffer{'n'}.put(makeKey(2)));
+  others.emplace_back(Buffer::fromString(RefCountStore::kKeyMarker));
+  for (auto &key : others) {
+    ASSERT_OUTCOME_SUCCESS_TRY(space_->put(key, Buffer{1}));
+  }
+
+  RefCountStore store{space_, 'n', 0};
+  ASSERT_OUTCOME_SUCCESS_TRY(store.get(makeKey(3)));
+  store.set(makeKey(3), 1);
+  auto batch = space_->batch();
+  ASSERT_OUTCOME_SUCCESS_TRY(store.flush(*batch));
+  ASSERT_OUTCOME_SUCCESS_TRY(batch->commit());
+  store.shrink();
+
+  EXPECT_EQ(collect(store), (std::map<Hash256, size_t>{{makeKey(3), 1}}));
+  ASSERT_OUTCOME_SUCCESS_TRY(store.clear());
+  EXPECT_TRUE(collect(store).empty());
+  for (auto &key : others) {
+    ASSERT_OUTCOME_SUCCESS(contains, space_->contains(key));
+    EXPECT_TRUE(contains);
+  }
+}
@@ -545,8 +545,8 @@ TEST_F(TriePrunerTest, RandomTree) {
     total_set.merge(new_set);
     ASSERT_OUTCOME_SUCCESS(pruner->addNewState(*trie, trie::StateVersion::V0));
     std::set<Hash256> tracked_set;
-    pruner->forRefCounts(
-        [&](auto &node, auto count) { tracked_set.insert(node); });
+    ASSERT_OUTCOME_SUCCESS_TRY(pruner->forRefCounts(
+        [&](auto &node, auto count) { tracked_set.insert(node); }));
     std::set<Hash256> diff;
     std::set_symmetric_difference(total_set.begin(),
                                   total_set.end(),
@@ -0,0 +1,141 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "utils/parallel_for.hpp"
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <future>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include <boost/asio/executor_work_guard.hpp>
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/post.hpp>
+
+using kagome::parallelFor;
+using kagome::parallelForAsync;
+using kagome::TaskGroup;
+
+class ParallelForTest : public testing::Test {
+ protected:
+  void SetUp() override {
+    for (auto &thread : threads_) {
+      thread = std::thread{[this] { pool_.run(); }};
+    }
+  }
+
+  void TearDown() override {
+    work_guard_.reset();
+    for (auto &thread : threads_) {
+      thread.join();
+    }
+  }
+
+  boost::asio::io_context pool_;
+  boost::asio::executor_work_guard<boost::asio::io_context::executor_type>
+      work_guard_ = boost::asio::make_work_guard(pool_);
+  std::array<std::thread, 4> threads_;
+};
+
+/**
+ * @given pool with threads
+ * @when parallelFor is called
+ * @then function is called exactly once for every index
+ */
+TEST_F(ParallelForTest, CallsEveryIndexOnce) {
+  for (size_t n : {0, 1, 2, 100}) {
+    std::vector<std::atomic_size_t> calls(n);
+    parallelFor(pool_, n, [&](size_t i) { ++calls[i]; });
+    for (auto &count : calls) {
+      EXPECT_EQ(count, 1);
+    }
+  }
+}
+
+/**
+ * @given pool which doesn't run
+ * @when parallelFor is called
+ * @then calling thread runs every index itself, instead of waiting forever
+ */
+TEST(ParallelForStoppedPoolTest, CallerRunsTasks) {
+  boost::asio::io_context pool;
+  std::atomic_size_t calls = 0;
+  parallelFor(pool, 10, [&](size_t) { ++calls; });
+  EXPECT_EQ(calls, 10);
+}
+
+/**
+ * @given pool with threads
+ * @when some index throws
+ * @then parallelFor rethrows it after all other indices finish
+ */
+TEST_F(ParallelForTest, RethrowsAfterAll) {
+  std::atomic_size_t calls = 0;
+  EXPECT_THROW(parallelFor(pool_,
+                           10,
+                           [&](size_t i) {
+                             ++calls;
+                             if (i == 3) {
+                               throw std::runtime_error{"error"};
+                             }
+                           }),
+               std::runtime_error);
+  EXPECT_EQ(calls, 10);
+}
+
+/**
+ * @given pool with single thread
+ * @when parallelFor is called from that thread
+ * @then it doesn't deadlock, because the caller runs tasks not started yet
+ */
+TEST(ParallelForSingleThreadTest, NestedInPoolThread) {
+  boost::asio::io_context pool;
+  std::promise<size_t> result;
+  boost::asio::post(pool, [&] {
+    std::atomic_size_t calls = 0;
+    parallelFor(pool, 10, [&](size_t) { ++calls; });
+    result.set_value(calls);
+  });
+  pool.run_one();
+  EXPECT_EQ(result.get_future().get(), 10);
+}
+
+/**
+ * @given pool with threads
+ * @when parallelForAsync is called
+ * @then done is called once, after every index
+ */
+TEST_F(ParallelForTest, AsyncCallsDoneAfterAll) {
+  for (size_t n : {0, 1, 100}) {
+    std::atomic_size_t calls = 0;
+    std::promise<size_t> done;
+    parallelForAsync(
+        pool_,
+        n,
+        [&](size_t) { ++calls; },
+        [&] { done.set_value(calls); });
+    EXPECT_EQ(done.get_future().get(), n);
+  }
+}
+
+/**
+ * @given task group with spawned tasks
+ * @when group is destroyed without wait
+ * @then tasks are finished before destruction returns
+ */
+TEST_F(ParallelForTest, GroupDestructorWaits) {
+  std::atomic_size_t calls = 0;
+  {
+    TaskGroup tasks;
+    for (size_t i = 0; i < 10; ++i) {
+      tasks.spawn(pool_, [&] { ++calls; });
+    }
+  }
+  EXPECT_EQ(calls, 10);
+}
@@ -61,6 +61,14 @@ namespace kagome::api {
                  std::optional<primitives::BlockHash> to),
                 (const, override));
 
+    MOCK_METHOD(outcome::result<void>,
+                queryStorageLazy,
+                (std::span<const common::Buffer> keys,
+                 const primitives::BlockHash &from,
+                 std::optional<primitives::BlockHash> to,
+                 const OnStorageChangeSet &on_change_set),
+                (const, override));
+
     MOCK_METHOD(outcome::result<std::vector<StorageChangeSet>>,
                 queryStorageAt,
                 (std::span<const common::Buffer> keys,
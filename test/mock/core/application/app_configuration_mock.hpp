@@ -81,6 +81,13 @@ namespace kagome::application {
 
     MOCK_METHOD(uint32_t, maxWsConnections, (), (const, override));
 
+    MOCK_METHOD(uint32_t, wsMaxQueueSize, (), (const, override));
+
+    MOCK_METHOD(WsSlowConsumerPolicy,
+                wsSlowConsumerPolicy,
+                (),
+                (const, override));
+
     MOCK_METHOD(std::chrono::seconds,
                 getRandomWalkInterval,
                 (),
@@ -120,6 +127,8 @@ namespace kagome::application {
 
     MOCK_METHOD(bool, purgeWavmCache, (), (const, override));
 
+    MOCK_METHOD(bool, wasmMemorySnapshot, (), (const, override));
+
     MOCK_METHOD(uint32_t,
                 parachainRuntimeInstanceCacheSize,
                 (),
@@ -186,6 +195,14 @@ namespace kagome::application {
 
     MOCK_METHOD(uint32_t, dbCacheSize, (), (const, override));
 
+    MOCK_METHOD(uint32_t, trieNodeCacheSize, (), (const, override));
+
+    MOCK_METHOD(uint32_t, trieStateOverlaySize, (), (const, override));
+
+    MOCK_METHOD(uint32_t, trieStateOverlayCapacity, (), (const, override));
+
+    MOCK_METHOD(uint32_t, statePrefetchThreads, (), (const, override));
+
     MOCK_METHOD(std::optional<std::string_view>,
                 devMnemonicPhrase,
                 (),
@@ -212,6 +229,8 @@ namespace kagome::application {
 
     MOCK_METHOD(uint32_t, maxParallelDownloads, (), (const, override));
 
+    MOCK_METHOD(uint32_t, maxStateSyncPeers, (), (const, override));
+
     MOCK_METHOD(std::optional<BlockNumber>,
                 unsafeSyncTo,
                 (),
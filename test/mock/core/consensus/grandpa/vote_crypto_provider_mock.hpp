@@ -29,6 +29,11 @@ namespace kagome::consensus::grandpa {
                 (const SignedMessage &precommit),
                 (const, override));
 
+    MOCK_METHOD(bool,
+                verifyBatch,
+                (const std::vector<const SignedMessage *> &votes),
+                (const, override));
+
     MOCK_METHOD(std::optional<SignedMessage>,
                 signPrimaryPropose,
                 (const PrimaryPropose &primary_propose),
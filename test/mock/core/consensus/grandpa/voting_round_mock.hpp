@@ -76,6 +76,11 @@ namespace kagome::consensus::grandpa {
                 (OptRef<GrandpaContext>, const SignedMessage &, Propagation),
                 (override));
 
+    MOCK_METHOD(void,
+                verifyVotes,
+                (const std::vector<const SignedMessage *> &),
+                (const, override));
+
     MOCK_METHOD(void,
                 update,
                 (IsPreviousRoundChanged,
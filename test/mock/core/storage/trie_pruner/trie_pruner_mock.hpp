@@ -26,6 +26,13 @@ namespace kagome::storage::trie_pruner {
                  trie::StateVersion version),
                 (override));
 
+    MOCK_METHOD(outcome::result<std::unique_ptr<BufferBatch>>,
+                addNewState,
+                (const trie::PolkadotTrie &new_trie,
+                 trie::StateVersion version,
+                 std::unique_ptr<BufferBatch> batch),
+                (override));
+
     MOCK_METHOD(void,
                 schedulePrune,
                 (const trie::RootHash &root,